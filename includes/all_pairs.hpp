@@ -0,0 +1,393 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "indexed_graph.hpp"
+#include "path_search.hpp"
+
+// Non-standard qualifier promising the compiler that pointers do not overlap, accepted by GCC, Clang and Microsoft Visual Studio
+#define TABLE_RESTRICT __restrict
+// Builds an additional AVX2 version of the row kernel that is selected when the program is loaded on a processor supporting it
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define TABLE_KERNEL_CLONES __attribute__((target_clones("avx2", "default")))
+#else
+#define TABLE_KERNEL_CLONES
+#endif
+
+
+/**
+ * Shortest distances between every pair of verticies of a graph, along with the first vertex after the source vertex on each
+ * shortest path (next hop), computed by a blocked Floyd-Warshall algorithm so that every path is recovered without a search
+ * @tparam Type typename of the edge weights of the graph
+ *
+ * Both matrices are stored row-major with rows padded beyond a multiple of `block_size`, and every round of the algorithm updates
+ * one `block_size` x `block_size` tile at a time: the tile on the diagonal of the round first, then the tiles sharing its row
+ * or column, then all remaining tiles. Tiles of the same phase are independent, so the second and third phases are split across
+ * threads, and each tile update is a branchless min-plus loop over contiguous rows that the compiler vectorizes
+ *
+ * @note Building the table takes time cubic and memory quadratic in the number of verticies, so it is limited to graphs of
+ * at most `max_vertex_count` verticies
+ * @note Tables are only valid for the graph they were built from, which is identified by a fingerprint of its verticies and edges
+ * when tables are saved to and loaded from files
+ */
+template <class Type>
+class all_pairs_table final {
+public:
+    /// @brief Number of rows and columns of each tile (a tile of distances and next hops fits within the L1 or L2 data cache)
+    static constexpr size_t block_size = 64;
+    /// @brief Number of unused entries appended to every row (a single 64-byte cache line of distances)
+    static constexpr size_t row_padding = 64 / sizeof(Type);
+    /// @brief Largest number of verticies a table is built for
+    static constexpr unsigned int max_vertex_count = 1024;
+    /// @brief Extension appended to the name of a graph text file to form the name of its all-pairs table file
+    static constexpr const char* file_extension = ".apsp";
+
+    // Constructor creates an empty table, allocating all storage from `resource`
+    all_pairs_table(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): distances{resource},
+        next_hops{resource}, vertex_count(0), stride(0), graph_fingerprint(0) {}
+
+
+    /**
+         * Replaces the contents of the calling `all_pairs_table` with the shortest distances and next hops between every pair of
+         * verticies of `graph`
+         * @param graph Graph whose edge weights are all non-negative
+         * @param thread_count Number of threads updating independent tiles (0 uses one thread per hardware thread)
+         * @throws `std::runtime_error` if `graph` has more than `max_vertex_count` verticies
+         */
+    void build(const indexed_graph<Type>& graph, unsigned int thread_count = 0) {
+        if (graph.get_vertex_count() > max_vertex_count) {
+            throw std::runtime_error("ERROR: Graph has too many verticies for an all-pairs shortest path table!");
+        }
+        vertex_count = graph.get_vertex_count();
+        graph_fingerprint = graph.get_fingerprint();
+        reset_storage();
+        size_t block_count = (vertex_count + block_size - 1) / block_size;
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            distances[vertex * stride + vertex] = 0;
+            next_hops[vertex * stride + vertex] = vertex;
+            for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                size_t cell = vertex * stride + adjacent_edge.target;
+                if (adjacent_edge.weight < distances[cell]) {
+                    distances[cell] = adjacent_edge.weight;
+                    next_hops[cell] = adjacent_edge.target;
+                }
+            }
+        }
+        if (thread_count == 0) {
+            thread_count = std::max(1U, std::thread::hardware_concurrency());
+        }
+
+        for (size_t pivot = 0; pivot < block_count; pivot++) {
+            relax_tile(pivot, pivot, pivot);
+            // Tiles in the row and column of the pivot tile only depend on the pivot tile
+            run_tiles(2 * (block_count - 1), thread_count, [&](size_t item) {
+                size_t other = item / 2 < pivot ? item / 2 : item / 2 + 1;
+                if (item % 2 == 0) {
+                    relax_tile(pivot, other, pivot);
+                } else {
+                    relax_tile(other, pivot, pivot);
+                }
+            });
+            // All remaining tiles only depend on the tiles updated by the first two phases
+            run_tiles((block_count - 1) * (block_count - 1), thread_count, [&](size_t item) {
+                size_t row = item / (block_count - 1);
+                size_t column = item % (block_count - 1);
+                relax_tile(row < pivot ? row : row + 1, column < pivot ? column : column + 1, pivot);
+            });
+        }
+    }
+
+
+    /**
+         * Retrieves the length of the shortest path from `source_id` to `destination_id`
+         * @param source_id ID of the source vertex
+         * @param destination_id ID of the destination vertex
+         * @return Shortest distance (infinity if the destination vertex is unreachable)
+         */
+    Type get_distance(unsigned int source_id, unsigned int destination_id) const {
+        return distances[source_id * stride + destination_id];
+    }
+
+
+    /**
+         * Retrieves the vertex following `source_id` on the shortest path to `destination_id`
+         * @param source_id ID of the source vertex
+         * @param destination_id ID of the destination vertex
+         * @return ID of the next vertex (`destination_id` itself if the verticies are equal, `name_arena::invalid_id` if unreachable)
+         */
+    unsigned int get_next_hop(unsigned int source_id, unsigned int destination_id) const {
+        return next_hops[source_id * stride + destination_id];
+    }
+
+
+    /**
+         * Writes the IDs of the verticies along the shortest path from `source_id` to `destination_id` into `path` by following
+         * next hops, in time proportional to the length of the path
+         * @param source_id ID of the source vertex
+         * @param destination_id ID of the destination vertex
+         * @param path Filled with the vertex IDs from the source vertex to the destination vertex (emptied if unreachable)
+         * @return `true` if a path exists, else `false`
+         */
+    bool extract_path(unsigned int source_id, unsigned int destination_id, std::pmr::vector<unsigned int>& path) const {
+        path.clear();
+        if (get_next_hop(source_id, destination_id) == name_arena::invalid_id) {
+            return false;
+        }
+        path.push_back(source_id);
+        for (unsigned int vertex = source_id; vertex != destination_id; ) {
+            vertex = get_next_hop(vertex, destination_id);
+            path.push_back(vertex);
+        }
+        return true;
+    }
+
+
+    /**
+         * Retrieves the number of verticies of the graph the table was built from
+         * @return Number of verticies (0 before `build` is called)
+         */
+    unsigned int get_vertex_count() const {
+        return vertex_count;
+    }
+
+
+    /**
+         * Determines whether the table was built from a graph identical to `graph`
+         * @param graph Graph to be compared against the graph the table was built from
+         * @return `true` if both graphs have the same verticies and edges, else `false`
+         */
+    bool matches(const indexed_graph<Type>& graph) const {
+        return vertex_count == graph.get_vertex_count() && graph_fingerprint == graph.get_fingerprint();
+    }
+
+
+    /**
+         * Writes the distances and next hops between every pair of verticies to the binary file `filename` (without row padding)
+         * @param filename Relative path to the file to be written
+         * @return 0 if successful, -1 upon failure
+         */
+    int save(const std::string& filename) const {
+        static_assert(std::is_trivially_copyable_v<Type>, "All-pairs tables can only be saved for trivially copyable weight types");
+        std::ofstream write_file(filename, std::ios::binary | std::ios::trunc);
+        if (!write_file.is_open()) {
+            std::cerr << "ERROR: Could not open file '" << filename << "' for writing the all-pairs table!" << '\n';
+            return -1;
+        }
+        std::uint32_t type_size = static_cast<std::uint32_t>(sizeof(Type));
+        write_file.write(file_tag, sizeof(file_tag));
+        write_file.write(reinterpret_cast<const char*>(&type_size), sizeof(type_size));
+        write_file.write(reinterpret_cast<const char*>(&vertex_count), sizeof(vertex_count));
+        write_file.write(reinterpret_cast<const char*>(&graph_fingerprint), sizeof(graph_fingerprint));
+        for (size_t row = 0; row < vertex_count; row++) {
+            write_file.write(reinterpret_cast<const char*>(distances.data() + row * stride), static_cast<std::streamsize>(vertex_count * sizeof(Type)));
+        }
+        for (size_t row = 0; row < vertex_count; row++) {
+            write_file.write(reinterpret_cast<const char*>(next_hops.data() + row * stride),
+                static_cast<std::streamsize>(vertex_count * sizeof(unsigned int)));
+        }
+        if (!write_file.good()) {
+            std::cerr << "ERROR: An error was encountered while writing the all-pairs table to '" << filename << "'!" << '\n';
+            return -1;
+        }
+        return 0;
+    }
+
+
+    /**
+         * Replaces the contents of the calling `all_pairs_table` with the table stored in the binary file `filename`, if it was
+         * built from a graph identical to `graph`
+         * @param filename Relative path to the file written by `save`
+         * @param graph Graph the loaded table will be used with
+         * @return 0 if successful, -1 if the file does not exist, cannot be read or was built from a different graph
+         * (the calling `all_pairs_table` is left unchanged)
+         */
+    int load(const std::string& filename, const indexed_graph<Type>& graph) {
+        std::ifstream read_file(filename, std::ios::binary);
+        if (!read_file.is_open()) {
+            return -1;
+        }
+        char tag[sizeof(file_tag)] = {};
+        std::uint32_t type_size = 0;
+        unsigned int file_vertex_count = 0;
+        std::uint64_t file_fingerprint = 0;
+        read_file.read(tag, sizeof(tag));
+        read_file.read(reinterpret_cast<char*>(&type_size), sizeof(type_size));
+        read_file.read(reinterpret_cast<char*>(&file_vertex_count), sizeof(file_vertex_count));
+        read_file.read(reinterpret_cast<char*>(&file_fingerprint), sizeof(file_fingerprint));
+        if (!read_file.good() || std::memcmp(tag, file_tag, sizeof(file_tag)) != 0 || type_size != sizeof(Type) ||
+            file_vertex_count != graph.get_vertex_count() || file_vertex_count > max_vertex_count || file_fingerprint != graph.get_fingerprint()) {
+            return -1;
+        }
+        size_t cell_count = static_cast<size_t>(file_vertex_count) * file_vertex_count;
+        std::pmr::vector<Type> file_distances(cell_count, Type{}, distances.get_allocator());
+        std::pmr::vector<unsigned int> file_hops(cell_count, 0, next_hops.get_allocator());
+        read_file.read(reinterpret_cast<char*>(file_distances.data()), static_cast<std::streamsize>(cell_count * sizeof(Type)));
+        read_file.read(reinterpret_cast<char*>(file_hops.data()), static_cast<std::streamsize>(cell_count * sizeof(unsigned int)));
+        if (!read_file.good()) {
+            return -1;
+        }
+        for (unsigned int hop : file_hops) {
+            if (hop >= file_vertex_count && hop != name_arena::invalid_id) {
+                return -1;
+            }
+        }
+        vertex_count = file_vertex_count;
+        graph_fingerprint = file_fingerprint;
+        reset_storage();
+        for (size_t row = 0; row < vertex_count; row++) {
+            std::copy_n(file_distances.begin() + static_cast<std::ptrdiff_t>(row * vertex_count), vertex_count, distances.begin() + static_cast<std::ptrdiff_t>(row * stride));
+            std::copy_n(file_hops.begin() + static_cast<std::ptrdiff_t>(row * vertex_count), vertex_count, next_hops.begin() + static_cast<std::ptrdiff_t>(row * stride));
+        }
+        return 0;
+    }
+
+private:
+    /// @brief Tag identifying all-pairs table files (and the version of their layout)
+    static constexpr char file_tag[8] = {'G', 'R', 'P', 'H', 'A', 'P', 'S', '1'};
+
+
+    /**
+         * Sizes both matrices for `vertex_count` verticies, with every entry unreachable
+         */
+    void reset_storage() {
+        size_t block_count = (vertex_count + block_size - 1) / block_size;
+        // Rows whose length is a power of two would map every row of a tile onto the same cache sets, so rows are padded by a cache line
+        stride = block_count * block_size + row_padding;
+        // Padding rows and columns stay infinitely distant, so they never shorten a path
+        distances.assign(stride * stride, unreachable_distance<Type>());
+        next_hops.assign(stride * stride, name_arena::invalid_id);
+    }
+
+
+    /**
+         * Calls `work(item)` for every item within [0, `count`), with items claimed in turn by up to `thread_count` threads
+         * @param count Number of independent tiles
+         * @param thread_count Maximum number of threads
+         * @param work Callable updating a single tile
+         */
+    template <class Callable>
+    static void run_tiles(size_t count, unsigned int thread_count, const Callable& work) {
+        auto worker_count = static_cast<unsigned int>(std::min<size_t>(thread_count, count));
+        std::atomic<size_t> next_item{0};
+        auto claim_tiles = [&]() {
+            for (size_t item = next_item++; item < count; item = next_item++) {
+                work(item);
+            }
+        };
+        std::vector<std::thread> workers;
+        for (unsigned int t = 1; t < worker_count; t++) {
+            workers.emplace_back(claim_tiles);
+        }
+        claim_tiles();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+
+    /**
+         * Shortens the paths of the tile at (`row_block`, `column_block`) through every vertex of the tile row `pivot_block`
+         * @param row_block Tile row of the updated tile
+         * @param column_block Tile column of the updated tile
+         * @param pivot_block Tile row (and column) of the verticies paths are shortened through
+         */
+    void relax_tile(size_t row_block, size_t column_block, size_t pivot_block) {
+        size_t first_row = row_block * block_size;
+        size_t first_column = column_block * block_size;
+        size_t first_pivot = pivot_block * block_size;
+        for (size_t pivot = first_pivot; pivot < first_pivot + block_size; pivot++) {
+            const Type* pivot_row = distances.data() + pivot * stride + first_column;
+            for (size_t row = first_row; row < first_row + block_size; row++) {
+                Type through = distances[row * stride + pivot];
+                // No path through the pivot vertex is shorter than a path from it, so its own row is left unchanged
+                if (row == pivot || through == unreachable_distance<Type>()) {
+                    continue;
+                }
+                relax_row(distances.data() + row * stride + first_column, next_hops.data() + row * stride + first_column, pivot_row,
+                    through, next_hops[row * stride + pivot]);
+            }
+        }
+    }
+
+    /**
+         * Shortens the distances of a row segment of `block_size` entries through the pivot vertex, selecting rather than branching
+         * on each entry so that both loops run on vector registers (the next hops are selected by a separate loop comparing the
+         * shortened distances against a copy of the previous ones, as a single loop selecting both is not vectorized)
+         * @param row_distances First distance of the segment to be shortened
+         * @param row_hops First next hop of the segment to be shortened
+         * @param pivot_row First distance of the matching segment of the row of the pivot vertex (which never overlaps `row_distances`)
+         * @param through Distance from the vertex of the row to the pivot vertex
+         * @param hop Next hop from the vertex of the row towards the pivot vertex
+         */
+    TABLE_KERNEL_CLONES static void relax_row(Type* TABLE_RESTRICT row_distances, unsigned int* TABLE_RESTRICT row_hops, const Type* TABLE_RESTRICT pivot_row,
+        Type through, unsigned int hop) {
+        Type previous[block_size];
+        for (size_t column = 0; column < block_size; column++) {
+            previous[column] = row_distances[column];
+            Type candidate = through + pivot_row[column];
+            row_distances[column] = candidate < previous[column] ? candidate : previous[column];
+        }
+        for (size_t column = 0; column < block_size; column++) {
+            row_hops[column] = row_distances[column] < previous[column] ? hop : row_hops[column];
+        }
+    }
+
+    /// @brief Shortest distance between every pair of verticies, with rows of `stride` entries indexed by source vertex ID
+    std::pmr::vector<Type> distances;
+    /// @brief Vertex following the source vertex on every shortest path, laid out as `distances`
+    std::pmr::vector<unsigned int> next_hops;
+    /// @brief Number of verticies of the graph the table was built from
+    unsigned int vertex_count;
+    /// @brief Number of entries of each row (`vertex_count` rounded up to a multiple of `block_size`, plus `row_padding`)
+    size_t stride;
+    /// @brief Fingerprint of the graph the table was built from (see `indexed_graph::get_fingerprint`)
+    std::uint64_t graph_fingerprint;
+};
+
+
+/**
+ * Answers a shortest path query from `table` by following next hops from the source vertex to the destination vertex
+ * @tparam Type typename of the edge weights of the searched graph
+ * @param table All-pairs table built from the searched graph
+ * @param source_id ID of the source vertex
+ * @param destination_id ID of the destination vertex
+ * @param distances Filled with the distance from the source vertex to each vertex on the shortest path (infinity for all other
+ * verticies), indexed by vertex ID
+ * @param vertex_path Filled with the ID of the vertex preceding each vertex on the shortest path (`name_arena::invalid_id` for the
+ * source vertex and all other verticies), indexed by vertex ID
+ * @return Distance to the destination vertex and the number of verticies on the shortest path (no vertex is settled by a search)
+ */
+template <class Type>
+path_search_result<Type> all_pairs_search(const all_pairs_table<Type>& table, unsigned int source_id, unsigned int destination_id,
+    std::pmr::vector<Type>& distances, std::pmr::vector<unsigned int>& vertex_path) {
+    distances.assign(table.get_vertex_count(), unreachable_distance<Type>());
+    vertex_path.assign(table.get_vertex_count(), name_arena::invalid_id);
+    path_search_result<Type> result{table.get_distance(source_id, destination_id), 0};
+    if (result.distance == unreachable_distance<Type>()) {
+        return result;
+    }
+    unsigned int vertex = source_id;
+    distances[vertex] = 0;
+    result.settled_count = 1;
+    while (vertex != destination_id) {
+        unsigned int following_vertex = table.get_next_hop(vertex, destination_id);
+        vertex_path[following_vertex] = vertex;
+        distances[following_vertex] = table.get_distance(source_id, following_vertex);
+        vertex = following_vertex;
+        result.settled_count++;
+    }
+    return result;
+}
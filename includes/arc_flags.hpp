@@ -0,0 +1,397 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "indexed_graph.hpp"
+#include "graph_partition.hpp"
+#include "path_search.hpp"
+#include "pair_minheap.hpp"
+
+
+/**
+ * Regions of a partition of a graph along with a flag for every edge and region, set if the edge begins a shortest path to
+ * some vertex of the region (arc-flags preprocessing), so that a search towards a destination vertex only relaxes the edges
+ * flagged for the region of the destination vertex
+ * @tparam Type typename of the edge weights of the graph
+ *
+ * Edges between verticies of the same region are flagged for that region. Every other shortest path into a region enters it
+ * through a boundary vertex (a vertex of the region with a neighbor outside of it), so the remaining flags of a region are set
+ * on every edge lying on a shortest path to one of its boundary verticies, found by a complete Dijkstra search from each
+ * boundary vertex. These searches are independent and are claimed in turn by several threads
+ *
+ * @note Flags are stored as a single bitset of `region_count` consecutive bits per edge, numbered in order of the source vertex
+ * ID and then of the position of the edge within `indexed_graph::get_adjacent`
+ * @note Flags are only valid for the graph they were built from, which is identified by a fingerprint of its verticies and edges
+ * when flags are saved to and loaded from files
+ */
+template <class Type>
+class arc_flag_table final {
+public:
+    /// @brief Number of regions the graph is divided into by `build` if no region count is provided
+    static constexpr unsigned int default_region_count = 32;
+    /// @brief Extension appended to the name of a graph text file to form the name of its arc-flag file
+    static constexpr const char* file_extension = ".arc";
+
+    // Constructor creates an empty table (without any flagged edge), allocating all storage from `resource`
+    arc_flag_table(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): regions{resource},
+        edge_offsets{resource}, flags{resource}, vertex_count(0), region_count(0), graph_fingerprint(0), boundary_count(0) {}
+
+
+    /**
+         * Divides `graph` into up to `requested_regions` regions (see `partition_graph`) and flags every edge for the regions it
+         * begins a shortest path to
+         * @param graph Graph whose edges are stored in both directions with equal weights (as done by `build_adjacency_list`)
+         * @param requested_regions Number of regions (limited to the number of verticies in `graph`)
+         * @param thread_count Number of threads searching from boundary verticies (0 uses one thread per hardware thread)
+         * @throws `std::runtime_error` if `requested_regions` is 0 or if an edge of `graph` is not matched by an edge of equal weight
+         * in the opposite direction
+         */
+    void build(const indexed_graph<Type>& graph, unsigned int requested_regions = default_region_count, unsigned int thread_count = 0) {
+        if (!graph.is_symmetric()) {
+            throw std::runtime_error("ERROR: Arc-flags can only be computed for graphs whose edges are stored in both directions!");
+        }
+        if (requested_regions == 0) {
+            throw std::runtime_error("ERROR: Arc-flags require at least one region!");
+        }
+        vertex_count = graph.get_vertex_count();
+        graph_fingerprint = graph.get_fingerprint();
+        partition_graph(graph, requested_regions, regions);
+        region_count = std::min(requested_regions, std::max(vertex_count, 1U));
+        set_edge_offsets(graph);
+        size_t edge_total = edge_offsets.back();
+        flags.assign((edge_total * region_count + 63) / 64, 0);
+        if (thread_count == 0) {
+            thread_count = std::max(1U, std::thread::hardware_concurrency());
+        }
+
+        std::pmr::vector<unsigned int> boundary(flags.get_allocator().resource());
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            bool is_boundary = false;
+            auto adjacent = graph.get_adjacent(vertex);
+            for (size_t position = 0; position < adjacent.size(); position++) {
+                if (regions[adjacent[position].target] == regions[vertex]) {
+                    set_flag(edge_offsets[vertex] + position, regions[vertex]);
+                } else {
+                    is_boundary = true;
+                }
+            }
+            if (is_boundary) {
+                boundary.push_back(vertex);
+            }
+        }
+        boundary_count = static_cast<unsigned int>(boundary.size());
+
+        // Threads set flags within shared words, so flags are gathered within atomic words and copied once every search is done
+        std::vector<std::atomic<std::uint64_t>> shared_flags(flags.size());
+        for (size_t word = 0; word < flags.size(); word++) {
+            shared_flags[word].store(flags[word], std::memory_order_relaxed);
+        }
+        auto worker_count = static_cast<unsigned int>(std::min<size_t>(thread_count, boundary.size()));
+        std::atomic<size_t> next_boundary{0};
+        auto claim_boundaries = [&]() {
+            std::pmr::vector<Type> distances;
+            std::pmr::vector<unsigned int> vertex_path;
+            for (size_t b = next_boundary++; b < boundary.size(); b = next_boundary++) {
+                flag_paths_to(graph, boundary[b], distances, vertex_path, shared_flags);
+            }
+        };
+        std::vector<std::thread> workers;
+        for (unsigned int t = 1; t < worker_count; t++) {
+            workers.emplace_back(claim_boundaries);
+        }
+        claim_boundaries();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (size_t word = 0; word < flags.size(); word++) {
+            flags[word] = shared_flags[word].load(std::memory_order_relaxed);
+        }
+    }
+
+
+    /**
+         * Retrieves the region of the vertex with ID `vertex`
+         * @param vertex ID of the vertex
+         * @return Region of the vertex (within [0, `get_region_count()`))
+         */
+    unsigned int get_region(unsigned int vertex) const {
+        return regions[vertex];
+    }
+
+
+    /**
+         * Determines whether the edge at `position` within the edges leaving `vertex` begins a shortest path to some vertex of `region`
+         * @param vertex ID of the vertex the edge leaves
+         * @param position Position of the edge within `indexed_graph::get_adjacent(vertex)`
+         * @param region Region of the destination
+         * @return `true` if the edge is flagged for `region`, else `false`
+         */
+    bool is_flagged(unsigned int vertex, size_t position, unsigned int region) const {
+        size_t bit = (edge_offsets[vertex] + position) * region_count + region;
+        return (flags[bit / 64] >> (bit % 64) & 1U) != 0;
+    }
+
+
+    /**
+         * Retrieves the number of regions the graph was divided into
+         * @return Number of regions (0 before `build` is called)
+         */
+    unsigned int get_region_count() const {
+        return region_count;
+    }
+
+
+    /**
+         * Retrieves the number of boundary verticies searched from by the last call to `build`
+         * @return Number of verticies with a neighbor in another region (0 once flags are loaded from a file)
+         */
+    unsigned int get_boundary_count() const {
+        return boundary_count;
+    }
+
+
+    /**
+         * Retrieves the number of verticies of the graph the calling `arc_flag_table` was built from
+         * @return Number of verticies covered by the regions
+         */
+    unsigned int get_vertex_count() const {
+        return vertex_count;
+    }
+
+
+    /**
+         * Retrieves the number of bytes occupied by the flags of every edge
+         * @return Size of the flag bitset in bytes
+         */
+    size_t get_flag_bytes() const {
+        return flags.size() * sizeof(std::uint64_t);
+    }
+
+
+    /**
+         * Determines whether the calling `arc_flag_table` was built from a graph identical to `graph`
+         * @param graph Graph to be compared against
+         * @return `true` if the number of verticies and the fingerprint of `graph` match, else `false`
+         */
+    bool matches(const indexed_graph<Type>& graph) const {
+        return vertex_count == graph.get_vertex_count() && graph_fingerprint == graph.get_fingerprint();
+    }
+
+
+    /**
+         * Writes the regions and the flag bitset to the binary file `filename`
+         * @param filename Relative path to the file to be written
+         * @return 0 if successful, -1 upon failure
+         */
+    int save(const std::string& filename) const {
+        std::ofstream write_file(filename, std::ios::binary | std::ios::trunc);
+        if (!write_file.is_open()) {
+            std::cerr << "ERROR: Could not open file '" << filename << "' for writing arc-flags!" << '\n';
+            return -1;
+        }
+        std::uint64_t edge_total = edge_offsets.empty() ? 0 : edge_offsets.back();
+        write_file.write(file_tag, sizeof(file_tag));
+        write_file.write(reinterpret_cast<const char*>(&vertex_count), sizeof(vertex_count));
+        write_file.write(reinterpret_cast<const char*>(&region_count), sizeof(region_count));
+        write_file.write(reinterpret_cast<const char*>(&edge_total), sizeof(edge_total));
+        write_file.write(reinterpret_cast<const char*>(&graph_fingerprint), sizeof(graph_fingerprint));
+        write_file.write(reinterpret_cast<const char*>(regions.data()), static_cast<std::streamsize>(regions.size() * sizeof(unsigned int)));
+        write_file.write(reinterpret_cast<const char*>(flags.data()), static_cast<std::streamsize>(flags.size() * sizeof(std::uint64_t)));
+        if (!write_file.good()) {
+            std::cerr << "ERROR: An error was encountered while writing arc-flags to '" << filename << "'!" << '\n';
+            return -1;
+        }
+        return 0;
+    }
+
+
+    /**
+         * Replaces the contents of the calling `arc_flag_table` with the regions and flags stored in the binary file `filename`,
+         * if they were built from a graph identical to `graph`
+         * @param filename Relative path to the file written by `save`
+         * @param graph Graph the loaded flags will be used with
+         * @return 0 if successful, -1 if the file does not exist, cannot be read or was built from a different graph
+         * (the calling `arc_flag_table` is left unchanged)
+         */
+    int load(const std::string& filename, const indexed_graph<Type>& graph) {
+        std::ifstream read_file(filename, std::ios::binary);
+        if (!read_file.is_open()) {
+            return -1;
+        }
+        char tag[sizeof(file_tag)] = {};
+        unsigned int file_vertex_count = 0;
+        unsigned int file_region_count = 0;
+        std::uint64_t edge_total = 0;
+        std::uint64_t file_fingerprint = 0;
+        read_file.read(tag, sizeof(tag));
+        read_file.read(reinterpret_cast<char*>(&file_vertex_count), sizeof(file_vertex_count));
+        read_file.read(reinterpret_cast<char*>(&file_region_count), sizeof(file_region_count));
+        read_file.read(reinterpret_cast<char*>(&edge_total), sizeof(edge_total));
+        read_file.read(reinterpret_cast<char*>(&file_fingerprint), sizeof(file_fingerprint));
+        if (!read_file.good() || std::memcmp(tag, file_tag, sizeof(file_tag)) != 0 || file_vertex_count != graph.get_vertex_count() ||
+            edge_total != graph.get_edge_count() || file_region_count > std::max(file_vertex_count, 1U) || file_fingerprint != graph.get_fingerprint()) {
+            return -1;
+        }
+        std::pmr::vector<unsigned int> file_regions(file_vertex_count, 0, regions.get_allocator());
+        std::pmr::vector<std::uint64_t> file_flags((edge_total * file_region_count + 63) / 64, 0, flags.get_allocator());
+        read_file.read(reinterpret_cast<char*>(file_regions.data()), static_cast<std::streamsize>(file_regions.size() * sizeof(unsigned int)));
+        read_file.read(reinterpret_cast<char*>(file_flags.data()), static_cast<std::streamsize>(file_flags.size() * sizeof(std::uint64_t)));
+        if (!read_file.good()) {
+            return -1;
+        }
+        for (unsigned int region : file_regions) {
+            if (region >= file_region_count) {
+                return -1;
+            }
+        }
+        regions = std::move(file_regions);
+        flags = std::move(file_flags);
+        vertex_count = file_vertex_count;
+        region_count = file_region_count;
+        graph_fingerprint = file_fingerprint;
+        boundary_count = 0;
+        set_edge_offsets(graph);
+        return 0;
+    }
+
+
+private:
+    /**
+         * Numbers the edges of `graph` in order of the source vertex ID and then of their position among the edges of the vertex
+         * @param graph Graph the flags belong to
+         */
+    void set_edge_offsets(const indexed_graph<Type>& graph) {
+        edge_offsets.assign(vertex_count + 1, 0);
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            edge_offsets[vertex + 1] = edge_offsets[vertex] + graph.get_adjacent(vertex).size();
+        }
+    }
+
+    /**
+         * Sets the flag of the edge numbered `edge_index` for `region`
+         * @param edge_index Number of the edge (see `set_edge_offsets`)
+         * @param region Region the edge is flagged for
+         */
+    void set_flag(size_t edge_index, unsigned int region) {
+        size_t bit = edge_index * region_count + region;
+        flags[bit / 64] |= std::uint64_t{1} << (bit % 64);
+    }
+
+    /**
+         * Flags every edge lying on a shortest path to `boundary_vertex` for the region of `boundary_vertex`, found by a complete
+         * search from it (edges are stored in both directions, so the search from the boundary vertex also finds the paths to it)
+         * @param graph Graph the flags belong to
+         * @param boundary_vertex ID of the boundary vertex
+         * @param distances Scratch array of the calling thread
+         * @param vertex_path Scratch array of the calling thread
+         * @param shared_flags Flag bitset shared by every thread
+         */
+    void flag_paths_to(const indexed_graph<Type>& graph, unsigned int boundary_vertex, std::pmr::vector<Type>& distances,
+        std::pmr::vector<unsigned int>& vertex_path, std::vector<std::atomic<std::uint64_t>>& shared_flags) const {
+        shortest_path_tree(graph, boundary_vertex, distances, vertex_path);
+        unsigned int region = regions[boundary_vertex];
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            if (distances[vertex] == unreachable_distance<Type>()) {
+                continue;
+            }
+            auto adjacent = graph.get_adjacent(vertex);
+            for (size_t position = 0; position < adjacent.size(); position++) {
+                // Every edge whose weight spans the difference between the distances of its verticies begins a shortest path
+                if (adjacent[position].weight + distances[adjacent[position].target] != distances[vertex]) {
+                    continue;
+                }
+                size_t bit = (edge_offsets[vertex] + position) * region_count + region;
+                std::uint64_t mask = std::uint64_t{1} << (bit % 64);
+                if ((shared_flags[bit / 64].load(std::memory_order_relaxed) & mask) == 0) {
+                    shared_flags[bit / 64].fetch_or(mask, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    /// @brief Tag identifying arc-flag files (and their format version)
+    static constexpr char file_tag[8] = {'G', 'R', 'P', 'H', 'A', 'R', 'C', '1'};
+    /// @brief Region of each vertex, indexed by vertex ID
+    std::pmr::vector<unsigned int> regions;
+    /// @brief Number of the first edge leaving each vertex (followed by the total number of edges), indexed by vertex ID
+    std::pmr::vector<size_t> edge_offsets;
+    /// @brief Bitset of `region_count` flags per edge, in order of edge number
+    std::pmr::vector<std::uint64_t> flags;
+    /// @brief Number of verticies of the graph the flags were built from
+    unsigned int vertex_count;
+    /// @brief Number of regions the graph was divided into
+    unsigned int region_count;
+    /// @brief Fingerprint of the graph the flags were built from
+    std::uint64_t graph_fingerprint;
+    /// @brief Number of boundary verticies searched from by the last call to `build`
+    unsigned int boundary_count;
+};
+
+
+/**
+ * Finds the shortest path between `source_id` and `destination_id` with a Dijkstra search that only relaxes the edges flagged
+ * for the region of the destination vertex, so edges leading away from the destination vertex are never followed
+ * @tparam Type typename of the edge weights of the searched graph
+ * @param graph Graph to be searched
+ * @param source_id ID of the source vertex
+ * @param destination_id ID of the destination vertex
+ * @param arc_flags Arc-flags built from `graph`
+ * @param distances Filled with the shortest known distance from the source vertex to each vertex (see `forward_search`)
+ * @param vertex_path Filled with the ID of the vertex preceding each reached vertex on its shortest path (see `forward_search`)
+ * @return Distance to the destination vertex and the number of settled verticies
+ */
+template <class Type>
+path_search_result<Type> arc_flag_search(const indexed_graph<Type>& graph, unsigned int source_id, unsigned int destination_id,
+    const arc_flag_table<Type>& arc_flags, std::pmr::vector<Type>& distances, std::pmr::vector<unsigned int>& vertex_path) {
+    auto vertex_count = graph.get_vertex_count();
+    std::pmr::memory_resource* scratch = distances.get_allocator().resource();
+    distances.assign(vertex_count, unreachable_distance<Type>());
+    vertex_path.assign(vertex_count, name_arena::invalid_id);
+    std::pmr::vector<bool> settled(vertex_count, false, scratch);
+    auto mhp = paired_min_heap<Type, unsigned int>(vertex_count, scratch);
+    unsigned int destination_region = arc_flags.get_region(destination_id);
+
+    path_search_result<Type> result{unreachable_distance<Type>(), 0};
+    distances[source_id] = 0;
+    mhp.add_node(source_id, 0);
+    unsigned int popped_vertex = 0;
+    Type popped_vertex_distance = 0;
+    while (!mhp.is_empty()) {
+        std::tie(popped_vertex, popped_vertex_distance) = mhp.remove_min();
+        if (settled[popped_vertex]) {
+            continue;
+        }
+        settled[popped_vertex] = true;
+        result.settled_count++;
+        if (popped_vertex == destination_id) {
+            break;
+        }
+        auto adjacent = graph.get_adjacent(popped_vertex);
+        for (size_t position = 0; position < adjacent.size(); position++) {
+            const auto& adjacent_edge = adjacent[position];
+            if (!arc_flags.is_flagged(popped_vertex, position, destination_region)) {
+                continue;
+            }
+            Type di = adjacent_edge.weight + popped_vertex_distance;
+            if (!settled[adjacent_edge.target] && di < distances[adjacent_edge.target]) {
+                distances[adjacent_edge.target] = di;
+                vertex_path[adjacent_edge.target] = popped_vertex;
+                mhp.add_node(adjacent_edge.target, di);
+            }
+        }
+    }
+    gprintf("Arc-flag search settled %u verticies", result.settled_count);
+    result.distance = distances[destination_id];
+    return result;
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "indexed_graph.hpp"
+
+
+/// @brief A top-down step switches to bottom-up once the edges leaving the frontier exceed the unexplored edges divided by this factor
+inline constexpr unsigned long breadth_first_bottom_up_factor = 14;
+/// @brief A bottom-up step switches back to top-down once the frontier holds fewer verticies than the graph divided by this factor
+inline constexpr unsigned int breadth_first_top_down_factor = 24;
+
+
+/**
+ * Determines whether the shortest paths of `graph` are found by `breadth_first_tree` instead of a heap-based search
+ * @tparam Type typename of the edge weights of the graph
+ * @param graph Graph to be searched
+ * @return `true` if every edge has the same positive weight and is paired with its reverse edge, else `false`
+ */
+template <class Type>
+bool suits_breadth_first(const indexed_graph<Type>& graph) {
+    return graph.has_uniform_weights() && graph.get_min_weight() > Type{} && graph.is_symmetric();
+}
+
+
+/**
+ * Finds the shortest paths from `source_id` to the verticies of a graph whose edges all have the same weight, which are the
+ * paths with the fewest edges, with a direction-optimizing breadth-first search: each level is expanded top-down from the
+ * edges of the frontier while the frontier is small, and bottom-up (every unreached vertex looks for an edge from the frontier,
+ * held as a bitmap, stopping at the first one found) while the edges of the frontier outnumber those left unexplored
+ * @tparam Type typename of the edge weights of the searched graph
+ * @param graph Graph to be searched, for which `suits_breadth_first` holds (the edges leaving a vertex must also reach it)
+ * @param source_id ID of the source vertex
+ * @param distances Filled with the shortest distance from the source vertex to each reached vertex (infinity for all other
+ * verticies), indexed by vertex ID
+ * @param vertex_path Filled with the ID of the vertex preceding each reached vertex on its shortest path (see `forward_search`)
+ * @param destination_id ID of a vertex after whose level the search stops (`name_arena::invalid_id` reaches every vertex)
+ * @return Number of reached verticies
+ * @note Distances are summed one edge at a time and predecessors are chosen by the rule of `shortest_path_tree` once all levels
+ * are known, so every reached vertex has the same distance and predecessor as in the tree of `shortest_path_tree`
+ * @note All storage is allocated from the memory resource of `distances`
+ */
+template <class Type>
+unsigned int breadth_first_tree(const indexed_graph<Type>& graph, unsigned int source_id, std::pmr::vector<Type>& distances,
+    std::pmr::vector<unsigned int>& vertex_path, unsigned int destination_id = name_arena::invalid_id) {
+    constexpr unsigned int unreached = std::numeric_limits<unsigned int>::max();
+    auto vertex_count = graph.get_vertex_count();
+    auto* resource = distances.get_allocator().resource();
+    distances.assign(vertex_count, unreachable_distance<Type>());
+    vertex_path.assign(vertex_count, name_arena::invalid_id);
+    if (vertex_count == 0) {
+        return 0;
+    }
+    std::pmr::vector<unsigned int> levels(vertex_count, unreached, resource);
+    std::pmr::vector<unsigned int> frontier(resource);
+    std::pmr::vector<unsigned int> next_frontier(resource);
+    std::pmr::vector<std::uint64_t> frontier_bits((vertex_count + 63) / 64, 0, resource);
+    // Distance of each level, summed in the same order as a heap-based search adds an edge weight to a settled distance
+    std::pmr::vector<Type> level_distances(1, Type{}, resource);
+    Type weight = graph.get_min_weight();
+
+    levels[source_id] = 0;
+    frontier.push_back(source_id);
+    unsigned int reached_count = 1;
+    unsigned long unexplored_edges = graph.get_edge_count() - graph.get_adjacent(source_id).size();
+    bool bottom_up = false;
+    for (unsigned int level = 0; !frontier.empty(); level++) {
+        if (destination_id != name_arena::invalid_id && levels[destination_id] != unreached) {
+            break;
+        }
+        if (bottom_up) {
+            bottom_up = frontier.size() >= vertex_count / breadth_first_top_down_factor;
+        } else {
+            unsigned long frontier_edges = 0;
+            for (unsigned int vertex : frontier) {
+                frontier_edges += graph.get_adjacent(vertex).size();
+            }
+            bottom_up = frontier_edges > unexplored_edges / breadth_first_bottom_up_factor;
+        }
+
+        next_frontier.clear();
+        if (bottom_up) {
+            std::fill(frontier_bits.begin(), frontier_bits.end(), std::uint64_t(0));
+            for (unsigned int vertex : frontier) {
+                frontier_bits[vertex / 64] |= std::uint64_t(1) << (vertex % 64);
+            }
+            for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+                if (levels[vertex] != unreached) {
+                    continue;
+                }
+                // Edges are paired with their reverse edges, so the edges leaving an unreached vertex are also those reaching it
+                for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                    if ((frontier_bits[adjacent_edge.target / 64] >> (adjacent_edge.target % 64)) & 1) {
+                        levels[vertex] = level + 1;
+                        next_frontier.push_back(vertex);
+                        break;
+                    }
+                }
+            }
+        } else {
+            for (unsigned int vertex : frontier) {
+                for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                    if (levels[adjacent_edge.target] == unreached) {
+                        levels[adjacent_edge.target] = level + 1;
+                        next_frontier.push_back(adjacent_edge.target);
+                    }
+                }
+            }
+        }
+        for (unsigned int vertex : next_frontier) {
+            unexplored_edges -= graph.get_adjacent(vertex).size();
+        }
+        reached_count += static_cast<unsigned int>(next_frontier.size());
+        level_distances.push_back(weight + level_distances.back());
+        std::swap(frontier, next_frontier);
+    }
+
+    // Predecessors are chosen once all levels are known: every candidate on the previous level is equally distant, so the lowest ID
+    for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+        if (levels[vertex] == unreached) {
+            continue;
+        }
+        distances[vertex] = level_distances[levels[vertex]];
+        if (vertex == source_id) {
+            continue;
+        }
+        unsigned int& predecessor = vertex_path[vertex];
+        for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+            if (levels[adjacent_edge.target] + 1 == levels[vertex] && adjacent_edge.target < predecessor) {
+                predecessor = adjacent_edge.target;
+            }
+        }
+    }
+    return reached_count;
+}
@@ -0,0 +1,626 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "indexed_graph.hpp"
+#include "path_search.hpp"
+#include "pair_minheap.hpp"
+
+
+/**
+ * Contraction Hierarchy of a graph, holding a total order of its verticies by importance and the upward edges (original edges
+ * and shortcuts) leading from each vertex to verticies of higher rank, so shortest paths can be found by two small upward-only
+ * searches (see `hierarchy_search`)
+ * @tparam Type typename of the edge weights of the graph
+ *
+ * Verticies are contracted in order of increasing priority, being the edge difference (shortcuts needed minus edges removed)
+ * plus the number of already contracted neighbors. Contracting a vertex adds a shortcut between two of its neighbors unless a
+ * witness search finds a path between them that avoids the vertex and is no longer than the path through it
+ *
+ * @note Each shortcut records the vertex it bypasses, so shortcuts can be unpacked into the original verticies of a path
+ * @note Hierarchies are only valid for the graph they were built from, which is identified by its fingerprint when they are
+ * saved to and loaded from files
+ */
+template <class Type>
+class contraction_hierarchy final {
+public:
+    /// @brief Extension appended to the name of a graph text file to form the name of its hierarchy file
+    static constexpr const char* file_extension = ".ch";
+    /// @brief Maximum number of verticies settled by each witness search before a shortcut is added without proof it is needed
+    static constexpr unsigned int witness_settle_limit = 128;
+    /// @brief Maximum number of verticies settled by each witness search when only estimating the priority of a vertex
+    static constexpr unsigned int priority_settle_limit = 32;
+
+    /// @brief Upward edge towards a vertex of higher rank
+    struct arc {
+        /// @brief ID of the vertex the arc leads to
+        unsigned int target;
+        /// @brief ID of the vertex bypassed by a shortcut (`name_arena::invalid_id` for an original edge)
+        unsigned int middle;
+        /// @brief Weight of the original edge or length of the bypassed path
+        Type weight;
+    };
+
+    /// @brief Contiguous range of the upward arcs of a single vertex
+    class arc_range {
+    public:
+        arc_range(const arc* first, const arc* last): first_arc(first), last_arc(last) {}
+        const arc* begin() const { return first_arc; }
+        const arc* end() const { return last_arc; }
+        size_t size() const { return static_cast<size_t>(last_arc - first_arc); }
+        bool empty() const { return first_arc == last_arc; }
+    private:
+        const arc* first_arc;
+        const arc* last_arc;
+    };
+
+    // Constructor creates an empty hierarchy, allocating all storage from `resource`
+    contraction_hierarchy(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): ranks{resource},
+        arc_offsets{resource}, arcs{resource}, vertex_count(0), graph_fingerprint(0) {}
+
+
+    /**
+         * Contracts every vertex of `graph` in order of priority and stores the resulting upward arcs
+         * @param graph Graph whose edges are stored in both directions with equal weights (as done by `build_adjacency_list`)
+         * @param thread_count Number of threads computing the initial priorities of all verticies (0 uses one thread per
+         * hardware thread), while the contractions themselves are performed in order on the calling thread
+         */
+    void build(const indexed_graph<Type>& graph, unsigned int thread_count = 0) {
+        vertex_count = graph.get_vertex_count();
+        graph_fingerprint = graph.get_fingerprint();
+        std::pmr::unsynchronized_pool_resource build_pool;
+        // Edges between verticies that have not been contracted yet, stored for both endpoints
+        std::pmr::vector<std::pmr::vector<arc>> remaining(vertex_count, &build_pool);
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                if (adjacent_edge.target != vertex) {
+                    insert_or_lower(remaining[vertex], adjacent_edge.target, adjacent_edge.weight, name_arena::invalid_id);
+                    insert_or_lower(remaining[adjacent_edge.target], vertex, adjacent_edge.weight, name_arena::invalid_id);
+                }
+            }
+        }
+
+        // Simulated contractions only read `remaining`, so the initial priorities are computed by several threads at once
+        std::pmr::vector<int> priorities(vertex_count, 0, &build_pool);
+        std::pmr::vector<int> deleted_neighbors(vertex_count, 0, &build_pool);
+        if (thread_count == 0) {
+            thread_count = std::max(1U, std::thread::hardware_concurrency());
+        }
+        thread_count = std::max(1U, std::min(thread_count, vertex_count));
+        auto compute_priorities = [&](unsigned int first_vertex) {
+            std::pmr::unsynchronized_pool_resource thread_pool;
+            witness_scratch scratch(vertex_count, &thread_pool);
+            std::pmr::vector<shortcut> shortcuts(&thread_pool);
+            for (unsigned int vertex = first_vertex; vertex < vertex_count; vertex += thread_count) {
+                find_shortcuts(remaining, vertex, priority_settle_limit, scratch, shortcuts);
+                priorities[vertex] = static_cast<int>(shortcuts.size()) - static_cast<int>(remaining[vertex].size());
+            }
+        };
+        std::vector<std::thread> workers;
+        for (unsigned int t = 1; t < thread_count; t++) {
+            workers.emplace_back(compute_priorities, t);
+        }
+        compute_priorities(0);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        auto queue = paired_min_heap<int, unsigned int>(vertex_count, &build_pool);
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            queue.add_node(vertex, priorities[vertex]);
+        }
+        witness_scratch scratch(vertex_count, &build_pool);
+        std::pmr::vector<shortcut> shortcuts(&build_pool);
+        std::pmr::vector<std::pmr::vector<arc>> upward(vertex_count, &build_pool);
+        std::pmr::vector<unsigned int> vertex_ranks(vertex_count, name_arena::invalid_id, ranks.get_allocator());
+        unsigned int next_rank = 0;
+        unsigned int popped_vertex = 0;
+        int popped_priority = 0;
+        while (!queue.is_empty()) {
+            std::tie(popped_vertex, popped_priority) = queue.remove_min();
+            // Skip contracted verticies and outdated heap entries of verticies whose priority has since changed
+            if (vertex_ranks[popped_vertex] != name_arena::invalid_id || popped_priority != priorities[popped_vertex]) {
+                continue;
+            }
+            // Lazy update: shortcuts added elsewhere may have changed the priority, so defer the vertex if it is no longer minimal
+            find_shortcuts(remaining, popped_vertex, witness_settle_limit, scratch, shortcuts);
+            int current_priority = static_cast<int>(shortcuts.size()) - static_cast<int>(remaining[popped_vertex].size()) +
+                deleted_neighbors[popped_vertex];
+            if (current_priority > popped_priority && !queue.is_empty() && current_priority > queue.get_min().second) {
+                priorities[popped_vertex] = current_priority;
+                queue.add_node(popped_vertex, current_priority);
+                continue;
+            }
+
+            // Contract the vertex, so its remaining edges all lead to verticies of higher rank
+            vertex_ranks[popped_vertex] = next_rank++;
+            for (const auto& neighbor_arc : remaining[popped_vertex]) {
+                auto& neighbor_list = remaining[neighbor_arc.target];
+                neighbor_list.erase(std::find_if(neighbor_list.begin(), neighbor_list.end(),
+                    [popped_vertex](const arc& a) { return a.target == popped_vertex; }));
+                deleted_neighbors[neighbor_arc.target]++;
+            }
+            for (const auto& added : shortcuts) {
+                insert_or_lower(remaining[added.from], added.to, added.weight, popped_vertex);
+                insert_or_lower(remaining[added.to], added.from, added.weight, popped_vertex);
+            }
+            upward[popped_vertex] = std::move(remaining[popped_vertex]);
+            remaining[popped_vertex].clear();
+            for (const auto& neighbor_arc : upward[popped_vertex]) {
+                unsigned int neighbor = neighbor_arc.target;
+                find_shortcuts(remaining, neighbor, priority_settle_limit, scratch, shortcuts);
+                priorities[neighbor] = static_cast<int>(shortcuts.size()) - static_cast<int>(remaining[neighbor].size()) +
+                    deleted_neighbors[neighbor];
+                queue.add_node(neighbor, priorities[neighbor]);
+            }
+        }
+
+        // Pack the upward arcs of all verticies into a single contiguous array
+        ranks = std::move(vertex_ranks);
+        arc_offsets.assign(static_cast<size_t>(vertex_count) + 1, 0);
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            arc_offsets[vertex + 1] = arc_offsets[vertex] + static_cast<unsigned int>(upward[vertex].size());
+        }
+        arcs.clear();
+        arcs.reserve(arc_offsets[vertex_count]);
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            arcs.insert(arcs.end(), upward[vertex].begin(), upward[vertex].end());
+        }
+        gprintf("Contraction hierarchy holds %zu arcs (%u shortcuts)", arcs.size(), get_shortcut_count());
+    }
+
+
+    /**
+         * Retrieves the upward arcs of the vertex with matching `id`
+         * @param id ID of the vertex
+         * @return Range of arcs leading to verticies of higher rank
+         */
+    arc_range get_upward(unsigned int id) const {
+        return arc_range(arcs.data() + arc_offsets[id], arcs.data() + arc_offsets[id + 1]);
+    }
+
+
+    /**
+         * Retrieves the position of the vertex with matching `id` within the contraction order
+         * @param id ID of the vertex
+         * @return Rank of the vertex (0 for the first contracted vertex)
+         */
+    unsigned int get_rank(unsigned int id) const {
+        return ranks[id];
+    }
+
+
+    /**
+         * Locates the arc connecting `from` and `to`, which is stored with whichever of the two verticies has the lower rank
+         * @param from ID of one endpoint
+         * @param to ID of the other endpoint
+         * @return Pointer to the arc, or `nullptr` if no arc connects both verticies
+         */
+    const arc* find_arc(unsigned int from, unsigned int to) const {
+        unsigned int lower = ranks[from] < ranks[to] ? from : to;
+        unsigned int higher = lower == from ? to : from;
+        for (const auto& upward_arc : get_upward(lower)) {
+            if (upward_arc.target == higher) {
+                return &upward_arc;
+            }
+        }
+        return nullptr;
+    }
+
+
+    /**
+         * Appends the original verticies of the path represented by the arc between `from` and `to` (excluding `from`) to `vertices`
+         * @param from ID of the vertex the path starts from
+         * @param to ID of the vertex the path leads to, which must be connected to `from` by an arc
+         * @param vertices Array receiving the IDs of every vertex after `from` along the path, ending with `to`
+         */
+    void unpack_arc(unsigned int from, unsigned int to, std::pmr::vector<unsigned int>& vertices) const {
+        std::pmr::vector<std::pair<unsigned int, unsigned int>> pending(vertices.get_allocator().resource());
+        pending.emplace_back(from, to);
+        while (!pending.empty()) {
+            auto [first, last] = pending.back();
+            pending.pop_back();
+            unsigned int middle = find_arc(first, last)->middle;
+            if (middle == name_arena::invalid_id) {
+                vertices.push_back(last);
+            } else {
+                // The first half is pushed last so it is unpacked first
+                pending.emplace_back(middle, last);
+                pending.emplace_back(first, middle);
+            }
+        }
+    }
+
+
+    /**
+         * Retrieves the number of verticies of the graph the calling `contraction_hierarchy` was built from
+         * @return Number of ranked verticies
+         */
+    unsigned int get_vertex_count() const {
+        return vertex_count;
+    }
+
+
+    /**
+         * Retrieves the total number of upward arcs (original edges and shortcuts)
+         * @return Number of stored arcs
+         */
+    size_t get_arc_count() const {
+        return arcs.size();
+    }
+
+
+    /**
+         * Retrieves the number of stored arcs that are shortcuts
+         * @return Number of shortcuts
+         */
+    unsigned int get_shortcut_count() const {
+        return static_cast<unsigned int>(std::count_if(arcs.begin(), arcs.end(),
+            [](const arc& a) { return a.middle != name_arena::invalid_id; }));
+    }
+
+
+    /**
+         * Retrieves the fingerprint of the graph the calling `contraction_hierarchy` was built from
+         * @return Fingerprint computed by `indexed_graph::get_fingerprint`
+         */
+    std::uint64_t get_fingerprint() const {
+        return graph_fingerprint;
+    }
+
+
+    /**
+         * Determines whether the calling `contraction_hierarchy` was built from a graph identical to `graph`
+         * @param graph Graph to be compared against
+         * @return `true` if the number of verticies and the fingerprint of `graph` match, else `false`
+         */
+    bool matches(const indexed_graph<Type>& graph) const {
+        return vertex_count == graph.get_vertex_count() && graph_fingerprint == graph.get_fingerprint();
+    }
+
+
+    /**
+         * Writes the vertex ranks and upward arcs to the binary file `filename`
+         * @param filename Relative path to the file to be written
+         * @return 0 if successful, -1 upon failure
+         */
+    int save(const std::string& filename) const {
+        static_assert(std::is_trivially_copyable_v<Type>, "Contraction hierarchies can only be saved for trivially copyable weight types");
+        std::ofstream write_file(filename, std::ios::binary | std::ios::trunc);
+        if (!write_file.is_open()) {
+            std::cerr << "ERROR: Could not open file '" << filename << "' for writing the contraction hierarchy!" << '\n';
+            return -1;
+        }
+        std::uint32_t type_size = static_cast<std::uint32_t>(sizeof(Type));
+        std::uint32_t arc_count = static_cast<std::uint32_t>(arcs.size());
+        write_file.write(file_tag, sizeof(file_tag));
+        write_file.write(reinterpret_cast<const char*>(&type_size), sizeof(type_size));
+        write_file.write(reinterpret_cast<const char*>(&vertex_count), sizeof(vertex_count));
+        write_file.write(reinterpret_cast<const char*>(&arc_count), sizeof(arc_count));
+        write_file.write(reinterpret_cast<const char*>(&graph_fingerprint), sizeof(graph_fingerprint));
+        write_file.write(reinterpret_cast<const char*>(ranks.data()), static_cast<std::streamsize>(ranks.size() * sizeof(unsigned int)));
+        write_file.write(reinterpret_cast<const char*>(arc_offsets.data()), static_cast<std::streamsize>(arc_offsets.size() * sizeof(unsigned int)));
+        // Arc fields are written individually so no padding bytes reach the file
+        for (const auto& stored_arc : arcs) {
+            write_file.write(reinterpret_cast<const char*>(&stored_arc.target), sizeof(stored_arc.target));
+            write_file.write(reinterpret_cast<const char*>(&stored_arc.middle), sizeof(stored_arc.middle));
+            write_file.write(reinterpret_cast<const char*>(&stored_arc.weight), sizeof(stored_arc.weight));
+        }
+        if (!write_file.good()) {
+            std::cerr << "ERROR: An error was encountered while writing the contraction hierarchy to '" << filename << "'!" << '\n';
+            return -1;
+        }
+        return 0;
+    }
+
+
+    /**
+         * Replaces the contents of the calling `contraction_hierarchy` with the hierarchy stored in the binary file `filename`,
+         * if it was built from a graph identical to `graph`
+         * @param filename Relative path to the file written by `save`
+         * @param graph Graph the loaded hierarchy will be used with
+         * @return 0 if successful, -1 if the file does not exist, cannot be read or was built from a different graph
+         * (the calling `contraction_hierarchy` is left unchanged)
+         */
+    int load(const std::string& filename, const indexed_graph<Type>& graph) {
+        std::ifstream read_file(filename, std::ios::binary);
+        if (!read_file.is_open()) {
+            return -1;
+        }
+        char tag[sizeof(file_tag)] = {};
+        std::uint32_t type_size = 0;
+        unsigned int file_vertex_count = 0;
+        std::uint32_t arc_count = 0;
+        std::uint64_t file_fingerprint = 0;
+        read_file.read(tag, sizeof(tag));
+        read_file.read(reinterpret_cast<char*>(&type_size), sizeof(type_size));
+        read_file.read(reinterpret_cast<char*>(&file_vertex_count), sizeof(file_vertex_count));
+        read_file.read(reinterpret_cast<char*>(&arc_count), sizeof(arc_count));
+        read_file.read(reinterpret_cast<char*>(&file_fingerprint), sizeof(file_fingerprint));
+        if (!read_file.good() || std::memcmp(tag, file_tag, sizeof(file_tag)) != 0 || type_size != sizeof(Type) ||
+            file_vertex_count != graph.get_vertex_count() || file_fingerprint != graph.get_fingerprint()) {
+            return -1;
+        }
+        std::pmr::vector<unsigned int> file_ranks(file_vertex_count, 0, ranks.get_allocator());
+        std::pmr::vector<unsigned int> file_offsets(static_cast<size_t>(file_vertex_count) + 1, 0, arc_offsets.get_allocator());
+        std::pmr::vector<arc> file_arcs(arc_count, arc{0, 0, Type{}}, arcs.get_allocator());
+        read_file.read(reinterpret_cast<char*>(file_ranks.data()), static_cast<std::streamsize>(file_ranks.size() * sizeof(unsigned int)));
+        read_file.read(reinterpret_cast<char*>(file_offsets.data()), static_cast<std::streamsize>(file_offsets.size() * sizeof(unsigned int)));
+        for (auto& stored_arc : file_arcs) {
+            read_file.read(reinterpret_cast<char*>(&stored_arc.target), sizeof(stored_arc.target));
+            read_file.read(reinterpret_cast<char*>(&stored_arc.middle), sizeof(stored_arc.middle));
+            read_file.read(reinterpret_cast<char*>(&stored_arc.weight), sizeof(stored_arc.weight));
+        }
+        if (!read_file.good() || file_offsets[0] != 0 || file_offsets[file_vertex_count] != arc_count) {
+            return -1;
+        }
+        // Reject files whose ranks, offsets or arcs would lead outside of the stored arrays
+        for (unsigned int vertex = 0; vertex < file_vertex_count; vertex++) {
+            if (file_ranks[vertex] >= file_vertex_count || file_offsets[vertex] > file_offsets[vertex + 1]) {
+                return -1;
+            }
+        }
+        for (const auto& stored_arc : file_arcs) {
+            if (stored_arc.target >= file_vertex_count || (stored_arc.middle != name_arena::invalid_id && stored_arc.middle >= file_vertex_count)) {
+                return -1;
+            }
+        }
+        ranks = std::move(file_ranks);
+        arc_offsets = std::move(file_offsets);
+        arcs = std::move(file_arcs);
+        vertex_count = file_vertex_count;
+        graph_fingerprint = file_fingerprint;
+        return 0;
+    }
+
+private:
+    /// @brief Shortcut required between two neighbors of a vertex being contracted
+    struct shortcut {
+        unsigned int from;
+        unsigned int to;
+        Type weight;
+    };
+
+    /// @brief Storage reused across witness searches (each thread holds its own)
+    struct witness_scratch {
+        witness_scratch(unsigned int count, std::pmr::memory_resource* resource): distances(count, unreachable_distance<Type>(), resource),
+            is_target(count, false, resource), touched{resource}, heap(16, resource) {}
+        /// @brief Distance from the witness search source to each vertex, reset to infinity after every search
+        std::pmr::vector<Type> distances;
+        /// @brief Marks the neighbors whose distance from the source is needed by the current search
+        std::pmr::vector<bool> is_target;
+        /// @brief IDs of every vertex whose entry in `distances` was written by the current search
+        std::pmr::vector<unsigned int> touched;
+        paired_min_heap<Type, unsigned int> heap;
+    };
+
+
+    /**
+         * Lowers the weight of the arc from the owner of `list` to `target` (replacing its middle vertex), or appends a new arc
+         * if none exists
+         * @param list Arcs of a single vertex
+         * @param target ID of the vertex the arc leads to
+         * @param weight Weight of the new arc
+         * @param middle ID of the bypassed vertex (`name_arena::invalid_id` for an original edge)
+         */
+    static void insert_or_lower(std::pmr::vector<arc>& list, unsigned int target, Type weight, unsigned int middle) {
+        for (auto& existing : list) {
+            if (existing.target == target) {
+                if (weight < existing.weight) {
+                    existing.weight = weight;
+                    existing.middle = middle;
+                }
+                return;
+            }
+        }
+        list.push_back(arc{target, middle, weight});
+    }
+
+
+    /**
+         * Runs a Dijkstra search from `source` over the uncontracted verticies other than `excluded`, stopped once every vertex
+         * marked within `scratch.is_target` has been settled, the next extracted distance exceeds `limit` or `settle_limit`
+         * verticies have been settled
+         * @param remaining Edges between uncontracted verticies
+         * @param source ID of the vertex the search starts from
+         * @param excluded ID of the vertex being contracted
+         * @param limit Longest path length of interest
+         * @param target_count Number of verticies marked within `scratch.is_target`
+         * @param settle_limit Maximum number of verticies to be settled
+         * @param scratch Storage receiving the found distances
+         */
+    static void witness_search(const std::pmr::vector<std::pmr::vector<arc>>& remaining, unsigned int source, unsigned int excluded,
+        Type limit, size_t target_count, unsigned int settle_limit, witness_scratch& scratch) {
+        scratch.distances[source] = 0;
+        scratch.touched.push_back(source);
+        scratch.heap.add_node(source, 0);
+        unsigned int settled_count = 0;
+        unsigned int popped_vertex = 0;
+        Type popped_vertex_distance = 0;
+        while (!scratch.heap.is_empty()) {
+            std::tie(popped_vertex, popped_vertex_distance) = scratch.heap.remove_min();
+            if (popped_vertex_distance > scratch.distances[popped_vertex]) {
+                continue;
+            }
+            if (popped_vertex_distance > limit || ++settled_count > settle_limit) {
+                break;
+            }
+            // Distances of settled targets are final, so the search ends once no target remains unsettled
+            if (scratch.is_target[popped_vertex] && --target_count == 0) {
+                break;
+            }
+            for (const auto& adjacent_arc : remaining[popped_vertex]) {
+                Type di = adjacent_arc.weight + popped_vertex_distance;
+                if (adjacent_arc.target != excluded && di < scratch.distances[adjacent_arc.target]) {
+                    if (scratch.distances[adjacent_arc.target] == unreachable_distance<Type>()) {
+                        scratch.touched.push_back(adjacent_arc.target);
+                    }
+                    scratch.distances[adjacent_arc.target] = di;
+                    scratch.heap.add_node(adjacent_arc.target, di);
+                }
+            }
+        }
+        while (!scratch.heap.is_empty()) {
+            scratch.heap.remove_min();
+        }
+    }
+
+
+    /**
+         * Determines the shortcuts required to contract `vertex` without changing the distance between any of its neighbors
+         * @param remaining Edges between uncontracted verticies
+         * @param vertex ID of the vertex to be contracted
+         * @param settle_limit Maximum number of verticies settled by each witness search (a lower limit finds fewer witnesses
+         * and so may overestimate the number of shortcuts)
+         * @param scratch Storage for the witness searches
+         * @param shortcuts Filled with every required shortcut (each pair of neighbors is listed once)
+         */
+    static void find_shortcuts(const std::pmr::vector<std::pmr::vector<arc>>& remaining, unsigned int vertex, unsigned int settle_limit,
+        witness_scratch& scratch, std::pmr::vector<shortcut>& shortcuts) {
+        shortcuts.clear();
+        const auto& neighbors = remaining[vertex];
+        for (size_t i = 0; i + 1 < neighbors.size(); i++) {
+            Type limit = 0;
+            for (size_t j = i + 1; j < neighbors.size(); j++) {
+                limit = std::max(limit, neighbors[i].weight + neighbors[j].weight);
+                scratch.is_target[neighbors[j].target] = true;
+            }
+            witness_search(remaining, neighbors[i].target, vertex, limit, neighbors.size() - i - 1, settle_limit, scratch);
+            for (size_t j = i + 1; j < neighbors.size(); j++) {
+                scratch.is_target[neighbors[j].target] = false;
+                Type through_distance = neighbors[i].weight + neighbors[j].weight;
+                if (scratch.distances[neighbors[j].target] > through_distance) {
+                    shortcuts.push_back(shortcut{neighbors[i].target, neighbors[j].target, through_distance});
+                }
+            }
+            for (unsigned int touched_vertex : scratch.touched) {
+                scratch.distances[touched_vertex] = unreachable_distance<Type>();
+            }
+            scratch.touched.clear();
+        }
+    }
+
+    /// @brief Tag identifying contraction hierarchy files (and their format version)
+    static constexpr char file_tag[8] = {'G', 'R', 'P', 'H', 'C', 'H', '0', '1'};
+    /// @brief Position of each vertex within the contraction order, indexed by vertex ID
+    std::pmr::vector<unsigned int> ranks;
+    /// @brief Index of the first upward arc of each vertex within `arcs` (with a final entry holding the total number of arcs)
+    std::pmr::vector<unsigned int> arc_offsets;
+    /// @brief Upward arcs of all verticies, grouped by vertex ID
+    std::pmr::vector<arc> arcs;
+    /// @brief Number of verticies of the graph the hierarchy was built from
+    unsigned int vertex_count;
+    /// @brief Fingerprint of the graph the hierarchy was built from
+    std::uint64_t graph_fingerprint;
+};
+
+
+/**
+ * Finds the shortest path between `source_id` and `destination_id` with a forward search from the source vertex and a backward
+ * search from the destination vertex that both only follow upward arcs of `hierarchy`, and meet at the highest ranked vertex of
+ * the path. Each search stops once its next extracted distance reaches the shortest path found through any vertex reached by
+ * both searches, and the shortcuts of the found path are then unpacked into the original verticies
+ * @tparam Type typename of the edge weights of the searched graph
+ * @param hierarchy Contraction hierarchy built from the searched graph
+ * @param source_id ID of the source vertex
+ * @param destination_id ID of the destination vertex
+ * @param distances Filled with the distance from the source vertex to each vertex on the unpacked shortest path (infinity for all
+ * other verticies), indexed by vertex ID
+ * @param vertex_path Filled with the ID of the vertex preceding each vertex on the unpacked shortest path (`name_arena::invalid_id`
+ * for the source vertex and all other verticies), indexed by vertex ID
+ * @return Distance to the destination vertex and the number of settled verticies (across both searches)
+ * @note All search storage is allocated from the memory resource of `distances`
+ */
+template <class Type>
+path_search_result<Type> hierarchy_search(const contraction_hierarchy<Type>& hierarchy, unsigned int source_id, unsigned int destination_id,
+    std::pmr::vector<Type>& distances, std::pmr::vector<unsigned int>& vertex_path) {
+    auto vertex_count = hierarchy.get_vertex_count();
+    std::pmr::memory_resource* scratch = distances.get_allocator().resource();
+    distances.assign(vertex_count, unreachable_distance<Type>());
+    vertex_path.assign(vertex_count, name_arena::invalid_id);
+    std::pmr::vector<Type> forward_distances(vertex_count, unreachable_distance<Type>(), scratch);
+    std::pmr::vector<Type> backward_distances(vertex_count, unreachable_distance<Type>(), scratch);
+    std::pmr::vector<unsigned int> forward_parent(vertex_count, name_arena::invalid_id, scratch);
+    std::pmr::vector<unsigned int> backward_parent(vertex_count, name_arena::invalid_id, scratch);
+    auto forward_heap = paired_min_heap<Type, unsigned int>(vertex_count, scratch);
+    auto backward_heap = paired_min_heap<Type, unsigned int>(vertex_count, scratch);
+
+    path_search_result<Type> result{unreachable_distance<Type>(), 0};
+    Type best_distance = unreachable_distance<Type>();
+    unsigned int meeting_vertex = name_arena::invalid_id;
+    forward_distances[source_id] = 0;
+    backward_distances[destination_id] = 0;
+    forward_heap.add_node(source_id, 0);
+    backward_heap.add_node(destination_id, 0);
+
+    unsigned int popped_vertex = 0;
+    Type popped_vertex_distance = 0;
+    while (true) {
+        // A search is finished once its heap is empty or no unsettled vertex can lead to a shorter path
+        bool forward_open = !forward_heap.is_empty() && forward_heap.get_min().second < best_distance;
+        bool backward_open = !backward_heap.is_empty() && backward_heap.get_min().second < best_distance;
+        if (!forward_open && !backward_open) {
+            break;
+        }
+        bool is_forward = forward_open && (!backward_open || forward_heap.get_min().second <= backward_heap.get_min().second);
+        auto& heap = is_forward ? forward_heap : backward_heap;
+        auto& own_distances = is_forward ? forward_distances : backward_distances;
+        auto& other_distances = is_forward ? backward_distances : forward_distances;
+        auto& own_parent = is_forward ? forward_parent : backward_parent;
+
+        std::tie(popped_vertex, popped_vertex_distance) = heap.remove_min();
+        if (popped_vertex_distance > own_distances[popped_vertex]) {
+            continue;
+        }
+        result.settled_count++;
+        if (popped_vertex_distance + other_distances[popped_vertex] < best_distance) {
+            best_distance = popped_vertex_distance + other_distances[popped_vertex];
+            meeting_vertex = popped_vertex;
+        }
+        for (const auto& upward_arc : hierarchy.get_upward(popped_vertex)) {
+            Type di = upward_arc.weight + popped_vertex_distance;
+            if (di < own_distances[upward_arc.target]) {
+                own_distances[upward_arc.target] = di;
+                own_parent[upward_arc.target] = popped_vertex;
+                heap.add_node(upward_arc.target, di);
+            }
+        }
+    }
+    gprintf("Hierarchy search settled %u verticies", result.settled_count);
+
+    if (meeting_vertex == name_arena::invalid_id) {
+        return result;
+    }
+    // Collect the hierarchy verticies from source to meeting vertex to destination, then unpack every arc between them
+    std::pmr::vector<unsigned int> hierarchy_path(scratch);
+    for (unsigned int current_vertex = meeting_vertex; current_vertex != name_arena::invalid_id; current_vertex = forward_parent[current_vertex]) {
+        hierarchy_path.push_back(current_vertex);
+    }
+    std::reverse(hierarchy_path.begin(), hierarchy_path.end());
+    for (unsigned int current_vertex = backward_parent[meeting_vertex]; current_vertex != name_arena::invalid_id; current_vertex = backward_parent[current_vertex]) {
+        hierarchy_path.push_back(current_vertex);
+    }
+    std::pmr::vector<unsigned int> unpacked_path(1, source_id, scratch);
+    for (size_t i = 0; i + 1 < hierarchy_path.size(); i++) {
+        hierarchy.unpack_arc(hierarchy_path[i], hierarchy_path[i + 1], unpacked_path);
+    }
+    distances[source_id] = 0;
+    for (size_t i = 1; i < unpacked_path.size(); i++) {
+        unsigned int previous_vertex = unpacked_path[i - 1];
+        vertex_path[unpacked_path[i]] = previous_vertex;
+        distances[unpacked_path[i]] = distances[previous_vertex] + hierarchy.find_arc(previous_vertex, unpacked_path[i])->weight;
+    }
+    result.distance = distances[destination_id];
+    return result;
+}
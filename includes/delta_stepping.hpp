@@ -0,0 +1,204 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include "indexed_graph.hpp"
+
+
+/// @brief Minimum number of frontier verticies relaxed by each thread before a relaxation phase is split across threads
+inline constexpr size_t delta_stepping_grain = 512;
+
+
+/**
+ * Chooses the bucket width of `delta_stepping_tree` from the edge weights recorded while `graph` was built, as the largest edge
+ * weight divided by the average number of edges per vertex (so that each light relaxation phase reaches about one new vertex per
+ * frontier vertex), but no less than the smallest edge weight (so that every vertex reached by a light edge is a candidate)
+ * @tparam Type typename of the edge weights of the graph
+ * @param graph Graph to be searched
+ * @return Bucket width (the smallest edge weight if the graph has no edges or verticies, or 1 if no positive width results)
+ */
+template <class Type>
+Type suggest_delta(const indexed_graph<Type>& graph) {
+    if (graph.get_edge_count() == 0 || graph.get_vertex_count() == 0) {
+        return Type(1);
+    }
+    double average_degree = static_cast<double>(graph.get_edge_count()) / graph.get_vertex_count();
+    auto delta = static_cast<Type>(static_cast<double>(graph.get_max_weight()) / std::max(1.0, average_degree));
+    delta = std::max(delta, graph.get_min_weight());
+    return delta > Type{} ? delta : Type(1);
+}
+
+
+/**
+ * Calls `work(begin, end, thread_index)` over contiguous ranges covering [0, `count`), running the ranges on separate threads
+ * only when each thread receives at least `delta_stepping_grain` items
+ * @param count Number of items to be processed
+ * @param thread_count Maximum number of threads
+ * @param work Callable processing the items of a single range
+ */
+template <class Callable>
+void delta_stepping_for(size_t count, unsigned int thread_count, Callable&& work) {
+    auto range_count = static_cast<unsigned int>(std::max<size_t>(1, std::min<size_t>(thread_count, count / delta_stepping_grain)));
+    if (range_count == 1) {
+        work(size_t(0), count, 0U);
+        return;
+    }
+    size_t range_size = (count + range_count - 1) / range_count;
+    std::vector<std::thread> workers;
+    for (unsigned int t = 1; t < range_count; t++) {
+        workers.emplace_back(work, std::min(count, t * range_size), std::min(count, (t + 1) * range_size), t);
+    }
+    work(size_t(0), range_size, 0U);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+
+/**
+ * Finds the shortest paths from `source_id` to every vertex of `graph` with the delta-stepping algorithm, which settles
+ * verticies in buckets of width `delta` rather than one at a time, so that the edges leaving every vertex of a bucket are
+ * relaxed in parallel: edges no heavier than `delta` (light edges) are relaxed repeatedly until the bucket stops changing,
+ * followed by a single relaxation of the heavier edges of every vertex the bucket settled
+ * @tparam Type typename of the edge weights of the searched graph (which must all be positive)
+ * @param graph Graph to be searched
+ * @param source_id ID of the source vertex
+ * @param distances Filled with the shortest distance from the source vertex to each vertex (infinity if unreachable), indexed by vertex ID
+ * @param vertex_path Filled with the ID of the vertex preceding each reached vertex on its shortest path (see `forward_search`)
+ * @param delta Width of each bucket of tentative distances (a non-positive width is replaced by `suggest_delta(graph)`)
+ * @param thread_count Maximum number of threads relaxing the edges of a bucket (0 uses one thread per hardware thread)
+ * @return Number of verticies reached from the source vertex
+ * @note Distances and predecessors are identical to those found by `shortest_path_tree`, as predecessors are chosen by the same
+ * rule once every distance is final
+ * @note All storage is allocated from the memory resource of `distances`
+ */
+template <class Type>
+unsigned int delta_stepping_tree(const indexed_graph<Type>& graph, unsigned int source_id, std::pmr::vector<Type>& distances,
+    std::pmr::vector<unsigned int>& vertex_path, Type delta = Type{}, unsigned int thread_count = 0) {
+    auto vertex_count = graph.get_vertex_count();
+    auto* resource = distances.get_allocator().resource();
+    if (!(delta > Type{})) {
+        delta = suggest_delta(graph);
+    }
+    if (thread_count == 0) {
+        thread_count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    std::pmr::vector<std::atomic<Type>> tentative(vertex_count, resource);
+    for (auto& distance : tentative) {
+        distance.store(unreachable_distance<Type>(), std::memory_order_relaxed);
+    }
+
+    // Tentative distances awaiting settlement never exceed the current bucket by more than the heaviest edge, so the buckets are reused cyclically
+    size_t bucket_count = static_cast<size_t>(std::max(graph.get_max_weight(), Type{}) / delta) + 2;
+    std::pmr::vector<std::pmr::vector<unsigned int>> buckets(bucket_count, resource);
+    std::pmr::vector<unsigned int> frontier(resource);
+    std::pmr::vector<unsigned int> bucket_settled(resource);
+    std::pmr::vector<size_t> frontier_round(vertex_count, std::numeric_limits<size_t>::max(), resource);
+    std::pmr::vector<size_t> settled_bucket(vertex_count, std::numeric_limits<size_t>::max(), resource);
+    std::vector<std::vector<unsigned int>> improved(thread_count);
+    size_t current_bucket = 0;
+    size_t pending = 0;
+    // Verticies whose distance rounds below the current bucket are settled with the current bucket rather than lost
+    auto bucket_of = [&](Type distance) {
+        return std::max(static_cast<size_t>(distance / delta), current_bucket);
+    };
+    auto relax = [&](const std::pmr::vector<unsigned int>& vertices, size_t first, bool light) {
+        delta_stepping_for(vertices.size() - first, thread_count, [&](size_t begin, size_t end, unsigned int thread_index) {
+            for (size_t i = first + begin; i < first + end; i++) {
+                unsigned int vertex = vertices[i];
+                Type vertex_distance = tentative[vertex].load(std::memory_order_relaxed);
+                for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                    if ((adjacent_edge.weight <= delta) != light) {
+                        continue;
+                    }
+                    Type di = adjacent_edge.weight + vertex_distance;
+                    Type known = tentative[adjacent_edge.target].load(std::memory_order_relaxed);
+                    while (di < known) {
+                        if (tentative[adjacent_edge.target].compare_exchange_weak(known, di, std::memory_order_relaxed)) {
+                            improved[thread_index].push_back(adjacent_edge.target);
+                            break;
+                        }
+                    }
+                }
+            }
+        });
+        // Threads are joined, so every improvement is visible while the improved verticies are placed into their buckets
+        for (auto& thread_improved : improved) {
+            for (unsigned int vertex : thread_improved) {
+                buckets[bucket_of(tentative[vertex].load(std::memory_order_relaxed)) % bucket_count].push_back(vertex);
+                pending++;
+            }
+            thread_improved.clear();
+        }
+    };
+
+    if (vertex_count > 0) {
+        tentative[source_id].store(0, std::memory_order_relaxed);
+        buckets[0].push_back(source_id);
+        pending = 1;
+    }
+    size_t round = 0;
+    while (pending > 0) {
+        auto& bucket = buckets[current_bucket % bucket_count];
+        bucket_settled.clear();
+        size_t heavy_first = 0;
+        while (!bucket.empty()) {
+            // Light relaxations may refill the current bucket, which is emptied again until no vertex within it improves
+            while (!bucket.empty()) {
+                frontier.clear();
+                round++;
+                for (unsigned int vertex : bucket) {
+                    pending--;
+                    // Entries are left behind when a vertex moves to a lower bucket, and a vertex may be added more than once
+                    if (bucket_of(tentative[vertex].load(std::memory_order_relaxed)) != current_bucket || frontier_round[vertex] == round) {
+                        continue;
+                    }
+                    frontier_round[vertex] = round;
+                    frontier.push_back(vertex);
+                    if (settled_bucket[vertex] != current_bucket) {
+                        settled_bucket[vertex] = current_bucket;
+                        bucket_settled.push_back(vertex);
+                    }
+                }
+                bucket.clear();
+                relax(frontier, 0, true);
+            }
+            // Heavy edges normally lead past the current bucket, but rounding may return a vertex to it
+            relax(bucket_settled, heavy_first, false);
+            heavy_first = bucket_settled.size();
+        }
+        current_bucket++;
+    }
+
+    // Predecessors are chosen once all distances are final: the candidate nearest to the source vertex, then the lowest ID
+    distances.resize(vertex_count);
+    vertex_path.assign(vertex_count, name_arena::invalid_id);
+    unsigned int reached_count = 0;
+    for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+        distances[vertex] = tentative[vertex].load(std::memory_order_relaxed);
+    }
+    for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+        if (distances[vertex] == unreachable_distance<Type>()) {
+            continue;
+        }
+        reached_count++;
+        for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+            unsigned int target = adjacent_edge.target;
+            if (target == source_id || adjacent_edge.weight + distances[vertex] != distances[target]) {
+                continue;
+            }
+            unsigned int& predecessor = vertex_path[target];
+            if (predecessor == name_arena::invalid_id || distances[vertex] < distances[predecessor] ||
+                (distances[vertex] == distances[predecessor] && vertex < predecessor)) {
+                predecessor = vertex;
+            }
+        }
+    }
+    return reached_count;
+}
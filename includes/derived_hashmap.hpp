@@ -1,11 +1,13 @@
 #include <cstdint>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cassert>
 #include <cmath>
 #include <utility>
 #include <list>
+#include <memory_resource>
 #ifndef DERIVED_HASHMAP_H
 #define DERIVED_HASHMAP_H
 
@@ -15,8 +17,22 @@
  * characters of string argument `key`
  * @param key String value used to produce hash index
  * @return A hash index value generated by hash function using `key`
+ * @note Defined within the header so hashmap lookups performed inside graph traversal loops can be inlined
+ * @note Accepts a `std::string_view` so both `std::string` and `std::pmr::string` keys can be hashed without conversion
  */
-extern unsigned int apply_hash_function(const std::string& key);
+inline unsigned int apply_hash_function(std::string_view key) {
+    unsigned int hash = 0;
+    unsigned int index = 0;
+    int string_length = static_cast<int>(key.size());
+    // Produce integer sum from ascii character codes of string characters
+    for (int i = 0; i < string_length; i++) {
+        unsigned int c = static_cast<unsigned int>(key.data()[i]);
+        // Multiply by incrementing index to introduce further variation
+        hash += (index + 1) * c;
+        index++;
+    }
+    return hash;
+}
 
 
 /**
@@ -39,29 +55,46 @@ extern bool is_prime( unsigned int capacity_val);
  * Customized stand-alone hashmap-like class objects that utilize open-addressing and an underlying
  * vector-type storage array `hash_bucket`  to store `hash_entry` structs that hold key : `Type` value pairs
  * @tparam Type typename of values for `soa_hashmap` class objects to store as the values of all key : `Type` value pairs
+ * @note Declared `final` with non-virtual member functions, so calls made on objects held by value or reference are resolved
+ * at compile time and carry no vtable pointer
+ * @note All storage (buckets, stored keys and the `keys` list) is allocated from the `std::pmr::memory_resource` provided on
+ * construction (the default resource if none is provided), allowing entire graphs to be placed within a single arena
  */
 template <class Type>
-class soa_hashmap {
+class soa_hashmap final {
 public:
-    soa_hashmap(unsigned int c): size(0), capacity(c) {fill_buckets();} // Constructor builds underlying storage array with a starting bucket capacity of `c`
+    // Constructor builds underlying storage array with a starting bucket capacity of `c`, allocating all storage from `resource`
+    soa_hashmap(unsigned int c, std::pmr::memory_resource* resource = std::pmr::get_default_resource()): size(0), capacity(c),
+        hash_bucket{resource}, keys{resource} {fill_buckets();}
     soa_hashmap(): size(0), capacity(5) {fill_buckets();} // Constructor defaults to capacity of 5 if no capacity argument is provided
     // Soa_hashmap Copy Constructor
     soa_hashmap(const soa_hashmap<Type>& other_shash): size{other_shash.size},
         capacity{other_shash.capacity},
         hash_bucket{other_shash.hash_bucket},
         keys{other_shash.keys} {}
+    // Soa_hashmap Copy Constructor placing the copied storage within `resource`
+    soa_hashmap(const soa_hashmap<Type>& other_shash, std::pmr::memory_resource* resource): size{other_shash.size},
+        capacity{other_shash.capacity},
+        hash_bucket{other_shash.hash_bucket, resource},
+        keys{other_shash.keys, resource} {}
 
     // Soa_hashmap Copy Assignment Operator overloading constructor
     soa_hashmap<Type>& operator=(soa_hashmap<Type>& old_shash) {
         std::swap(size, old_shash.size);
         std::swap(capacity, old_shash.capacity);
-        std::swap(hash_bucket, old_shash.hash_bucket);
-        std::swap(keys, old_shash.keys);
+        // Swapped through move operations (rather than `std::vector::swap`) as both objects may use different memory resources
+        auto temp_bucket = std::move(hash_bucket);
+        hash_bucket = std::move(old_shash.hash_bucket);
+        old_shash.hash_bucket = std::move(temp_bucket);
+        auto temp_keys = std::move(keys);
+        keys = std::move(old_shash.keys);
+        old_shash.keys = std::move(temp_keys);
         return *this;
     }
 
     // Constructor for initialization with provided vector of key: value pairs
-    soa_hashmap(std::vector<std::pair<std::string, Type>>& heap_array): size(0), capacity(0) {
+    soa_hashmap(std::vector<std::pair<std::string, Type>>& heap_array, std::pmr::memory_resource* resource = std::pmr::get_default_resource()):
+        size(0), capacity(0), hash_bucket{resource}, keys{resource} {
         capacity = static_cast<unsigned int>(heap_array.size());
         fill_buckets();
         for (size_t s = 0; s < heap_array.size(); s++) {
@@ -76,6 +109,11 @@ public:
         capacity{std::exchange(old_shashmap.capacity, 0)},
         hash_bucket{std::move(old_shashmap.hash_bucket)},
         keys{std::move(old_shashmap.keys)} {}
+    // Move Constructor for `soa_hashmap` objects placing the moved storage within `resource` (copies elements if resources differ)
+    soa_hashmap(soa_hashmap<Type>&& old_shashmap, std::pmr::memory_resource* resource): size{std::exchange(old_shashmap.size, 0)},
+        capacity{std::exchange(old_shashmap.capacity, 0)},
+        hash_bucket{std::move(old_shashmap.hash_bucket), resource},
+        keys{std::move(old_shashmap.keys), resource} {}
 
     // Move operator overloading function for transferring ownership between `soa_hashmap` objects
     soa_hashmap<Type>& operator=(soa_hashmap<Type>&& old_shashmap) noexcept {
@@ -93,7 +131,7 @@ public:
          * of calling `soa_hashmap` class object (Number of `hash_entry` structs)
          * @return Number of non-empty elements currently stored in calling `soa_hashmap` class object
          */
-    virtual unsigned int get_size() {
+    unsigned int get_size() {
         return size;
     }
 
@@ -102,7 +140,7 @@ public:
          * (Underlying array contains preallocated space for both empty and non-empty elements between this range)
          * @return Maximum number of indices currently available for value storage (indices 0 to capacity - 1)
          */
-    virtual unsigned int get_capacity() {
+    unsigned int get_capacity() {
         return capacity;
     }
 
@@ -110,15 +148,23 @@ public:
          * Retrieves current array of key values stored within `key` member of calling `soa_hashmap` class object
          * @return vector-type array holding all keys currently held within calling `soa_hashmap` class object
          */
-    virtual std::list<std::string>& get_keys() {
+    std::pmr::list<std::pmr::string>& get_keys() {
         return keys;
     }
 
+    /**
+         * Retrieves the memory resource from which all storage of the calling `soa_hashmap` class object is allocated
+         * @return Pointer to the `std::pmr::memory_resource` used by the calling `soa_hashmap` class object
+         */
+    std::pmr::memory_resource* get_memory_resource() const {
+        return hash_bucket.get_allocator().resource();
+    }
+
 
     /**
          * Prints all string key values found within calling `soa_hashmap` object to standard output stream
          */
-    virtual void print_keys() {
+    void print_keys() {
         std::cout << "[ ";
         for (const auto& key : keys) {
             if (key == keys.back()) {
@@ -136,7 +182,7 @@ public:
          * @note Load Factor = Current number of stored key : value pairs divided by current array capacity
          * @return Value of current calculated load factor of colling `soa_hashmap` class object
          */
-    virtual double table_load() {
+    double table_load() {
         double load_factor = static_cast<double>(size) / static_cast<double>(capacity);
         return load_factor;
     }
@@ -148,7 +194,7 @@ public:
          * than `new_capacity`
          * @param new_capacity Value to be used in readjusting the capacity of `soa_hashamp`'s underlying storage array
          */
-    virtual void resize_table(unsigned int new_capacity) {
+    void resize_table(unsigned int new_capacity) {
         // Prevent unintentional downsizing of capacity to less than currently stored
         if (new_capacity < size) {
             return;
@@ -159,8 +205,8 @@ public:
         if (!is_prime(new_capacity)) {
             new_capacity = get_next_prime(new_capacity);
         }
-        // Swap contents of current storage array with an empty array of same size and capacity
-        std::vector<hash_entry> old_heap_bucket {};
+        // Swap contents of current storage array with an empty array of same size and capacity (sharing the same memory resource)
+        std::pmr::vector<hash_entry> old_heap_bucket {hash_bucket.get_allocator()};
         old_heap_bucket.swap(hash_bucket);
 
         // Reset and refill array with increased capacity
@@ -168,9 +214,9 @@ public:
         size = 0;
         keys.clear();
         assert(keys.empty());
+        hash_bucket.reserve(new_capacity);
         for (unsigned int i = 0; i < new_capacity; i++) {
-            hash_entry new_val{};
-            hash_bucket.insert(hash_bucket.begin() + i, std::move(new_val));
+            hash_bucket.emplace_back();
         }
 
         // Rehash values according to newly increased capacity within newly reset array
@@ -190,7 +236,7 @@ public:
          * @param key String-type value representing the key of key : value pair to be added or modified
          * @param value `Type` value representing the value of the associated `key` to be added or modified
          */
-    virtual void add(std::string key, Type value) {
+    void add(std::string_view key, Type value) {
         // Check current table load and readjust storage capacity if necessary
         double tl = table_load();
         if (tl >= 0.5) {
@@ -217,7 +263,7 @@ public:
                 hash_bucket[next_index].value = value;
                 if (hash_bucket[next_index].is_tombstone) {
                     hash_bucket[next_index].is_tombstone = false;
-                    keys.push_back(key);
+                    keys.emplace_back(key);
                     size++;
                 }
                 return;
@@ -235,7 +281,7 @@ public:
         hash_bucket[next_index].key = key;
         hash_bucket[next_index].value = value;
         hash_bucket[next_index].is_empty = false;
-        keys.push_back(key);
+        keys.emplace_back(key);
         size++;
     }
 
@@ -247,7 +293,7 @@ public:
          * will be returned
          * @return Value held by `hash_entry` struct with matching `key` attribute
          */
-    virtual Type get_val(std::string key) {
+    Type get_val(std::string_view key) {
         // If `soa_hashmap` has no stored values, throw runtime exception with error description
         if (size == 0) {
             throw(std::runtime_error("ERROR: Hashmap does not currently hold any values to retrieve!"));
@@ -289,7 +335,7 @@ public:
          * Return number of index positions that do not hold a value within `hash_bucket` storage array
          * @return The total number of empty index positions within `hash_bucket` storage array
          */
-    virtual unsigned int empty_buckets() {
+    unsigned int empty_buckets() {
         unsigned int empty_bucket_count = 0;
         if (size == 0) {
             empty_bucket_count = capacity;
@@ -310,7 +356,7 @@ public:
          * @param key The value of the `hash_entry` struct's `key` attribute to searched for
          * @return `true` if a `hash_entry` holding the matching `key` attribute is found, else `false`
          */
-    virtual bool contains_key(std::string key) {
+    bool contains_key(std::string_view key) {
         if (size == 0) {
             return false;
         }
@@ -342,7 +388,7 @@ public:
          * storage array `hash_bucket`, if found
          * @param key The value of the `hash_entry` struct's `key` attribute that is to be removed
          */
-    virtual void remove(std::string key) {
+    void remove(std::string_view key) {
         if (size == 0) {
             return;
         }
@@ -361,7 +407,7 @@ public:
                 hash_bucket[next_index].is_tombstone = true;
                 size--;
                 // Erases matching key from `soa_hashmap` objects's `keys` member
-                std::list<std::string>::iterator list_pos = keys.begin();
+                auto list_pos = keys.begin();
                 for (auto& key_name : keys) {
                     if(hash_bucket[next_index].key.compare(key_name) == 0) {
                         keys.erase(list_pos);
@@ -386,14 +432,13 @@ public:
     /**
          * Resets/empties all of calling `soa_hashmap` class object's stored values
          */
-    virtual void clear() {
+    void clear() {
         hash_bucket.clear();
         keys.clear();
         assert(hash_bucket.empty());
         assert(keys.empty());
         for (unsigned int i = 0; i < capacity; i++) {
-            hash_entry new_val{};
-            hash_bucket.insert(hash_bucket.begin() + i, std::move(new_val));
+            hash_bucket.emplace_back();
         }
         size = 0;
     }
@@ -431,9 +476,9 @@ private:
             capacity = 5;
             assert(capacity == 5);
         }
+        hash_bucket.reserve(capacity);
         for (unsigned int i = 0; i < capacity; i++) {
-            hash_entry new_val{};
-            hash_bucket.insert(hash_bucket.begin() + i, std::move(new_val));
+            hash_bucket.emplace_back();
         }
     }
 
@@ -443,8 +488,10 @@ private:
     unsigned int capacity;
     /// @brief Struct holing key : value pairs and boolean indicators (for removal/search operations)
     struct hash_entry {
+        /// @brief Allocator type through which `std::pmr::vector` passes its memory resource to each stored `hash_entry`
+        using allocator_type = std::pmr::polymorphic_allocator<char>;
         /// @brief Key value of key : value pair
-        std::string key;
+        std::pmr::string key;
         /// @brief Corresponding value of key : value pair
         Type value;
         /// @brief Boolean indicator for detecting `hash_entry` structs with no pre-assigned attribute values
@@ -454,10 +501,13 @@ private:
 
         // `Hash_entry` zero-initialization or pre-defined constructors
         hash_entry(): is_empty(true), is_tombstone(false) {}
+        explicit hash_entry(const allocator_type& alloc): key{alloc}, is_empty(true), is_tombstone(false) {}
 
         // `Hash_entry` Copy Contructor
         hash_entry(const hash_entry& other_entry): key{other_entry.key}, value{other_entry.value},
             is_empty{other_entry.is_empty}, is_tombstone{other_entry.is_tombstone} {}
+        hash_entry(const hash_entry& other_entry, const allocator_type& alloc): key{other_entry.key, alloc}, value{other_entry.value},
+            is_empty{other_entry.is_empty}, is_tombstone{other_entry.is_tombstone} {}
         // `Hash_entry` Copy Assignment Operator overloading function
         hash_entry& operator=(hash_entry& old_hash) {
             std::swap(key, old_hash.key);
@@ -473,6 +523,9 @@ private:
         hash_entry(hash_entry&& other_hash)  noexcept: key{std::move(other_hash.key)},
             value{std::move(other_hash.value)}, is_empty{std::move(other_hash.is_empty)},
             is_tombstone{std::move(other_hash.is_tombstone)} {}
+        hash_entry(hash_entry&& other_hash, const allocator_type& alloc): key{std::move(other_hash.key), alloc},
+            value{std::move(other_hash.value)}, is_empty{std::move(other_hash.is_empty)},
+            is_tombstone{std::move(other_hash.is_tombstone)} {}
         // `Hash_entry` Move Assignment Operator overloading function
         hash_entry& operator=(hash_entry&& old_hash) noexcept {
             key = std::move(old_hash.key);
@@ -483,9 +536,9 @@ private:
         }
     };
     /// @brief Underlying storage array of `soa_hashmap` class object
-    std::vector<hash_entry> hash_bucket{};
+    std::pmr::vector<hash_entry> hash_bucket{};
     /// @brief Array containing all currently existing keys stored in `soa_hashmap` class object
-    std::list<std::string> keys {};
+    std::pmr::list<std::pmr::string> keys {};
 
 
     /**
@@ -493,7 +546,7 @@ private:
          * @return vector-type array of `hash_entry` structs holding all key : value pairs witihin
          * calling `soa_hashmap` class object
          */
-    virtual std::vector<hash_entry>& get_hash_bucket() {
+    std::pmr::vector<hash_entry>& get_hash_bucket() {
         return hash_bucket;
     }
 };
@@ -512,33 +565,43 @@ private:
  *
  * `main_hashmap<std::string>` can only contain `soa_hashmap<std::string>` class objects with key : `std::string` value pairs
  *
+ * @note Declared `final` with non-virtual member functions (see `soa_hashmap`)
+ * @note Buckets, keys and the pre-filled `soa_hashmap` class objects of every bucket are allocated from the `std::pmr::memory_resource`
+ * provided on construction (see `soa_hashmap`)
  */
 template<class Type>
-class main_hashmap {
+class main_hashmap final {
 public:
-    // Constructor builds underlying storage array with a starting bucket capacity of `c`
-    main_hashmap(unsigned int c): main_size(0), main_capacity(c) {fill_buckets();}
+    // Constructor builds underlying storage array with a starting bucket capacity of `c`, allocating all storage from `resource`
+    main_hashmap(unsigned int c, std::pmr::memory_resource* resource = std::pmr::get_default_resource()): main_size(0),
+        main_capacity(c), main_keys{resource}, main_hash_bucket{resource} {fill_buckets();}
     // Constructor defaults to capacity of 5 if no capacity argument is provided
     main_hashmap(): main_size(0), main_capacity(5) {fill_buckets();}
 
     // Main_hashmap Copy Constructor
     main_hashmap(const main_hashmap<Type>& other_mhash) : main_size{other_mhash.main_size},
-        main_hash_bucket{other_mhash.main_hash_bucket},
-        main_keys{other_mhash.main_keys} {}
+        main_capacity{other_mhash.main_capacity},
+        main_keys{other_mhash.main_keys},
+        main_hash_bucket{other_mhash.main_hash_bucket} {}
 
     // Main_hashmap Copy Assignment Operator overloading function
     main_hashmap<Type>& operator=(main_hashmap<Type>& old_mhash) {
         std::swap(main_size, old_mhash.main_size);
         std::swap(main_capacity, old_mhash.main_capacity);
-        std::swap(main_hash_bucket, old_mhash.main_hash_bucket);
-        std::swap(main_keys, old_mhash.main_keys);
+        // Swapped through move operations (see `soa_hashmap` copy assignment) as both objects may use different memory resources
+        auto temp_bucket = std::move(main_hash_bucket);
+        main_hash_bucket = std::move(old_mhash.main_hash_bucket);
+        old_mhash.main_hash_bucket = std::move(temp_bucket);
+        auto temp_keys = std::move(main_keys);
+        main_keys = std::move(old_mhash.main_keys);
+        old_mhash.main_keys = std::move(temp_keys);
         return *this;
     }
     // Move Constructor for main_hashmap objects
     main_hashmap(main_hashmap<Type>&& old_mashmap) noexcept : main_size{std::exchange(old_mashmap.main_size, 0)},
         main_capacity{std::exchange(old_mashmap.main_capacity, 0)},
-        main_hash_bucket{std::move(old_mashmap.main_hash_bucket)},
-        main_keys{std::move(old_mashmap.main_keys)} {}
+        main_keys{std::move(old_mashmap.main_keys)},
+        main_hash_bucket{std::move(old_mashmap.main_hash_bucket)} {}
 
     // Move operator overloading function for transferring ownership between soa_hashmap objects
     main_hashmap<Type>& operator=(main_hashmap<Type>&& old_mashmap) noexcept {
@@ -554,7 +617,7 @@ public:
          * of calling `main_hashmap` class object
          * @return Number of non-empty elements currently stored in calling `main_hashmap` class object
          */
-    virtual unsigned int get_size() {
+    unsigned int get_size() {
         return main_size;
     }
 
@@ -565,7 +628,7 @@ public:
          * (Underlying array contains preallocated space for both empty and non-empty elements between this range)
          * @return Maximum number of indices currently available for value storage (indices 0 to capacity - 1)
          */
-    virtual unsigned int get_capacity() {
+    unsigned int get_capacity() {
         return main_capacity;
     }
 
@@ -575,7 +638,7 @@ public:
          * @note Load Factor = Current number of non-empty `hash_table` structs divided by current array capacity
          * @return Value of current calculated load factor of colling `main_hashmap` class object
          */
-    virtual double table_load() {
+    double table_load() {
         double load_factor = static_cast<double>(main_size) / static_cast<double>(main_capacity);
         return load_factor;
     }
@@ -587,7 +650,7 @@ public:
          * than `new_capacity`
          * @param new_capacity Value to be used in readjusting the capacity of `main_hashamp`'s underlying storage array
          */
-    virtual void resize_table(unsigned int new_capacity) {
+    void resize_table(unsigned int new_capacity) {
         // Prevent unintentional downsizing of capacity to less than currently stored
         if (new_capacity < main_size) {
             return;
@@ -598,8 +661,8 @@ public:
             new_capacity = get_next_prime(new_capacity);
         }
 
-        // Swap contents of current storage array with an empty array of same size and capacity
-        std::vector<hash_table> old_heap_bucket {};
+        // Swap contents of current storage array with an empty array of same size and capacity (sharing the same memory resource)
+        std::pmr::vector<hash_table> old_heap_bucket {main_hash_bucket.get_allocator()};
         old_heap_bucket.swap(main_hash_bucket);
 
         // Reset and refill array with increased capacity
@@ -608,9 +671,9 @@ public:
         main_keys.clear();
         assert(main_keys.empty());
 
+        main_hash_bucket.reserve(new_capacity);
         for (unsigned int i = 0; i < new_capacity; i++) {
-            hash_table new_val{};
-            main_hash_bucket.insert(main_hash_bucket.begin() + i, std::move(new_val));
+            main_hash_bucket.emplace_back();
         }
 
         // Rehash values according to newly increased capacity within newly reset array
@@ -627,15 +690,25 @@ public:
          * Retrieves current array of key values stored within `main_keys` member of calling `main_hashmap` class object
          * @return vector-type array holding all unique keys currently stored within calling `main_hashmap` class object
          */
-    virtual std::list<std::string> get_keys() {
-        return main_keys;
+    std::list<std::string> get_keys() {
+        return std::list<std::string>(main_keys.begin(), main_keys.end());
+    }
+
+
+    /**
+         * Retrieves the memory resource from which all storage of the calling `main_hashmap` class object is allocated
+         * @return Pointer to the `std::pmr::memory_resource` used by the calling `main_hashmap` class object
+         * (`soa_hashmap` class objects built with this resource can be added without being copied between resources)
+         */
+    std::pmr::memory_resource* get_memory_resource() const {
+        return main_hash_bucket.get_allocator().resource();
     }
 
 
     /**
          * Prints all string key values found within calling `main_hashmap` object to output streams
          */
-    virtual void print_keys() {
+    void print_keys() {
         std::cout << "[ ";
         for (const auto& key : main_keys) {
 
@@ -660,7 +733,7 @@ public:
          * @param key String-type value representing the key attribute of `hash_table` struct to be added or modified
          * @param hash_list The `soa_hashmap` class object to be added or modified within the `hash_table` struct with the matching `key`
          */
-    virtual void add(std::string key, soa_hashmap<Type>&& hash_list) {
+    void add(std::string_view key, soa_hashmap<Type>&& hash_list) {
         // Check current table load and readjust storage capacity if necessary
         double tl = table_load();
         if (tl >= 0.5) {
@@ -688,7 +761,7 @@ public:
                 main_hash_bucket[next_index].entry = std::move(hash_list);
                 if (main_hash_bucket[next_index].is_tombstone) {
                     main_hash_bucket[next_index].is_tombstone = false;
-                    main_keys.push_back(key);
+                    main_keys.emplace_back(key);
                     main_size++;
                 }
                 return;
@@ -707,7 +780,7 @@ public:
         main_hash_bucket[next_index].entry = std::move(hash_list);
         main_hash_bucket[next_index].is_empty = false;
 
-        main_keys.push_back(key);
+        main_keys.emplace_back(key);
         main_size++;
     }
 
@@ -720,7 +793,7 @@ public:
          * @param key String-type value representing the key attribute of `hash_table` struct to be located
          * @return `soa_hashmap` class object stored in `hash_table` struct with matching `key` attribute
          */
-    soa_hashmap<Type>& get_hash_key(std::string key) {
+    soa_hashmap<Type>& get_hash_key(std::string_view key) {
         // Throw runtime exception with notification of empty hashmap error
         if (main_size == 0) {
             throw(std::runtime_error("ERROR: Cannot return hash keys from an empty main_hashmap object!"));
@@ -771,7 +844,7 @@ public:
          * @return Value held by `hash_entry` struct with matching `target_key` if it exists within a `hash_table`
          * struct with matching `main_key` that also exists within the calling `main_hashmap` object
          */
-    virtual Type get_val(std::string main_key, std::string target_key) {
+    Type get_val(std::string_view main_key, std::string_view target_key) {
         // Throw exception and notify user that calling hashmap has no key with value
         if (main_size == 0) {
             throw(std::runtime_error("ERROR: Cannot return key values from an empty main_hashmap object!"));
@@ -822,7 +895,7 @@ public:
          * @param value `value` of `hash_entry` struct whose `key` is to be retrieved
          * @return `key` of `hash_entry` struct with matching `value` from within `hash_table` struct with matching `main_key`
          */
-    std::string get_key_by_value(std::string main_key, Type value) {
+    std::string get_key_by_value(std::string_view main_key, Type value) {
         std::string key_val = "";
         if (main_size == 0) {
             throw(std::runtime_error("ERROR: Cannot return keys associated to a value when main_hashmap is empty!"));
@@ -898,7 +971,7 @@ public:
          * Return number of index positions that do not hold a value within `main_hash_bucket` storage array
          * @return The total number of empty index positions within `main_hash_bucket` storage array
          */
-    virtual unsigned int empty_buckets() {
+    unsigned int empty_buckets() {
         unsigned int empty_bucket_count = 0;
         if (main_size == 0) {
             empty_bucket_count = main_capacity;
@@ -919,7 +992,7 @@ public:
          * @param key The value of the `hash_table` struct's `main_key` attribute to searched for
          * @return `true` if a `hash_table` struct holding the matching `main_key` attribute is found, else `false`
          */
-    virtual bool contains_key(std::string key) {
+    bool contains_key(std::string_view key) {
         if (main_size == 0) {
             return false;
         }
@@ -952,7 +1025,7 @@ public:
          * storage array `main_hash_bucket`, if found
          * @param key The value of the `hash_table` struct's `main_key` attribute that is to be removed
          */
-    virtual void remove( std::string key) {
+    void remove(std::string_view key) {
         if (main_size == 0) {
             return;
         }
@@ -969,7 +1042,7 @@ public:
             if (main_hash_bucket[next_index].main_key.compare(key) == 0 && !main_hash_bucket[next_index].is_tombstone) {
                 main_hash_bucket[next_index].is_tombstone = true;
                 main_size--;
-                std::list<std::string>::iterator list_pos = main_keys.begin();
+                auto list_pos = main_keys.begin();
                 for (auto& key_name : main_keys) {
                     if(main_hash_bucket[next_index].main_key.compare(key_name) == 0) {
                         main_keys.erase(list_pos);
@@ -995,14 +1068,13 @@ public:
     /**
          * Resets/empties all of calling `master_hashmap` class object's stored values
          */
-    virtual void clear() {
+    void clear() {
         main_keys.clear();
         main_hash_bucket.clear();
         assert(main_hash_bucket.empty());
         assert(main_keys.empty());
         for (unsigned int i = 0; i < main_capacity; i++) {
-            hash_table new_val{};
-            main_hash_bucket.insert(main_hash_bucket.begin() + i, std::move(new_val));
+            main_hash_bucket.emplace_back();
         }
         main_size = 0;
     }
@@ -1042,9 +1114,9 @@ private:
             assert(main_capacity == 5);
         }
 
+        main_hash_bucket.reserve(main_capacity);
         for (unsigned int i = 0; i < main_capacity; i++) {
-            hash_table new_val{};
-            main_hash_bucket.insert(main_hash_bucket.begin() + i, std::move(new_val));
+            main_hash_bucket.emplace_back();
         }
     }
 
@@ -1054,8 +1126,10 @@ private:
     unsigned int main_capacity;
     /// @brief Struct holding key : `soa_hashmap` class object pairs and boolean indicators (for removal/search operations)
     struct hash_table {
+        /// @brief Allocator type through which `std::pmr::vector` passes its memory resource to each stored `hash_table`
+        using allocator_type = std::pmr::polymorphic_allocator<char>;
         /// @brief Key value of key : `soa_hashmap` class object pair
-        std::string main_key;
+        std::pmr::string main_key;
         /// @brief `soa_hashmap` class object associated with `main_key`
         soa_hashmap<Type> entry = soa_hashmap<Type>();
         /// @brief Boolean indicator of whether a `hash_table` struct with a pre-assigned value 'exists'
@@ -1065,11 +1139,16 @@ private:
 
         // Hash_table Constructors
         hash_table() : is_tombstone(false), is_empty(true) {}
+        explicit hash_table(const allocator_type& alloc) : main_key{alloc}, entry{5, alloc.resource()},
+            is_tombstone(false), is_empty(true) {}
 
         // Hash_table Copy Constructor
         hash_table(const hash_table& other_table) : main_key{other_table.main_key},
             entry{other_table.entry}, is_tombstone{other_table.is_tombstone},
             is_empty{other_table.is_empty} {}
+        hash_table(const hash_table& other_table, const allocator_type& alloc) : main_key{other_table.main_key, alloc},
+            entry{other_table.entry, alloc.resource()}, is_tombstone{other_table.is_tombstone},
+            is_empty{other_table.is_empty} {}
 
         // Hash_table Copy Assignment Operator overloading function
         hash_table& operator=(hash_table& old_table) {
@@ -1088,6 +1167,10 @@ private:
             entry{std::move(old_hasht.entry)},
             is_tombstone{std::move(old_hasht.is_tombstone)},
             is_empty{std::move(old_hasht.is_empty)} {}
+        hash_table(hash_table&& old_hasht, const allocator_type& alloc): main_key{std::move(old_hasht.main_key), alloc},
+            entry{std::move(old_hasht.entry), alloc.resource()},
+            is_tombstone{std::move(old_hasht.is_tombstone)},
+            is_empty{std::move(old_hasht.is_empty)} {}
 
         // Hash_table Move Operator Overloading Function
         hash_table& operator=(hash_table&& old_hash) noexcept {
@@ -1099,10 +1182,10 @@ private:
         }
     };
     /// @brief Underlying storage array of `main_hashmap` class object
-    std::list<std::string> main_keys {};
+    std::pmr::list<std::pmr::string> main_keys {};
 
     /// @brief Array containing all currently existing keys stored in `main_hashmap` class object
-    std::vector<hash_table> main_hash_bucket{};
+    std::pmr::vector<hash_table> main_hash_bucket{};
 
 
     /**
@@ -1110,7 +1193,7 @@ private:
          * @return vector-type array of `hash_table` structs holding all `soa_hashmap` class objects
          * in calling `main_hashmap` class object
          */
-    virtual std::vector<hash_table>& get_hash_bucket() {
+    std::pmr::vector<hash_table>& get_hash_bucket() {
         return main_hash_bucket;
     }
 };
@@ -0,0 +1,341 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "indexed_graph.hpp"
+#include "pair_minheap.hpp"
+
+
+/**
+ * Shortest distances from every vertex of a list of source verticies to every vertex of a list of target verticies, computed
+ * by one Dijkstra search per source vertex that ends as soon as every target vertex has been settled
+ * @tparam Type typename of the edge weights of the graph (and of the stored distances)
+ *
+ * The searches of different source verticies are independent, so they are distributed across a pool of threads that each
+ * claim the next unprocessed source vertex and reuse their own search storage, resetting only the entries written by the
+ * previous search
+ *
+ * @note Distances are stored row-major in a single contiguous array, with one row per source vertex and one column per
+ * target vertex (infinity if the target vertex is unreachable from the source vertex)
+ */
+template <class Type>
+class distance_matrix final {
+public:
+    /// @brief Identifier written at the start of every binary matrix file
+    static constexpr char file_tag[8] = {'G', 'R', 'P', 'H', 'D', 'M', '0', '1'};
+
+    // Constructor creates an empty matrix with no rows or columns, allocating all storage from `resource`
+    distance_matrix(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): sources{resource}, targets{resource},
+        cells{resource}, settled_count(0) {}
+
+
+    /**
+         * Replaces the contents of the calling `distance_matrix` with the shortest distances from each of `source_ids` to each
+         * of `target_ids` within `graph`
+         * @param graph Graph to be searched
+         * @param source_ids IDs of the source verticies, one per row (in order)
+         * @param target_ids IDs of the target verticies, one per column (in order)
+         * @param thread_count Number of threads performing the searches (0 uses one thread per hardware thread)
+         * @throws `std::runtime_error` if any of `source_ids` or `target_ids` is not the ID of a vertex of `graph`
+         */
+    void compute(const indexed_graph<Type>& graph, const std::vector<unsigned int>& source_ids, const std::vector<unsigned int>& target_ids,
+        unsigned int thread_count = 0) {
+        unsigned int vertex_count = graph.get_vertex_count();
+        for (unsigned int id : source_ids) {
+            check_id(id, vertex_count);
+        }
+        for (unsigned int id : target_ids) {
+            check_id(id, vertex_count);
+        }
+        sources.assign(source_ids.begin(), source_ids.end());
+        targets.assign(target_ids.begin(), target_ids.end());
+        cells.assign(sources.size() * targets.size(), unreachable_distance<Type>());
+        settled_count = 0;
+        if (sources.empty() || targets.empty()) {
+            return;
+        }
+
+        // Targets listed more than once are only counted once when deciding whether a search may end
+        std::pmr::unsynchronized_pool_resource compute_pool;
+        std::pmr::vector<bool> is_target(vertex_count, false, &compute_pool);
+        unsigned int distinct_targets = 0;
+        for (unsigned int id : targets) {
+            if (!is_target[id]) {
+                is_target[id] = true;
+                distinct_targets++;
+            }
+        }
+
+        if (thread_count == 0) {
+            thread_count = std::max(1U, std::thread::hardware_concurrency());
+        }
+        thread_count = static_cast<unsigned int>(std::max<size_t>(1, std::min<size_t>(thread_count, sources.size())));
+        std::atomic<size_t> next_row{0};
+        std::atomic<unsigned long> total_settled{0};
+        auto compute_rows = [&]() {
+            std::pmr::unsynchronized_pool_resource thread_pool;
+            search_scratch scratch(vertex_count, &thread_pool);
+            unsigned long thread_settled = 0;
+            for (size_t row = next_row++; row < sources.size(); row = next_row++) {
+                thread_settled += search_row(graph, row, is_target, distinct_targets, scratch);
+            }
+            total_settled += thread_settled;
+        };
+        std::vector<std::thread> workers;
+        for (unsigned int t = 1; t < thread_count; t++) {
+            workers.emplace_back(compute_rows);
+        }
+        compute_rows();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        settled_count = total_settled;
+    }
+
+
+    /**
+         * Retrieves the shortest distance from the source vertex of `row` to the target vertex of `column`
+         * @param row Position of the source vertex within the list of source verticies
+         * @param column Position of the target vertex within the list of target verticies
+         * @return Shortest distance (infinity if the target vertex is unreachable)
+         */
+    Type get_distance(size_t row, size_t column) const {
+        return cells[row * targets.size() + column];
+    }
+
+
+    /**
+         * Retrieves the distances from the source vertex of `row` to every target vertex
+         * @param row Position of the source vertex within the list of source verticies
+         * @return Pointer to the first of `get_column_count()` contiguous distances
+         */
+    const Type* get_row(size_t row) const {
+        return cells.data() + row * targets.size();
+    }
+
+
+    /**
+         * Retrieves the entire row-major array of distances
+         * @return Pointer to the first of `get_row_count() * get_column_count()` contiguous distances
+         */
+    const Type* data() const {
+        return cells.data();
+    }
+
+
+    /**
+         * Retrieves the number of rows (source verticies) of the matrix
+         * @return Number of source verticies
+         */
+    size_t get_row_count() const {
+        return sources.size();
+    }
+
+
+    /**
+         * Retrieves the number of columns (target verticies) of the matrix
+         * @return Number of target verticies
+         */
+    size_t get_column_count() const {
+        return targets.size();
+    }
+
+
+    /**
+         * Retrieves the total number of verticies settled by the searches of all rows
+         * @return Number of settled verticies
+         */
+    unsigned long get_settled_count() const {
+        return settled_count;
+    }
+
+
+    /**
+         * Writes the matrix to the text file `filename` as comma-separated values, where the first line holds the names of the
+         * target verticies and each following line holds the name of a source vertex followed by its distances ("inf" if unreachable)
+         * @param filename Relative path to the file to be written
+         * @param graph Graph the matrix was computed from, supplying the names of the verticies
+         * @return 0 if successful, -1 if the file could not be written
+         */
+    int write_csv(const std::string& filename, const indexed_graph<Type>& graph) const {
+        std::ofstream write_file(filename, std::ios::trunc);
+        if (!write_file.is_open()) {
+            std::cerr << "ERROR: Could not open file '" << filename << "' for writing the distance matrix!" << '\n';
+            return -1;
+        }
+        write_file.precision(std::numeric_limits<Type>::max_digits10);
+        write_file << "source";
+        for (unsigned int id : targets) {
+            write_file << ',';
+            write_csv_field(write_file, graph.get_vertex_name(id));
+        }
+        write_file << '\n';
+        for (size_t row = 0; row < sources.size(); row++) {
+            write_csv_field(write_file, graph.get_vertex_name(sources[row]));
+            const Type* row_cells = get_row(row);
+            for (size_t column = 0; column < targets.size(); column++) {
+                write_file << ',' << row_cells[column];
+            }
+            write_file << '\n';
+        }
+        if (!write_file.good()) {
+            std::cerr << "ERROR: An error was encountered while writing the distance matrix to '" << filename << "'!" << '\n';
+            return -1;
+        }
+        return 0;
+    }
+
+
+    /**
+         * Writes the matrix to the binary file `filename`, consisting of `file_tag`, the size of `Type` (32-bit), the number of
+         * rows and columns (64-bit each), the source and target vertex IDs (32-bit each) and the row-major distances
+         * @param filename Relative path to the file to be written
+         * @return 0 if successful, -1 if the file could not be written
+         */
+    int write_binary(const std::string& filename) const {
+        static_assert(std::is_trivially_copyable_v<Type>, "Distance matrices can only be written for trivially copyable weight types");
+        std::ofstream write_file(filename, std::ios::binary | std::ios::trunc);
+        if (!write_file.is_open()) {
+            std::cerr << "ERROR: Could not open file '" << filename << "' for writing the distance matrix!" << '\n';
+            return -1;
+        }
+        std::uint32_t type_size = static_cast<std::uint32_t>(sizeof(Type));
+        std::uint64_t row_count = sources.size();
+        std::uint64_t column_count = targets.size();
+        write_file.write(file_tag, sizeof(file_tag));
+        write_file.write(reinterpret_cast<const char*>(&type_size), sizeof(type_size));
+        write_file.write(reinterpret_cast<const char*>(&row_count), sizeof(row_count));
+        write_file.write(reinterpret_cast<const char*>(&column_count), sizeof(column_count));
+        write_file.write(reinterpret_cast<const char*>(sources.data()), static_cast<std::streamsize>(sources.size() * sizeof(unsigned int)));
+        write_file.write(reinterpret_cast<const char*>(targets.data()), static_cast<std::streamsize>(targets.size() * sizeof(unsigned int)));
+        write_file.write(reinterpret_cast<const char*>(cells.data()), static_cast<std::streamsize>(cells.size() * sizeof(Type)));
+        if (!write_file.good()) {
+            std::cerr << "ERROR: An error was encountered while writing the distance matrix to '" << filename << "'!" << '\n';
+            return -1;
+        }
+        return 0;
+    }
+
+private:
+    /// @brief Storage reused across the searches of a single thread
+    struct search_scratch {
+        search_scratch(unsigned int count, std::pmr::memory_resource* resource): distances(count, unreachable_distance<Type>(), resource),
+            touched{resource}, heap(16, resource) {}
+        /// @brief Distance from the current source vertex to each vertex, reset to infinity after every search
+        std::pmr::vector<Type> distances;
+        /// @brief IDs of every vertex whose entry in `distances` was written by the current search
+        std::pmr::vector<unsigned int> touched;
+        paired_min_heap<Type, unsigned int> heap;
+    };
+
+
+    /**
+         * Throws an exception if `id` is not the ID of an existing vertex
+         * @param id Vertex ID to be validated
+         * @param vertex_count Number of verticies of the searched graph
+         */
+    static void check_id(unsigned int id, unsigned int vertex_count) {
+        if (id >= vertex_count) {
+            throw std::runtime_error("ERROR: Vertex ID is out of range of the distance matrix graph!");
+        }
+    }
+
+
+    /**
+         * Writes `name` as a single comma-separated field, enclosed in quotes if it contains a comma or quote
+         * @param write_file Stream receiving the field
+         * @param name Vertex name to be written
+         */
+    static void write_csv_field(std::ostream& write_file, std::string_view name) {
+        if (name.find_first_of(",\"") == std::string_view::npos) {
+            write_file << name;
+            return;
+        }
+        write_file << '"';
+        for (char character : name) {
+            if (character == '"') {
+                write_file << '"';
+            }
+            write_file << character;
+        }
+        write_file << '"';
+    }
+
+
+    /**
+         * Fills the row `row` with a Dijkstra search from its source vertex that ends once all target verticies are settled
+         * @param graph Graph to be searched
+         * @param row Position of the source vertex within `sources`
+         * @param is_target Marks every vertex listed within `targets`
+         * @param target_count Number of distinct verticies listed within `targets`
+         * @param scratch Storage of the calling thread, whose distances are all infinity before and after the search
+         * @return Number of verticies settled by the search
+         */
+    unsigned int search_row(const indexed_graph<Type>& graph, size_t row, const std::pmr::vector<bool>& is_target, unsigned int target_count,
+        search_scratch& scratch) {
+        unsigned int source = sources[row];
+        scratch.distances[source] = 0;
+        scratch.touched.push_back(source);
+        scratch.heap.add_node(source, 0);
+        unsigned int row_settled = 0;
+        unsigned int popped_vertex = 0;
+        Type popped_vertex_distance = 0;
+        while (!scratch.heap.is_empty()) {
+            std::tie(popped_vertex, popped_vertex_distance) = scratch.heap.remove_min();
+            if (popped_vertex_distance > scratch.distances[popped_vertex]) {
+                continue;
+            }
+            row_settled++;
+            // Distances of settled targets are final, so the search ends once no target remains unsettled
+            if (is_target[popped_vertex] && --target_count == 0) {
+                break;
+            }
+            for (const auto& adjacent_edge : graph.get_adjacent(popped_vertex)) {
+                Type di = adjacent_edge.weight + popped_vertex_distance;
+                if (di < scratch.distances[adjacent_edge.target]) {
+                    if (scratch.distances[adjacent_edge.target] == unreachable_distance<Type>()) {
+                        scratch.touched.push_back(adjacent_edge.target);
+                    }
+                    scratch.distances[adjacent_edge.target] = di;
+                    scratch.heap.add_node(adjacent_edge.target, di);
+                }
+            }
+        }
+        while (!scratch.heap.is_empty()) {
+            scratch.heap.remove_min();
+        }
+
+        // Each thread writes only the rows it claimed, so no two threads write the same cells
+        Type* row_cells = cells.data() + row * targets.size();
+        for (size_t column = 0; column < targets.size(); column++) {
+            row_cells[column] = scratch.distances[targets[column]];
+        }
+        for (unsigned int vertex : scratch.touched) {
+            scratch.distances[vertex] = unreachable_distance<Type>();
+        }
+        scratch.touched.clear();
+        return row_settled;
+    }
+
+    /// @brief IDs of the source verticies, one per row
+    std::pmr::vector<unsigned int> sources;
+    /// @brief IDs of the target verticies, one per column
+    std::pmr::vector<unsigned int> targets;
+    /// @brief Row-major distances from each source vertex to each target vertex
+    std::pmr::vector<Type> cells;
+    /// @brief Total number of verticies settled by the searches of all rows
+    unsigned long settled_count;
+};
@@ -0,0 +1,550 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "indexed_graph.hpp"
+
+
+/**
+ * Single edge of the spanning forest held by `dynamic_mst`
+ * @tparam Type typename of the edge weights of the graph
+ */
+template <class Type>
+struct spanning_edge {
+    /// @brief ID of the lower-numbered vertex of the edge
+    unsigned int first;
+    /// @brief ID of the higher-numbered vertex of the edge
+    unsigned int second;
+    /// @brief Weight of the edge
+    Type weight;
+};
+
+
+/**
+ * Minimum spanning forest kept current while edges are added or made lighter, without running Prim's or Kruskal's algorithm
+ * over the whole graph again: a new edge joining two trees is added to the forest, and a new edge within a tree replaces the
+ * heaviest edge on the tree path between its verticies if that edge is heavier
+ * @tparam Type typename of the edge weights of the graph
+ *
+ * The forest is held as a link-cut tree, where each forest edge is a node of its own between the nodes of its two verticies,
+ * so that linking, cutting and finding the heaviest edge on the path between two verticies each take amortized logarithmic time.
+ * Every node belongs to a splay tree of the nodes along a preferred path, ordered by depth, and every splay tree node records the
+ * node of the heaviest edge within its subtree
+ *
+ * @note Only additions and weight decreases are supported, as a heavier tree edge may need to be replaced by any non-tree edge,
+ * which are not stored
+ * @note All storage is allocated from the `std::pmr::memory_resource` provided on construction
+ */
+template <class Type>
+class dynamic_mst final {
+public:
+    // Constructor creates an empty forest, allocating all storage from `resource`
+    dynamic_mst(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): nodes{resource}, edge_ends{resource},
+        free_edges{resource}, tree_edges{resource}, splay_path{resource}, vertex_count(0), total_weight(0), replacement_count(0) {}
+
+
+    /**
+         * Replaces the calling `dynamic_mst` with the minimum spanning forest of `graph`, found by Kruskal's algorithm
+         * @param graph Graph whose edges are stored in both directions with equal weights (as done by `build_adjacency_list`)
+         * (an edge stored in one direction only is treated as undirected)
+         */
+    void build(const indexed_graph<Type>& graph) {
+        nodes.clear();
+        edge_ends.clear();
+        free_edges.clear();
+        tree_edges.clear();
+        total_weight = 0;
+        replacement_count = 0;
+        vertex_count = 0;
+        add_verticies(graph.get_vertex_count());
+        std::vector<std::tuple<Type, unsigned int, unsigned int>> edges;
+        for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+            for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                if (vertex < adjacent_edge.target || (vertex > adjacent_edge.target && !graph.contains_edge(adjacent_edge.target, vertex))) {
+                    edges.emplace_back(adjacent_edge.weight, std::min(vertex, adjacent_edge.target), std::max(vertex, adjacent_edge.target));
+                }
+            }
+        }
+        // Equal weights are ordered by vertex IDs so the forest does not depend on the order edges were added
+        std::sort(edges.begin(), edges.end());
+        for (const auto& [weight, first, second] : edges) {
+            if (find_root(first) != find_root(second)) {
+                add_tree_edge(first, second, weight);
+            }
+        }
+    }
+
+
+    /**
+         * Adds the undirected edge between `first` and `second` with weight `weight` to the graph the forest spans, adding it to
+         * the forest if it joins two trees or replaces a heavier edge on the tree path between its verticies
+         * @param first ID of one vertex of the edge (verticies beyond the current count are added)
+         * @param second ID of the other vertex of the edge
+         * @param weight Weight of the edge
+         * @return `true` if the forest changed, else `false`
+         * @note An edge already within the forest keeps the lighter of its current and new weights
+         */
+    bool insert_edge(unsigned int first, unsigned int second, Type weight) {
+        if (first == second) {
+            return false;
+        }
+        add_verticies(std::max(first, second) + 1);
+        auto existing = tree_edges.find(edge_key(first, second));
+        if (existing != tree_edges.end()) {
+            if (!(weight < nodes[existing->second].weight)) {
+                return false;
+            }
+            set_tree_weight(existing->second, weight);
+            return true;
+        }
+        if (find_root(first) != find_root(second)) {
+            add_tree_edge(first, second, weight);
+            return true;
+        }
+        unsigned int heaviest = path_maximum(first, second);
+        if (!(weight < nodes[heaviest].weight)) {
+            return false;
+        }
+        remove_tree_edge(heaviest);
+        add_tree_edge(first, second, weight);
+        replacement_count++;
+        return true;
+    }
+
+
+    /**
+         * Lowers the weight of the undirected edge between `first` and `second` to `weight`, adjusting the forest as required
+         * @param first ID of one vertex of the edge
+         * @param second ID of the other vertex of the edge
+         * @param weight New weight of the edge
+         * @return `true` if the forest changed, else `false`
+         * @throws `std::runtime_error` if the edge belongs to the forest and `weight` exceeds its current weight
+         */
+    bool decrease_weight(unsigned int first, unsigned int second, Type weight) {
+        auto existing = tree_edges.find(edge_key(first, second));
+        if (existing != tree_edges.end() && nodes[existing->second].weight < weight) {
+            throw std::runtime_error("ERROR: Weights of minimum spanning tree edges may only be decreased!");
+        }
+        // A non-tree edge made lighter enters the forest exactly as a new edge of that weight would
+        return insert_edge(first, second, weight);
+    }
+
+
+    /**
+         * Determines whether a path exists between `first` and `second` within the graph the forest spans
+         * @param first ID of one vertex
+         * @param second ID of the other vertex
+         * @return `true` if both verticies belong to the same tree, else `false`
+         */
+    bool connected(unsigned int first, unsigned int second) {
+        return find_root(first) == find_root(second);
+    }
+
+
+    /**
+         * Retrieves the heaviest edge on the forest path between `first` and `second`
+         * @param first ID of one vertex
+         * @param second ID of the other vertex
+         * @return Verticies and weight of the heaviest edge
+         * @throws `std::runtime_error` if the verticies are equal or belong to different trees
+         */
+    spanning_edge<Type> get_path_maximum(unsigned int first, unsigned int second) {
+        if (first == second || find_root(first) != find_root(second)) {
+            throw std::runtime_error("ERROR: No forest path with any edges joins the verticies!");
+        }
+        unsigned int heaviest = path_maximum(first, second);
+        return spanning_edge<Type>{edge_ends[heaviest - vertex_count].first, edge_ends[heaviest - vertex_count].second,
+            nodes[heaviest].weight};
+    }
+
+
+    /**
+         * Retrieves the sum of the weights of every forest edge (`MST_sum` of `find_MST` for a connected graph)
+         * @return Total weight of the forest
+         */
+    Type get_total_weight() const {
+        return total_weight;
+    }
+
+
+    /**
+         * Retrieves the number of edges within the forest
+         * @return Number of forest edges (one less than the number of verticies for a connected graph)
+         */
+    size_t get_edge_count() const {
+        return tree_edges.size();
+    }
+
+
+    /**
+         * Retrieves the number of verticies spanned by the forest
+         * @return Number of verticies
+         */
+    unsigned int get_vertex_count() const {
+        return vertex_count;
+    }
+
+
+    /**
+         * Retrieves the number of forest edges replaced by lighter edges since the forest was built
+         * @return Number of replaced edges
+         */
+    unsigned long get_replacement_count() const {
+        return replacement_count;
+    }
+
+
+    /**
+         * Retrieves every edge of the forest
+         * @return Forest edges ordered by their lower and then higher vertex IDs
+         */
+    std::vector<spanning_edge<Type>> get_edges() const {
+        std::vector<spanning_edge<Type>> edges;
+        edges.reserve(tree_edges.size());
+        for (const auto& tree_edge : tree_edges) {
+            const auto& ends = edge_ends[tree_edge.second - vertex_count];
+            edges.push_back(spanning_edge<Type>{ends.first, ends.second, nodes[tree_edge.second].weight});
+        }
+        std::sort(edges.begin(), edges.end(), [](const spanning_edge<Type>& a, const spanning_edge<Type>& b) {
+            return a.first < b.first || (a.first == b.first && a.second < b.second);
+        });
+        return edges;
+    }
+
+private:
+    /// @brief Node of the link-cut tree, standing for either a vertex or a forest edge
+    struct lct_node {
+        /// @brief Children within the splay tree of the node's preferred path
+        unsigned int children[2] = {name_arena::invalid_id, name_arena::invalid_id};
+        /// @brief Splay tree parent, or the node continuing the path above the splay tree's topmost node (path parent)
+        unsigned int parent = name_arena::invalid_id;
+        /// @brief Weight of the edge (unused by vertex nodes)
+        Type weight{};
+        /// @brief Node of the heaviest edge within the splay subtree of the node (`name_arena::invalid_id` if it holds no edges)
+        unsigned int heaviest = name_arena::invalid_id;
+        /// @brief Whether the children of every node in the splay subtree are to be swapped (reversing the path)
+        bool reversed = false;
+    };
+
+
+    /**
+         * Builds the key identifying the undirected edge between two verticies
+         * @param first ID of one vertex
+         * @param second ID of the other vertex
+         * @return Lower vertex ID in the upper 32 bits and higher vertex ID in the lower 32 bits
+         */
+    static std::uint64_t edge_key(unsigned int first, unsigned int second) {
+        return (static_cast<std::uint64_t>(std::min(first, second)) << 32) | std::max(first, second);
+    }
+
+
+    /**
+         * Adds vertex nodes until the forest spans `count` verticies, moving existing edge nodes above them
+         * @param count Number of verticies to be spanned
+         */
+    void add_verticies(unsigned int count) {
+        if (count <= vertex_count) {
+            return;
+        }
+        unsigned int shift = count - vertex_count;
+        // Edge nodes follow every vertex node, so every reference to an edge node moves up by the number of new verticies
+        auto moved = [&](unsigned int node) {
+            return node != name_arena::invalid_id && node >= vertex_count ? node + shift : node;
+        };
+        std::pmr::vector<lct_node> resized(count + edge_ends.size(), nodes.get_allocator().resource());
+        for (unsigned int node = 0; node < nodes.size(); node++) {
+            lct_node copy = nodes[node];
+            copy.children[0] = moved(copy.children[0]);
+            copy.children[1] = moved(copy.children[1]);
+            copy.parent = moved(copy.parent);
+            copy.heaviest = moved(copy.heaviest);
+            resized[moved(node)] = copy;
+        }
+        nodes.swap(resized);
+        for (auto& tree_edge : tree_edges) {
+            tree_edge.second += shift;
+        }
+        for (auto& free_edge : free_edges) {
+            free_edge += shift;
+        }
+        vertex_count = count;
+    }
+
+
+    /**
+         * Determines whether `node` is the topmost node of its splay tree
+         * @param node Node to be checked
+         * @return `true` if `node` has no splay tree parent, else `false`
+         */
+    bool is_splay_root(unsigned int node) const {
+        unsigned int parent = nodes[node].parent;
+        return parent == name_arena::invalid_id || (nodes[parent].children[0] != node && nodes[parent].children[1] != node);
+    }
+
+
+    /**
+         * Selects the node of the heavier edge
+         * @param a Node of an edge (or `name_arena::invalid_id`)
+         * @param b Node of an edge (or `name_arena::invalid_id`)
+         * @return Node of the heavier edge, preferring `a` on equal weights
+         */
+    unsigned int heavier(unsigned int a, unsigned int b) const {
+        if (a == name_arena::invalid_id) {
+            return b;
+        }
+        if (b == name_arena::invalid_id) {
+            return a;
+        }
+        return nodes[b].weight > nodes[a].weight ? b : a;
+    }
+
+
+    /**
+         * Recomputes the heaviest edge within the splay subtree of `node` from its children
+         * @param node Node to be updated
+         */
+    void update(unsigned int node) {
+        lct_node& current = nodes[node];
+        unsigned int heaviest = node >= vertex_count ? node : name_arena::invalid_id;
+        for (unsigned int child : current.children) {
+            if (child != name_arena::invalid_id) {
+                heaviest = heavier(heaviest, nodes[child].heaviest);
+            }
+        }
+        current.heaviest = heaviest;
+    }
+
+
+    /**
+         * Applies a pending reversal of `node` to its children
+         * @param node Node whose reversal is pushed down
+         */
+    void push_down(unsigned int node) {
+        lct_node& current = nodes[node];
+        if (!current.reversed) {
+            return;
+        }
+        std::swap(current.children[0], current.children[1]);
+        for (unsigned int child : current.children) {
+            if (child != name_arena::invalid_id) {
+                nodes[child].reversed = !nodes[child].reversed;
+            }
+        }
+        current.reversed = false;
+    }
+
+
+    /**
+         * Rotates `node` above its splay tree parent
+         * @param node Node to be rotated
+         */
+    void rotate(unsigned int node) {
+        unsigned int parent = nodes[node].parent;
+        unsigned int grandparent = nodes[parent].parent;
+        int side = nodes[parent].children[1] == node ? 1 : 0;
+        unsigned int inner = nodes[node].children[1 - side];
+        if (!is_splay_root(parent)) {
+            nodes[grandparent].children[nodes[grandparent].children[1] == parent ? 1 : 0] = node;
+        }
+        nodes[node].parent = grandparent;
+        nodes[node].children[1 - side] = parent;
+        nodes[parent].parent = node;
+        nodes[parent].children[side] = inner;
+        if (inner != name_arena::invalid_id) {
+            nodes[inner].parent = parent;
+        }
+        update(parent);
+        update(node);
+    }
+
+
+    /**
+         * Moves `node` to the top of its splay tree, after pushing down every pending reversal above it
+         * @param node Node to be splayed
+         */
+    void splay(unsigned int node) {
+        splay_path.clear();
+        for (unsigned int ancestor = node; ; ancestor = nodes[ancestor].parent) {
+            splay_path.push_back(ancestor);
+            if (is_splay_root(ancestor)) {
+                break;
+            }
+        }
+        for (auto ancestor = splay_path.rbegin(); ancestor != splay_path.rend(); ++ancestor) {
+            push_down(*ancestor);
+        }
+        while (!is_splay_root(node)) {
+            unsigned int parent = nodes[node].parent;
+            if (!is_splay_root(parent)) {
+                unsigned int grandparent = nodes[parent].parent;
+                bool zig_zig = (nodes[grandparent].children[1] == parent) == (nodes[parent].children[1] == node);
+                rotate(zig_zig ? parent : node);
+            }
+            rotate(node);
+        }
+    }
+
+
+    /**
+         * Makes the path from the root of the tree of `node` down to `node` the preferred path, held by a single splay tree
+         * topped by `node`
+         * @param node Node to be accessed
+         */
+    void access(unsigned int node) {
+        unsigned int below = name_arena::invalid_id;
+        for (unsigned int current = node; current != name_arena::invalid_id; current = nodes[current].parent) {
+            splay(current);
+            nodes[current].children[1] = below;
+            update(current);
+            below = current;
+        }
+        splay(node);
+    }
+
+
+    /**
+         * Makes `node` the root of its tree by reversing the path from the current root to it
+         * @param node Node to become the root
+         */
+    void make_root(unsigned int node) {
+        access(node);
+        nodes[node].reversed = !nodes[node].reversed;
+    }
+
+
+    /**
+         * Locates the root of the tree holding `node`
+         * @param node Node whose tree is searched
+         * @return ID of the root node
+         */
+    unsigned int find_root(unsigned int node) {
+        access(node);
+        unsigned int root = node;
+        push_down(root);
+        while (nodes[root].children[0] != name_arena::invalid_id) {
+            root = nodes[root].children[0];
+            push_down(root);
+        }
+        splay(root);
+        return root;
+    }
+
+
+    /**
+         * Locates the heaviest edge on the tree path between two verticies of the same tree
+         * @param first ID of one vertex
+         * @param second ID of the other vertex
+         * @return Node of the heaviest edge
+         */
+    unsigned int path_maximum(unsigned int first, unsigned int second) {
+        make_root(first);
+        access(second);
+        return nodes[second].heaviest;
+    }
+
+
+    /**
+         * Adds a forest edge between two verticies of different trees
+         * @param first ID of one vertex
+         * @param second ID of the other vertex
+         * @param weight Weight of the edge
+         */
+    void add_tree_edge(unsigned int first, unsigned int second, Type weight) {
+        unsigned int edge_node = 0;
+        if (free_edges.empty()) {
+            edge_node = static_cast<unsigned int>(nodes.size());
+            nodes.emplace_back();
+            edge_ends.emplace_back();
+        } else {
+            edge_node = free_edges.back();
+            free_edges.pop_back();
+            nodes[edge_node] = lct_node{};
+        }
+        nodes[edge_node].weight = weight;
+        nodes[edge_node].heaviest = edge_node;
+        edge_ends[edge_node - vertex_count] = std::make_pair(std::min(first, second), std::max(first, second));
+        tree_edges.emplace(edge_key(first, second), edge_node);
+        link(first, edge_node);
+        link(edge_node, second);
+        total_weight += weight;
+    }
+
+
+    /**
+         * Removes a forest edge, splitting its tree in two
+         * @param edge_node Node of the edge
+         */
+    void remove_tree_edge(unsigned int edge_node) {
+        const auto& ends = edge_ends[edge_node - vertex_count];
+        cut(ends.first, edge_node);
+        cut(edge_node, ends.second);
+        tree_edges.erase(edge_key(ends.first, ends.second));
+        total_weight -= nodes[edge_node].weight;
+        free_edges.push_back(edge_node);
+    }
+
+
+    /**
+         * Changes the weight of a forest edge in place
+         * @param edge_node Node of the edge
+         * @param weight New weight of the edge
+         */
+    void set_tree_weight(unsigned int edge_node, Type weight) {
+        access(edge_node);
+        total_weight -= nodes[edge_node].weight;
+        nodes[edge_node].weight = weight;
+        total_weight += weight;
+        update(edge_node);
+    }
+
+
+    /**
+         * Joins the trees of two nodes by making `child` the root of its tree and attaching it below `parent`
+         * @param child Node of one tree
+         * @param parent Node of another tree
+         */
+    void link(unsigned int child, unsigned int parent) {
+        make_root(child);
+        nodes[child].parent = parent;
+    }
+
+
+    /**
+         * Removes the tree link between two adjacent nodes
+         * @param first Node of one end of the link
+         * @param second Node of the other end of the link
+         */
+    void cut(unsigned int first, unsigned int second) {
+        make_root(first);
+        access(second);
+        // With `first` as root, it is the only node above `second` on the accessed path
+        nodes[second].children[0] = name_arena::invalid_id;
+        nodes[first].parent = name_arena::invalid_id;
+        update(second);
+    }
+
+    /// @brief Nodes of every vertex (IDs below `vertex_count`) followed by the nodes of every forest edge slot
+    std::pmr::vector<lct_node> nodes;
+    /// @brief Lower and higher vertex IDs of each edge slot, indexed by edge node ID minus `vertex_count`
+    std::pmr::vector<std::pair<unsigned int, unsigned int>> edge_ends;
+    /// @brief Edge node IDs no longer holding a forest edge
+    std::pmr::vector<unsigned int> free_edges;
+    /// @brief Node of every forest edge, keyed by `edge_key` of its verticies
+    std::pmr::unordered_map<std::uint64_t, unsigned int> tree_edges;
+    /// @brief Nodes from a splayed node up to the top of its splay tree, reused by every splay
+    std::pmr::vector<unsigned int> splay_path;
+    /// @brief Number of verticies spanned by the forest
+    unsigned int vertex_count;
+    /// @brief Sum of the weights of every forest edge
+    Type total_weight;
+    /// @brief Number of forest edges replaced by lighter edges since the forest was built
+    unsigned long replacement_count;
+};
@@ -1,6 +1,20 @@
 #pragma once
 
+#include <string>
+
 #include "derived_hashmap.hpp"
+#include "indexed_graph.hpp"
+
+
+/// @brief Type in which the edge weights and distances of a graph are stored (see `detect_weight_type`)
+enum class weight_type {
+    /// @brief `std::uint32_t`, for whole weights
+    unsigned_integer,
+    /// @brief `float`, for weights with few binary digits after the point
+    single_precision,
+    /// @brief `double`, for all other weights
+    double_precision
+};
 
 /**
  * Prompts user for name of text file found within `directory` to be processed for graphical information,
@@ -23,27 +37,65 @@ extern int get_graph_filename(std::string& directory_name, std::string& user_fil
 extern int get_graph_vertex_count(long int& vertex_count, std::string& read_name);
 
 
+/**
+ * Reads the edge weight of every line of `read_name` to choose the narrowest type that stores the weights and the length of any
+ * path between two verticies exactly (bounded by the sum of all weights, as a path uses each edge at most once), so that every
+ * distance and cost matches the one computed with `double` weights: `std::uint32_t` for whole weights, `float` for weights that
+ * are multiples of a power of two no smaller than the precision of `float` allows, and `double` otherwise
+ * @param read_name Relative path to the text file selected by the user
+ * @return Type for the edge weights of the graph (`weight_type::double_precision` if the file cannot be read or holds any
+ * malformed line, which is then reported by `build_adjacency_list`)
+ */
+extern weight_type detect_weight_type(const std::string& read_name);
+
+
 /**
  * Prompts user for the identities of the source and destination verticies from which to generate the shortest path, and upon
  * receiving two valid verticies found within the file selected by the user for processing, passes these verticies, the
- * customized hashmap container, `main`, which holds all edge and vertex information extracted from the user-selected text file,
+ * ID-indexed graph container, `main`, which holds all edge and vertex information extracted from the user-selected text file,
  * `graph_filename` and the file to be written in the dot language format used for visualization of the shortest path, `path_filename`
- * @param main Customized hashmap-like container storing all of the graphical information extracted from the user-selected text file
+ * @tparam Type typename of the edge weights of `main` (instantiated within graph_input.cpp for `double`, `float` and `std::uint32_t`)
+ * @param main ID-indexed adjacency list storing all of the graphical information extracted from the user-selected text file
  * @param graph_filename Relative path to text file containing all graphical edges comprising of graph to be processed by program
  * @param path_filename Relative path to text file used for writing shortest path in dot language format for subsequent visualization
+ * @param saved_path Relative path to the selected text file, to which `contraction_hierarchy<Type>::file_extension`,
+ * `landmark_table<Type>::file_extension` and `all_pairs_table<Type>::file_extension` are appended to name the files holding the
+ * contraction hierarchy, landmark tables and all-pairs table of the selected graph, which are loaded if they were built from the same graph, or else built and saved for subsequent queries
+ * @param landmark_search `true` to answer the query by an A* search over landmark tables (ALT), else the engine is chosen by the
+ * size and weights of `main` (breadth-first search, all-pairs table or contraction hierarchy)
  * @return 0 if successful, -1 upon failure  
  */
-extern int get_shortest_path(main_hashmap<double>&& main, const std::string& graph_filename, const std::string& path_filename);
+template <class Type>
+int get_shortest_path(indexed_graph<Type>&& main, const std::string& graph_filename, const std::string& path_filename, const std::string& saved_path,
+    bool landmark_search = false);
+
+
+/**
+ * Prompts user for the identities of the source and destination verticies and for the number of alternative paths, `k`, and upon receiving two
+ * valid verticies found within the file selected by the user for processing and a positive number of paths, passes these values, the ID-indexed
+ * graph container, `main`, `graph_filename` and `path_filename` to the function finding and visualizing the `k` shortest loopless paths
+ * @tparam Type typename of the edge weights of `main` (instantiated within graph_input.cpp for `double`, `float` and `std::uint32_t`)
+ * @param main ID-indexed adjacency list storing all of the graphical information extracted from the user-selected text file
+ * @param graph_filename Relative path to text file containing all graphical edges comprising of graph to be processed by program
+ * @param path_filename Relative path to text file used for writing all found paths in dot language format for subsequent visualization
+ * @return 0 if successful, -1 upon failure
+ */
+template <class Type>
+int get_k_shortest_paths(indexed_graph<Type>&& main, const std::string& graph_filename, const std::string& path_filename);
 
 
 /**
  * Prompts user for the desired type of information to be extracted and visualized from the selected text file of graphical information,
  * and upon receiving a valid response, stores the response in `algorithm_type` to be passed to the appropriate function(s) for generating
  * requested type of information and visualizing this information.
+ * @tparam Type typename of the edge weights of `main` (instantiated within graph_input.cpp for `double`, `float` and `std::uint32_t`)
  * @param algorithm_type User-provided type of requested information to be provided using the selected file of graphical information
  * @param main Container holding all graphical information extracted from text file selected by user for processing
  * @param graph_filename Relative path to user-selected text file containing the graphical information to be processed by the program
  * @param path_file Relative path to text file to which the shortest path will be written to in dot language, if requested by the user
  * @param MST_filename Relative path to text file to which the Minimum Spanning Tree will be written to in dot language format, if requested by the user
+ * @param saved_path Relative path to the selected text file, naming the files saved for shortest path queries (see `get_shortest_path`)
  */
-extern int get_requested_algorithm (std::string& algorithm_type, main_hashmap<double>&& main, const std::string& graph_filename, const std::string& path_filename, const std::string& MST_filename);
\ No newline at end of file
+template <class Type>
+int get_requested_algorithm (std::string& algorithm_type, indexed_graph<Type>&& main, const std::string& graph_filename, const std::string& path_filename, const std::string& MST_filename,
+    const std::string& saved_path);
\ No newline at end of file
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <vector>
+
+#include "indexed_graph.hpp"
+
+
+/// @brief Fraction by which the total vertex weight of a region may exceed an equal share once regions are refined
+inline constexpr double partition_imbalance = 0.1;
+/// @brief Number of passes over the boundary verticies of each level that move verticies towards better connected regions
+inline constexpr unsigned int partition_refine_passes = 4;
+
+
+/**
+ * Level of the multilevel partitioner: an undirected graph held in compressed sparse row form, whose verticies stand for
+ * groups of verticies of the level below (weighted by group size) and whose edges are weighted by the number of edges joining
+ * the groups
+ */
+struct partition_level {
+    /// @brief Position of the first neighbor of each vertex within `targets` (followed by the total number of neighbors)
+    std::pmr::vector<unsigned int> offsets;
+    /// @brief Neighbors of every vertex, listed vertex by vertex
+    std::pmr::vector<unsigned int> targets;
+    /// @brief Number of edges of the original graph joining each vertex to its neighbor at the same position within `targets`
+    std::pmr::vector<unsigned int> edge_weights;
+    /// @brief Number of verticies of the original graph grouped within each vertex
+    std::pmr::vector<unsigned int> vertex_weights;
+    /// @brief Vertex of the next coarser level holding each vertex (empty for the coarsest level)
+    std::pmr::vector<unsigned int> coarse_ids;
+
+    // Constructor creates an empty level, allocating all storage from `resource`
+    partition_level(std::pmr::memory_resource* resource): offsets{resource}, targets{resource}, edge_weights{resource},
+        vertex_weights{resource}, coarse_ids{resource} {}
+
+    /// @brief Retrieves the number of verticies of the level
+    unsigned int vertex_count() const {
+        return static_cast<unsigned int>(vertex_weights.size());
+    }
+};
+
+
+/**
+ * Builds the next coarser level of `fine` by matching every vertex with its unmatched neighbor joined by the heaviest edge
+ * (heavy-edge matching), visiting verticies of low degree first so that few verticies are left without a partner
+ * @param fine Level to be coarsened, whose `coarse_ids` are filled with the matching
+ * @param resource Memory resource supplying all storage of the coarser level and the scratch arrays
+ * @return Coarser level, holding one vertex for every matched pair and every unmatched vertex of `fine`
+ */
+inline partition_level coarsen_partition_level(partition_level& fine, std::pmr::memory_resource* resource) {
+    unsigned int fine_count = fine.vertex_count();
+    std::pmr::vector<unsigned int> visit_order(fine_count, 0, resource);
+    for (unsigned int vertex = 0; vertex < fine_count; vertex++) {
+        visit_order[vertex] = vertex;
+    }
+    std::stable_sort(visit_order.begin(), visit_order.end(), [&fine](unsigned int a, unsigned int b) {
+        return fine.offsets[a + 1] - fine.offsets[a] < fine.offsets[b + 1] - fine.offsets[b];
+    });
+    fine.coarse_ids.assign(fine_count, name_arena::invalid_id);
+    unsigned int coarse_count = 0;
+    for (unsigned int vertex : visit_order) {
+        if (fine.coarse_ids[vertex] != name_arena::invalid_id) {
+            continue;
+        }
+        unsigned int partner = name_arena::invalid_id;
+        unsigned int partner_weight = 0;
+        for (unsigned int i = fine.offsets[vertex]; i < fine.offsets[vertex + 1]; i++) {
+            unsigned int neighbor = fine.targets[i];
+            if (neighbor != vertex && fine.coarse_ids[neighbor] == name_arena::invalid_id && fine.edge_weights[i] > partner_weight) {
+                partner = neighbor;
+                partner_weight = fine.edge_weights[i];
+            }
+        }
+        fine.coarse_ids[vertex] = coarse_count;
+        if (partner != name_arena::invalid_id) {
+            fine.coarse_ids[partner] = coarse_count;
+        }
+        coarse_count++;
+    }
+
+    // Edges between the same pair of groups are merged, and edges within a group disappear
+    partition_level coarse(resource);
+    coarse.vertex_weights.assign(coarse_count, 0);
+    std::pmr::vector<std::pmr::vector<unsigned int>> members(coarse_count, resource);
+    for (unsigned int vertex = 0; vertex < fine_count; vertex++) {
+        coarse.vertex_weights[fine.coarse_ids[vertex]] += fine.vertex_weights[vertex];
+        members[fine.coarse_ids[vertex]].push_back(vertex);
+    }
+    std::pmr::vector<unsigned int> neighbor_position(coarse_count, name_arena::invalid_id, resource);
+    coarse.offsets.reserve(coarse_count + 1);
+    coarse.offsets.push_back(0);
+    for (unsigned int group = 0; group < coarse_count; group++) {
+        auto group_first = static_cast<unsigned int>(coarse.targets.size());
+        for (unsigned int vertex : members[group]) {
+            for (unsigned int i = fine.offsets[vertex]; i < fine.offsets[vertex + 1]; i++) {
+                unsigned int neighbor_group = fine.coarse_ids[fine.targets[i]];
+                if (neighbor_group == group) {
+                    continue;
+                }
+                if (neighbor_position[neighbor_group] == name_arena::invalid_id || neighbor_position[neighbor_group] < group_first) {
+                    neighbor_position[neighbor_group] = static_cast<unsigned int>(coarse.targets.size());
+                    coarse.targets.push_back(neighbor_group);
+                    coarse.edge_weights.push_back(0);
+                }
+                coarse.edge_weights[neighbor_position[neighbor_group]] += fine.edge_weights[i];
+            }
+        }
+        coarse.offsets.push_back(static_cast<unsigned int>(coarse.targets.size()));
+    }
+    return coarse;
+}
+
+
+/**
+ * Moves boundary verticies of `level` to the neighboring region they share the heaviest edges with, whenever this removes more
+ * edge weight from the cut than it adds and the receiving region stays within `max_region_weight`
+ * @param level Level whose verticies are assigned to regions
+ * @param regions Region of each vertex of `level`, updated in place
+ * @param region_weights Total vertex weight of each region, updated in place
+ * @param max_region_weight Largest total vertex weight a region may receive
+ * @param resource Memory resource supplying the scratch arrays
+ */
+inline void refine_partition_level(const partition_level& level, std::pmr::vector<unsigned int>& regions,
+    std::pmr::vector<unsigned int>& region_weights, unsigned int max_region_weight, std::pmr::memory_resource* resource) {
+    std::pmr::vector<unsigned int> connection(region_weights.size(), 0, resource);
+    std::pmr::vector<unsigned int> touched(resource);
+    for (unsigned int pass = 0; pass < partition_refine_passes; pass++) {
+        unsigned int move_count = 0;
+        for (unsigned int vertex = 0; vertex < level.vertex_count(); vertex++) {
+            unsigned int own = regions[vertex];
+            touched.clear();
+            for (unsigned int i = level.offsets[vertex]; i < level.offsets[vertex + 1]; i++) {
+                unsigned int region = regions[level.targets[i]];
+                if (connection[region] == 0) {
+                    touched.push_back(region);
+                }
+                connection[region] += level.edge_weights[i];
+            }
+            unsigned int best = own;
+            for (unsigned int region : touched) {
+                if (connection[region] > connection[best] && region_weights[region] + level.vertex_weights[vertex] <= max_region_weight) {
+                    best = region;
+                }
+            }
+            // A region is never emptied, so every region keeps at least one vertex
+            if (best != own && region_weights[own] > level.vertex_weights[vertex]) {
+                regions[vertex] = best;
+                region_weights[own] -= level.vertex_weights[vertex];
+                region_weights[best] += level.vertex_weights[vertex];
+                move_count++;
+            }
+            for (unsigned int region : touched) {
+                connection[region] = 0;
+            }
+        }
+        if (move_count == 0) {
+            break;
+        }
+    }
+}
+
+
+/**
+ * Divides the verticies of `graph` into `region_count` regions of similar size joined by few edges, with a multilevel scheme:
+ * the graph is repeatedly coarsened by heavy-edge matching, the coarsest graph is cut into consecutive runs of its breadth-first
+ * order, and the regions are projected back level by level while boundary verticies move to better connected regions
+ * @tparam Type typename of the edge weights of the graph (edge weights are ignored, every edge counts once)
+ * @param graph Graph to be partitioned (for directed graphs, edges in either direction join verticies alike)
+ * @param region_count Number of regions (limited to the number of verticies of `graph`)
+ * @param regions Filled with the region (within [0, `region_count`)) of each vertex, indexed by vertex ID
+ * @return Number of directed edges of `graph` whose verticies lie within different regions
+ * @throws `std::runtime_error` if `region_count` is 0
+ */
+template <class Type>
+size_t partition_graph(const indexed_graph<Type>& graph, unsigned int region_count, std::pmr::vector<unsigned int>& regions) {
+    if (region_count == 0) {
+        throw std::runtime_error("ERROR: A graph can only be partitioned into at least one region!");
+    }
+    auto vertex_count = graph.get_vertex_count();
+    regions.assign(vertex_count, 0);
+    region_count = std::min(region_count, vertex_count);
+    if (region_count <= 1) {
+        return 0;
+    }
+    auto* resource = regions.get_allocator().resource();
+
+    // The finest level holds every edge in both directions, so that edges stored in a single direction still join their verticies
+    std::pmr::vector<partition_level> levels(resource);
+    levels.emplace_back(resource);
+    {
+        std::pmr::vector<std::pmr::vector<unsigned int>> neighbors(vertex_count, resource);
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                if (adjacent_edge.target != vertex) {
+                    neighbors[vertex].push_back(adjacent_edge.target);
+                    neighbors[adjacent_edge.target].push_back(vertex);
+                }
+            }
+        }
+        auto& finest = levels.back();
+        finest.vertex_weights.assign(vertex_count, 1);
+        finest.offsets.push_back(0);
+        for (auto& vertex_neighbors : neighbors) {
+            std::sort(vertex_neighbors.begin(), vertex_neighbors.end());
+            for (size_t i = 0; i < vertex_neighbors.size(); i++) {
+                if (i > 0 && vertex_neighbors[i] == vertex_neighbors[i - 1]) {
+                    finest.edge_weights.back()++;
+                } else {
+                    finest.targets.push_back(vertex_neighbors[i]);
+                    finest.edge_weights.push_back(1);
+                }
+            }
+            finest.offsets.push_back(static_cast<unsigned int>(finest.targets.size()));
+        }
+    }
+    // Coarsening stops once few verticies remain for each region, or once matching stops shrinking the graph
+    unsigned int coarsest_target = std::max(region_count * 8, 64U);
+    while (levels.back().vertex_count() > coarsest_target) {
+        partition_level coarse = coarsen_partition_level(levels.back(), resource);
+        if (coarse.vertex_count() * 10 > levels.back().vertex_count() * 9) {
+            levels.back().coarse_ids.clear();
+            break;
+        }
+        levels.push_back(std::move(coarse));
+    }
+
+    // Consecutive runs of a breadth-first order of the coarsest level receive equal shares of the total vertex weight
+    const auto& coarsest = levels.back();
+    std::pmr::vector<unsigned int> level_regions(coarsest.vertex_count(), name_arena::invalid_id, resource);
+    std::pmr::vector<unsigned int> region_weights(region_count, 0, resource);
+    std::pmr::vector<unsigned int> queue(resource);
+    queue.reserve(coarsest.vertex_count());
+    std::pmr::vector<unsigned char> queued(coarsest.vertex_count(), 0, resource);
+    for (unsigned int start = 0; start < coarsest.vertex_count(); start++) {
+        if (queued[start] != 0) {
+            continue;
+        }
+        queued[start] = 1;
+        queue.push_back(start);
+        for (size_t head = queue.size() - 1; head < queue.size(); head++) {
+            unsigned int vertex = queue[head];
+            for (unsigned int i = coarsest.offsets[vertex]; i < coarsest.offsets[vertex + 1]; i++) {
+                if (queued[coarsest.targets[i]] == 0) {
+                    queued[coarsest.targets[i]] = 1;
+                    queue.push_back(coarsest.targets[i]);
+                }
+            }
+        }
+    }
+    unsigned long assigned_weight = 0;
+    unsigned int region = 0;
+    for (size_t position = 0; position < queue.size(); position++) {
+        unsigned int vertex = queue[position];
+        // The next region starts once the earlier regions hold their shares, or once each later region needs one of the remaining verticies
+        size_t remaining_count = queue.size() - position;
+        if (region + 1 < region_count && region_weights[region] > 0 && (assigned_weight * region_count >= (region + 1UL) * vertex_count ||
+            remaining_count <= region_count - 1 - region)) {
+            region++;
+        }
+        level_regions[vertex] = region;
+        region_weights[region] += coarsest.vertex_weights[vertex];
+        assigned_weight += coarsest.vertex_weights[vertex];
+    }
+
+    auto max_region_weight = static_cast<unsigned int>(static_cast<double>(vertex_count) / region_count * (1 + partition_imbalance)) + 1;
+    refine_partition_level(coarsest, level_regions, region_weights, max_region_weight, resource);
+    for (size_t level = levels.size() - 1; level > 0; level--) {
+        const auto& fine = levels[level - 1];
+        std::pmr::vector<unsigned int> fine_regions(fine.vertex_count(), 0, resource);
+        for (unsigned int vertex = 0; vertex < fine.vertex_count(); vertex++) {
+            fine_regions[vertex] = level_regions[fine.coarse_ids[vertex]];
+        }
+        level_regions = std::move(fine_regions);
+        refine_partition_level(fine, level_regions, region_weights, max_region_weight, resource);
+    }
+    regions = std::move(level_regions);
+
+    size_t cut_count = 0;
+    for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+        for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+            if (regions[vertex] != regions[adjacent_edge.target]) {
+                cut_count++;
+            }
+        }
+    }
+    return cut_count;
+}
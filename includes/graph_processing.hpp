@@ -1,22 +1,34 @@
 #pragma once
 
 #include "derived_hashmap.hpp"
+#include "indexed_graph.hpp"
+#include "path_search.hpp"
+#include "landmarks.hpp"
+#include "contraction_hierarchy.hpp"
+#include "all_pairs.hpp"
+#include "k_shortest_paths.hpp"
+#include "arc_flags.hpp"
 
+// Every function below is a template over the typename `Type` of the edge weights and distances, explicitly instantiated within
+// graph_processing.cpp for `double`, `float` and `std::uint32_t` only (see `detect_weight_type`)
 
 /**
  * Parses the information for each edge of the graph to be processed in its entirety within the text file selected by the user, `filename`. After
- * processing each line, the edge inforamtion is stored with the hashmap-like container, `adj_list` and writing the edge and vertex information
+ * processing each line, the edge inforamtion is stored with the ID-indexed graph container, `adj_list` and writing the edge and vertex information
  * included within each line in the dot language format within the file designated to store all extracted graphical information used in the visualization
  * of the main graph, `graph_file`.
+ * @tparam Type typename of the edge weights of `adj_list`
  * @param filename Relative path to the text file selected by the user that contains line-by-line information on each edge forming graph to be processed by the program
  * @param graph_file Relative path to the file designated for storing the dot language-converted graphical information extracted from `filename`
  * @param vertex_count Integer value provided by the user representing the approximate number of unqiue verticies within the graph
  * @note `vertex_count` is used to initialize the container used to store the accumulated edge information, `adj_list` with its underlying storage array
  * having preallocated memory to store the provided number of unique verticies.
- * @param `adj_list` Hashmap-like container used to store information for each new vertex and unique edge read from `filename` in similar fashion to an adjacency list
+ * @param `adj_list` Adjacency list container storing each new vertex name once (within its `name_arena`) and each unique edge read from `filename` by vertex ID
+ * @note Weights are parsed as `double` and converted to `Type`, while the dot language file receives the parsed weights
  * @return 0 if successful, -1 upon failure
  */
-extern int build_adjacency_list(const std::string& filename, const std::string& graph_file, unsigned int vertex_count, main_hashmap<double>&& adj_list);
+template <class Type>
+int build_adjacency_list(const std::string& filename, const std::string& graph_file, unsigned int vertex_count, indexed_graph<Type>&& adj_list);
 
 
 /**
@@ -24,14 +36,82 @@ extern int build_adjacency_list(const std::string& filename, const std::string&
  * using the graphical information stored within the container, `adj_list`.
  * Upon determining the shortest path, the relative paths of the file containing the graphical information extracted the user-provided text file, `graph_filename`,
  * and the file to be edited with the reformatted shortest path information,`path_filename` are passed to the function responsible for visualization of the shortest path.
+ * @tparam Type typename of the edge weights of `adj_list`
  * @param s_vertex User-provided name of the source vertex from which to generate the starting position of the shortest path within the processed graph
  * @param des_vertex User-provided name of the destination vertex from which to generate the ending position of the shortest path within the processed graph
  * @param graph_filename Relative path to the file designated for storing the dot language-converted graphical information extracted from the text file of edge information
  * @param path_filename Relative path to the file to recieve the dot language converted graphical information of the generated shortest path
- * @param adj_list Hashmap-like container used to store the graphical information extracted from the user-selected text file containing the graph to be processed
+ * @param adj_list ID-indexed adjacency list storing the graphical information extracted from the user-selected text file containing the graph to be processed
+ * @param mode Search strategy, where `search_mode::bidirectional` (default) meets a forward search from the source vertex with a backward search from
+ * the destination vertex and typically settles far fewer verticies than `search_mode::forward`, and `search_mode::landmarks` directs the search
+ * towards the destination vertex using the lower bounds of `landmarks`, while `search_mode::hierarchy` only settles the verticies of higher rank
+ * than the source and destination verticies within `hierarchy`, `search_mode::all_pairs` follows the next hops of `all_pairs`, and
+ * `search_mode::arc_flags` only relaxes the edges that `arc_flags` flags for the region of the destination vertex
+ * @param landmarks Landmark tables built from `adj_list` (required by `search_mode::landmarks`, ignored otherwise)
+ * @param hierarchy Contraction hierarchy built from `adj_list` (required by `search_mode::hierarchy`, ignored otherwise)
+ * @param tree_cache Cache of shortest path trees which, if provided, answers the query from the cached tree of the source vertex
+ * (building and caching the tree on a miss) instead of searching with `mode`
+ * @param all_pairs All-pairs table built from `adj_list` (required by `search_mode::all_pairs`, ignored otherwise)
+ * @param arc_flags Arc-flags built from `adj_list` (required by `search_mode::arc_flags`, ignored otherwise)
  * @return 0 if successful, -1 upon failure
  */
-extern int find_shortest_path(const std::string& s_vertex, const std::string& des_vertex, const std::string& graph_filename, const std::string& path_filename, main_hashmap<double>&& adj_list);
+template <class Type>
+int find_shortest_path(const std::string& s_vertex, const std::string& des_vertex, const std::string& graph_filename, const std::string& path_filename, indexed_graph<Type>&& adj_list,
+    search_mode mode = search_mode::bidirectional, const landmark_table<Type>* landmarks = nullptr,
+    const contraction_hierarchy<Type>* hierarchy = nullptr, path_tree_cache<Type>* tree_cache = nullptr,
+    const all_pairs_table<Type>* all_pairs = nullptr, const arc_flag_table<Type>* arc_flags = nullptr);
+
+
+/**
+ * Computes the complete shortest path tree from the user-provided source vertex, `s_vertex`, with a single search of `adj_list`, and then
+ * prints the shortest path and its total cost/distance to each destination vertex within `des_vertices` (each extracted from the tree in
+ * time proportional to its length). The union of all printed paths is passed to the function responsible for visualization of the shortest path.
+ * @tparam Type typename of the edge weights of `adj_list`
+ * @param s_vertex User-provided name of the source vertex from which every shortest path starts
+ * @param des_vertices Names of the destination verticies to which the shortest paths are printed
+ * @param graph_filename Relative path to the file designated for storing the dot language-converted graphical information extracted from the text file of edge information
+ * @param path_filename Relative path to the file to recieve the dot language converted graphical information of all printed shortest paths
+ * @param adj_list ID-indexed adjacency list storing the graphical information extracted from the user-selected text file containing the graph to be processed
+ * @return 0 if successful, -1 upon failure (a destination vertex that cannot be reached is reported without failing)
+ */
+template <class Type>
+int find_shortest_paths(const std::string& s_vertex, const std::vector<std::string>& des_vertices, const std::string& graph_filename,
+    const std::string& path_filename, indexed_graph<Type>&& adj_list);
+
+
+/**
+ * Finds the nearest of the user-provided source verticies, `s_vertices`, to each vertex within `des_vertices` with a single search of `adj_list`
+ * seeded with every source vertex, and then prints the nearest source vertex, the shortest path from it and its total cost/distance for each
+ * destination vertex. The union of all printed paths is passed to the function responsible for visualization of the shortest path.
+ * @tparam Type typename of the edge weights of `adj_list`
+ * @param s_vertices User-provided names of the source verticies (such as depots or facilities) from which the shortest paths start
+ * @param des_vertices Names of the destination verticies whose nearest source vertex is printed
+ * @param graph_filename Relative path to the file designated for storing the dot language-converted graphical information extracted from the text file of edge information
+ * @param path_filename Relative path to the file to recieve the dot language converted graphical information of all printed shortest paths
+ * @param adj_list ID-indexed adjacency list storing the graphical information extracted from the user-selected text file containing the graph to be processed
+ * @return 0 if successful, -1 upon failure (a destination vertex that no source vertex reaches is reported without failing)
+ */
+template <class Type>
+int find_nearest_sources(const std::vector<std::string>& s_vertices, const std::vector<std::string>& des_vertices, const std::string& graph_filename,
+    const std::string& path_filename, indexed_graph<Type>&& adj_list);
+
+
+/**
+ * Applies Yen's algorithm to find up to `k` shortest loopless paths from the user-provided source vertex, `s_vertex`, to the user-provided destination
+ * vertex, `des_vertex`, within `adj_list`, and then prints each path and its total cost/distance in order of length. All found paths are passed to the
+ * function responsible for visualization, which draws each of them in its own color.
+ * @tparam Type typename of the edge weights of `adj_list`
+ * @param s_vertex User-provided name of the source vertex from which every path starts
+ * @param des_vertex User-provided name of the destination vertex at which every path ends
+ * @param k Largest number of paths to be found
+ * @param graph_filename Relative path to the file designated for storing the dot language-converted graphical information extracted from the text file of edge information
+ * @param path_filename Relative path to the file to recieve the dot language converted graphical information of all found paths
+ * @param adj_list ID-indexed adjacency list storing the graphical information extracted from the user-selected text file containing the graph to be processed
+ * @return 0 if successful (including when fewer than `k` paths exist), -1 upon failure or if no path exists
+ */
+template <class Type>
+int find_k_shortest_paths(const std::string& s_vertex, const std::string& des_vertex, size_t k, const std::string& graph_filename,
+    const std::string& path_filename, indexed_graph<Type>&& adj_list);
 
 
 /**
@@ -39,10 +119,12 @@ extern int find_shortest_path(const std::string& s_vertex, const std::string& de
  * container, `adj_list`.
  * Upon determining the MST, the relative paths of the file containing the graphical information extracted the user-provided text file, `graph_filename`,
  * and the file to be edited with the reformatted MST information,`MST_filename` are passed to the function responsible for visualization of the MST.
+ * @tparam Type typename of the edge weights of `adj_list`
  * @param s_vertex User-provided name of the source vertex from which to generate the MST within the processed graph
  * @param graph_filename Relative path to the file designated for storing the dot language-converted graphical information extracted from the text file of edge information
  * @param MST_filename Relative path to the file to recieve the dot language converted graphical information of the MST
- * @param adj_list Hashmap-like container used to store the graphical information extracted from the user-selected text file containing the graph to be processed
+ * @param adj_list ID-indexed adjacency list storing the graphical information extracted from the user-selected text file containing the graph to be processed
  * @return 0 if successful, -1 upon failure
  */
-extern int find_MST(std::string& s_vertex, const std::string& graph_filename, const std::string& MST_filename, main_hashmap<double>&& adj_list);
\ No newline at end of file
+template <class Type>
+int find_MST(std::string& s_vertex, const std::string& graph_filename, const std::string& MST_filename, indexed_graph<Type>&& adj_list);
\ No newline at end of file
@@ -7,13 +7,28 @@
  * Using the information on the shortest path stored in the `path_list` and `path_map` containers, reads the file containing all graphical information
  * extracted from the user-selected text file in dot format, `graph_filename` and rewrites each line within the file designated for storage of information on
  * the shortest path, `path_filename`, such that all verticies and/or edge(s) within the shortest path are easily distinguished in the generated graphical image.
+ * @tparam Type typename of the edge weights held by `path_map` (instantiated within graph_writing.cpp for `double`, `float` and `std::uint32_t`)
  * @param graph_filename Relative path to the file containing all graphical information extracted from the user-selected text file of initial graph edges to be processed
  * @param path_filename Relative path to the file designated to hold all graphical information with the features of the shortest path altered to enhanced visual effect
  * @param path_list Vector-type container holding all verticies found within the shortest path, in order of traversal from source to destination
  * @param path_map Hashmap-like container holding key:value pairs of all directed edges found within the shortest path with their associated cost/weight values
  * @return 0 if successful, -1 upon failure
  */
-extern int write_shortest_path_overlay(const std::string& graph_filename, const std::string& path_filename, std::vector<std::string>& path_list, soa_hashmap<double>&& path_map);
+template <class Type>
+int write_shortest_path_overlay(const std::string& graph_filename, const std::string& path_filename, std::vector<std::string>& path_list, soa_hashmap<Type>&& path_map);
+
+
+/**
+ * Reads the file containing all graphical information extracted from the user-selected text file in dot format, `graph_filename` and rewrites each line
+ * within the file designated for storage of information on the shortest path, `path_filename`, such that all verticies and/or edge(s) within any of the
+ * ranked paths of `ranked_paths` are distinguished in the generated graphical image, with each path drawn in its own color (an edge used by several paths
+ * is drawn as parallel lines in the colors of each of them).
+ * @param graph_filename Relative path to the file containing all graphical information extracted from the user-selected text file of initial graph edges to be processed
+ * @param path_filename Relative path to the file designated to hold all graphical information with the features of the ranked paths altered to enhanced visual effect
+ * @param ranked_paths Verticies of each path in order of traversal from source to destination, in order of rank (shortest path first)
+ * @return 0 if successful, -1 upon failure
+ */
+extern int write_ranked_paths_overlay(const std::string& graph_filename, const std::string& path_filename, const std::vector<std::vector<std::string>>& ranked_paths);
 
 
 /**
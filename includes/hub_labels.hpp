@@ -0,0 +1,381 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "indexed_graph.hpp"
+#include "contraction_hierarchy.hpp"
+#include "mapped_file.hpp"
+
+
+/**
+ * Hub labeling distance oracle, where each vertex holds a label of (hub, distance) pairs sorted by hub ID such that every
+ * pair of connected verticies shares a hub lying on a shortest path between them. The distance between two verticies is
+ * then found by a single merge of their labels, without searching the graph
+ * @tparam Type typename of the edge weights of the graph
+ *
+ * Labels are derived from a `contraction_hierarchy` by processing verticies from the highest rank downwards: the label of a
+ * vertex combines the labels of the verticies its upward arcs lead to, and every pair whose distance is improved by a path
+ * through another hub is pruned
+ *
+ * @note Hub IDs and distances are stored in two separate contiguous arrays (instead of an array of pairs), so the merge of two
+ * labels compares densely packed 4-byte IDs
+ * @note Files written by `save` hold the same arrays in the same layout, so `load` uses them in place within a memory-mapped
+ * view of the file (see `mapped_file`) instead of copying them
+ */
+template <class Type>
+class hub_labels final {
+    static_assert(std::is_trivially_copyable_v<Type> && alignof(Type) <= 8, "Hub labels require trivially copyable weight types aligned to at most 8 bytes");
+public:
+    /// @brief Extension appended to the name of a graph text file to form the name of its hub label file
+    static constexpr const char* file_extension = ".hl";
+
+    // Constructor creates an empty oracle, allocating all built labels from `resource`
+    hub_labels(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): owned_offsets(1, 0, resource),
+        owned_hubs{resource}, owned_distances{resource}, vertex_count(0), graph_fingerprint(0) {point_to_owned();}
+
+    // Copying would leave the copied views pointing into the storage of the original object
+    hub_labels(const hub_labels& other_labels) = delete;
+    hub_labels& operator=(const hub_labels& other_labels) = delete;
+    // Move Constructor and Move operator (views are redirected to the transferred storage)
+    hub_labels(hub_labels&& old_labels) noexcept: owned_offsets{std::move(old_labels.owned_offsets)},
+        owned_hubs{std::move(old_labels.owned_hubs)}, owned_distances{std::move(old_labels.owned_distances)},
+        mapping{std::move(old_labels.mapping)}, offsets(old_labels.offsets), hubs(old_labels.hubs), distances(old_labels.distances),
+        vertex_count(std::exchange(old_labels.vertex_count, 0)), graph_fingerprint(std::exchange(old_labels.graph_fingerprint, 0)) {
+        if (!mapping.data()) {
+            point_to_owned();
+        }
+        old_labels.clear();
+    }
+    hub_labels& operator=(hub_labels&& old_labels) noexcept {
+        if (this != &old_labels) {
+            owned_offsets = std::move(old_labels.owned_offsets);
+            owned_hubs = std::move(old_labels.owned_hubs);
+            owned_distances = std::move(old_labels.owned_distances);
+            mapping = std::move(old_labels.mapping);
+            offsets = old_labels.offsets;
+            hubs = old_labels.hubs;
+            distances = old_labels.distances;
+            vertex_count = std::exchange(old_labels.vertex_count, 0);
+            graph_fingerprint = std::exchange(old_labels.graph_fingerprint, 0);
+            if (!mapping.data()) {
+                point_to_owned();
+            }
+            old_labels.clear();
+        }
+        return *this;
+    }
+
+
+    /**
+         * Computes the labels of every vertex of the graph `hierarchy` was built from
+         * @param hierarchy Contraction hierarchy whose upward arcs and vertex ranks determine the hubs of each label
+         */
+    void build(const contraction_hierarchy<Type>& hierarchy) {
+        mapping.close();
+        vertex_count = hierarchy.get_vertex_count();
+        graph_fingerprint = hierarchy.get_fingerprint();
+        std::pmr::unsynchronized_pool_resource build_pool;
+        std::pmr::vector<unsigned int> vertex_by_rank(vertex_count, 0, &build_pool);
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            vertex_by_rank[hierarchy.get_rank(vertex)] = vertex;
+        }
+        std::pmr::vector<std::pmr::vector<label_entry>> labels(vertex_count, &build_pool);
+        // Distance to each hub of the label being built, indexed by hub ID (infinity for all other verticies)
+        std::pmr::vector<Type> hub_distances(vertex_count, unreachable_distance<Type>(), &build_pool);
+        std::pmr::vector<label_entry> candidates(&build_pool);
+
+        // Verticies of higher rank are labelled first, so the labels of all upward neighbors are complete when needed
+        for (unsigned int rank = vertex_count; rank-- > 0;) {
+            unsigned int vertex = vertex_by_rank[rank];
+            candidates.assign(1, label_entry{vertex, 0});
+            for (const auto& upward_arc : hierarchy.get_upward(vertex)) {
+                for (const auto& entry : labels[upward_arc.target]) {
+                    candidates.push_back(label_entry{entry.hub, entry.distance + upward_arc.weight});
+                }
+            }
+            // Keep the shortest distance found to each hub
+            std::sort(candidates.begin(), candidates.end(), [](const label_entry& a, const label_entry& b) {
+                return a.hub < b.hub || (a.hub == b.hub && a.distance < b.distance);
+            });
+            candidates.erase(std::unique(candidates.begin(), candidates.end(),
+                [](const label_entry& a, const label_entry& b) { return a.hub == b.hub; }), candidates.end());
+            for (const auto& entry : candidates) {
+                hub_distances[entry.hub] = entry.distance;
+            }
+            // Prune hubs reached by a shorter path through another hub of the label, as they never yield a shortest distance
+            auto dominated = [&hub_distances](const label_entry& entry, const std::pmr::vector<label_entry>& hub_label) {
+                for (const auto& hub_entry : hub_label) {
+                    if (hub_entry.hub != entry.hub && hub_distances[hub_entry.hub] + hub_entry.distance < entry.distance) {
+                        return true;
+                    }
+                }
+                return false;
+            };
+            for (const auto& entry : candidates) {
+                // The entry of the vertex itself (at distance 0) can never be improved
+                if (entry.hub == vertex || !dominated(entry, labels[entry.hub])) {
+                    labels[vertex].push_back(entry);
+                }
+            }
+            for (const auto& entry : candidates) {
+                hub_distances[entry.hub] = unreachable_distance<Type>();
+            }
+        }
+
+        // Pack all labels into the contiguous hub and distance arrays
+        owned_offsets.assign(static_cast<size_t>(vertex_count) + 1, 0);
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            owned_offsets[vertex + 1] = owned_offsets[vertex] + labels[vertex].size();
+        }
+        owned_hubs.clear();
+        owned_distances.clear();
+        owned_hubs.reserve(static_cast<size_t>(owned_offsets[vertex_count]));
+        owned_distances.reserve(static_cast<size_t>(owned_offsets[vertex_count]));
+        for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+            for (const auto& entry : labels[vertex]) {
+                owned_hubs.push_back(entry.hub);
+                owned_distances.push_back(entry.distance);
+            }
+        }
+        point_to_owned();
+        gprintf("Hub labels hold %zu entries (%.2lf per vertex)", get_entry_count(),
+            vertex_count == 0 ? 0.0 : static_cast<double>(get_entry_count()) / vertex_count);
+    }
+
+
+    /**
+         * Computes the length of the shortest path between `source_id` and `destination_id` by merging their labels
+         * @param source_id ID of the source vertex
+         * @param destination_id ID of the destination vertex
+         * @return Shortest distance between both verticies (infinity if they share no hub and so are not connected)
+         */
+    Type distance(unsigned int source_id, unsigned int destination_id) const {
+        Type best_distance = unreachable_distance<Type>();
+        size_t i = static_cast<size_t>(offsets[source_id]);
+        size_t i_end = static_cast<size_t>(offsets[source_id + 1]);
+        size_t j = static_cast<size_t>(offsets[destination_id]);
+        size_t j_end = static_cast<size_t>(offsets[destination_id + 1]);
+        while (i < i_end && j < j_end) {
+            unsigned int source_hub = hubs[i];
+            unsigned int destination_hub = hubs[j];
+            if (source_hub == destination_hub) {
+                best_distance = std::min(best_distance, distances[i] + distances[j]);
+            }
+            // Advance past the smaller hub ID (or both if equal) without branching on which label is ahead
+            i += static_cast<size_t>(source_hub <= destination_hub);
+            j += static_cast<size_t>(destination_hub <= source_hub);
+        }
+        return best_distance;
+    }
+
+
+    /**
+         * Retrieves the number of (hub, distance) pairs within the label of the vertex with matching `id`
+         * @param id ID of the vertex
+         * @return Size of the vertex's label
+         */
+    size_t get_label_size(unsigned int id) const {
+        return static_cast<size_t>(offsets[id + 1] - offsets[id]);
+    }
+
+
+    /**
+         * Retrieves the total number of (hub, distance) pairs across all labels
+         * @return Number of stored label entries
+         */
+    size_t get_entry_count() const {
+        return static_cast<size_t>(offsets[vertex_count]);
+    }
+
+
+    /**
+         * Retrieves the number of labelled verticies
+         * @return Number of verticies of the graph the labels were built from
+         */
+    unsigned int get_vertex_count() const {
+        return vertex_count;
+    }
+
+
+    /**
+         * Determines whether the labels are read in place from a memory-mapped file (see `load`)
+         * @return `true` if the labels are memory-mapped, else `false`
+         */
+    bool is_mapped() const {
+        return mapping.is_mapped();
+    }
+
+
+    /**
+         * Determines whether the calling `hub_labels` was built from a graph identical to `graph`
+         * @param graph Graph to be compared against
+         * @return `true` if the number of verticies and the fingerprint of `graph` match, else `false`
+         */
+    bool matches(const indexed_graph<Type>& graph) const {
+        return vertex_count == graph.get_vertex_count() && graph_fingerprint == graph.get_fingerprint();
+    }
+
+
+    /**
+         * Writes all labels to the binary file `filename`, laid out as a header followed by the label offsets, the hub IDs and
+         * (aligned to 8 bytes) the hub distances
+         * @param filename Relative path to the file to be written
+         * @return 0 if successful, -1 upon failure
+         */
+    int save(const std::string& filename) const {
+        std::ofstream write_file(filename, std::ios::binary | std::ios::trunc);
+        if (!write_file.is_open()) {
+            std::cerr << "ERROR: Could not open file '" << filename << "' for writing hub labels!" << '\n';
+            return -1;
+        }
+        file_header header{};
+        std::memcpy(header.tag, file_tag, sizeof(file_tag));
+        header.type_size = static_cast<std::uint32_t>(sizeof(Type));
+        header.vertex_count = vertex_count;
+        header.entry_count = offsets[vertex_count];
+        header.fingerprint = graph_fingerprint;
+        const char padding[8] = {};
+        write_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        write_file.write(reinterpret_cast<const char*>(offsets), static_cast<std::streamsize>((static_cast<size_t>(vertex_count) + 1) * sizeof(std::uint64_t)));
+        write_file.write(reinterpret_cast<const char*>(hubs), static_cast<std::streamsize>(get_entry_count() * sizeof(unsigned int)));
+        write_file.write(padding, static_cast<std::streamsize>(distance_padding(get_entry_count())));
+        write_file.write(reinterpret_cast<const char*>(distances), static_cast<std::streamsize>(get_entry_count() * sizeof(Type)));
+        if (!write_file.good()) {
+            std::cerr << "ERROR: An error was encountered while writing hub labels to '" << filename << "'!" << '\n';
+            return -1;
+        }
+        return 0;
+    }
+
+
+    /**
+         * Replaces the contents of the calling `hub_labels` with a view of the labels stored in the binary file `filename`,
+         * if they were built from a graph identical to `graph`. The file is memory-mapped where supported, so labels are only
+         * paged in once they are first queried
+         * @param filename Relative path to the file written by `save`
+         * @param graph Graph the loaded labels will be used with
+         * @return 0 if successful, -1 if the file does not exist, cannot be read or was built from a different graph
+         * (the calling `hub_labels` is left unchanged)
+         */
+    int load(const std::string& filename, const indexed_graph<Type>& graph) {
+        mapped_file file_view;
+        if (file_view.open(filename) < 0 || file_view.size() < sizeof(file_header)) {
+            return -1;
+        }
+        file_header header{};
+        std::memcpy(&header, file_view.data(), sizeof(header));
+        if (std::memcmp(header.tag, file_tag, sizeof(file_tag)) != 0 || header.type_size != sizeof(Type) ||
+            header.vertex_count != graph.get_vertex_count() || header.fingerprint != graph.get_fingerprint()) {
+            return -1;
+        }
+        // Reject files whose size does not match the layout described by their header
+        size_t offsets_bytes = (static_cast<size_t>(header.vertex_count) + 1) * sizeof(std::uint64_t);
+        if (header.entry_count > file_view.size()) {
+            return -1;
+        }
+        auto entry_count = static_cast<size_t>(header.entry_count);
+        size_t hubs_bytes = entry_count * sizeof(unsigned int);
+        size_t distances_start = sizeof(file_header) + offsets_bytes + hubs_bytes + distance_padding(entry_count);
+        if (file_view.size() != distances_start + entry_count * sizeof(Type)) {
+            return -1;
+        }
+        const auto* file_offsets = reinterpret_cast<const std::uint64_t*>(file_view.data() + sizeof(file_header));
+        if (file_offsets[0] != 0 || file_offsets[header.vertex_count] != header.entry_count) {
+            return -1;
+        }
+        for (unsigned int vertex = 0; vertex < header.vertex_count; vertex++) {
+            if (file_offsets[vertex] > file_offsets[vertex + 1]) {
+                return -1;
+            }
+        }
+        mapping = std::move(file_view);
+        owned_offsets.clear();
+        owned_hubs.clear();
+        owned_distances.clear();
+        offsets = reinterpret_cast<const std::uint64_t*>(mapping.data() + sizeof(file_header));
+        hubs = reinterpret_cast<const unsigned int*>(mapping.data() + sizeof(file_header) + offsets_bytes);
+        distances = reinterpret_cast<const Type*>(mapping.data() + distances_start);
+        vertex_count = header.vertex_count;
+        graph_fingerprint = header.fingerprint;
+        return 0;
+    }
+
+private:
+    /// @brief Single (hub, distance) pair of a label while labels are being built
+    struct label_entry {
+        unsigned int hub;
+        Type distance;
+    };
+
+    /// @brief Fixed-size header at the start of hub label files
+    struct file_header {
+        char tag[8];
+        std::uint32_t type_size;
+        std::uint32_t vertex_count;
+        std::uint64_t entry_count;
+        std::uint64_t fingerprint;
+    };
+
+
+    /**
+         * Computes the number of padding bytes placed after the hub IDs so the hub distances start at a multiple of 8 bytes
+         * @param entry_count Number of label entries
+         * @return Number of padding bytes (0 to 7)
+         */
+    static size_t distance_padding(size_t entry_count) {
+        return (8 - (entry_count * sizeof(unsigned int)) % 8) % 8;
+    }
+
+
+    /**
+         * Redirects the label views to the owned arrays filled by `build`
+         */
+    void point_to_owned() {
+        offsets = owned_offsets.data();
+        hubs = owned_hubs.data();
+        distances = owned_distances.data();
+    }
+
+
+    /**
+         * Empties the calling `hub_labels`, leaving a valid oracle without any verticies
+         */
+    void clear() {
+        mapping.close();
+        owned_offsets.assign(1, 0);
+        owned_hubs.clear();
+        owned_distances.clear();
+        vertex_count = 0;
+        graph_fingerprint = 0;
+        point_to_owned();
+    }
+
+    /// @brief Tag identifying hub label files (and their format version)
+    static constexpr char file_tag[8] = {'G', 'R', 'P', 'H', 'H', 'U', 'B', '1'};
+    /// @brief Index of the first entry of each label within `owned_hubs` (with a final entry holding the total number of entries)
+    std::pmr::vector<std::uint64_t> owned_offsets;
+    /// @brief Hub IDs of all labels built by `build`, grouped by vertex ID and sorted by hub ID within each label
+    std::pmr::vector<unsigned int> owned_hubs;
+    /// @brief Distance to the hub at the same position within `owned_hubs`
+    std::pmr::vector<Type> owned_distances;
+    /// @brief View of the file the labels were loaded from (empty if the labels were built)
+    mapped_file mapping;
+    /// @brief Label offsets, hub IDs and hub distances in use, pointing either into the owned arrays or into `mapping`
+    const std::uint64_t* offsets;
+    const unsigned int* hubs;
+    const Type* distances;
+    /// @brief Number of labelled verticies
+    unsigned int vertex_count;
+    /// @brief Fingerprint of the graph the labels were built from
+    std::uint64_t graph_fingerprint;
+};
@@ -0,0 +1,688 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <list>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "name_arena.hpp"
+#include "derived_hashmap.hpp"
+
+
+/**
+ * Retrieves the distance recorded for verticies that cannot be reached, which no path of whole or fractional edge weights
+ * may reach: infinity for floating-point weights, and half the largest value for integer weights (which have no infinity),
+ * so that adding an edge weight or a second unreachable distance to it cannot overflow
+ * @tparam Type typename of the edge weights
+ * @return Distance of unreachable verticies
+ */
+template <class Type>
+constexpr Type unreachable_distance() {
+    if constexpr (std::numeric_limits<Type>::has_infinity) {
+        return std::numeric_limits<Type>::infinity();
+    } else {
+        return std::numeric_limits<Type>::max() / 2;
+    }
+}
+
+
+/**
+ * Adjacency-list graph whose verticies are identified by the dense integer IDs of a `name_arena`, where every vertex
+ * name is stored exactly once and every edge only holds the ID of its target vertex
+ * @tparam Type typename of the edge weights held by the graph
+ *
+ * Verticies receive IDs in the order they are first added, so iterating IDs from 0 to `get_vertex_count() - 1`
+ * visits verticies in the same order as the keys of an equivalently built `main_hashmap`
+ *
+ * Each vertex record occupies a single cache line and holds up to `inline_capacity` outgoing edges directly, so scanning
+ * the neighbors of a low-degree vertex touches no memory outside of its record. Once a vertex exceeds `inline_capacity`
+ * edges, its edges are moved to a separately allocated array, and once it exceeds `hash_threshold` edges an
+ * open-addressing table of edge positions keyed by target ID is maintained for its edge lookups
+ *
+ * A union-find of the verticies (joined by size, with paths halved as edges are added) labels the connected components as
+ * the graph is built, so that verticies of different components are recognized as unreachable from one another without a search
+ *
+ * @note Edges are directed, undirected graphs are stored by adding each edge in both directions
+ * @note All storage is allocated from the `std::pmr::memory_resource` provided on construction
+ */
+template <class Type>
+class indexed_graph final {
+public:
+    /// @brief Directed edge to the vertex with ID `target` holding the weight `weight`
+    struct edge {
+        unsigned int target;
+        Type weight;
+    };
+
+    /// @brief Read-only view of the contiguous outgoing edges of a single vertex
+    class edge_range {
+    public:
+        edge_range(const edge* f, const edge* l): first(f), last(l) {}
+        const edge* begin() const { return first; }
+        const edge* end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+        bool empty() const { return first == last; }
+        const edge& operator[](size_t i) const { return first[i]; }
+    private:
+        const edge* first;
+        const edge* last;
+    };
+
+    /// @brief Size (in bytes) of the cache line each vertex record is aligned to
+    static constexpr size_t cache_line_bytes = 64;
+    /// @brief Maximum number of edges stored directly within a vertex record
+    static constexpr unsigned int inline_capacity = sizeof(edge) * 2 + sizeof(unsigned int) * 2 > cache_line_bytes ? 1 :
+        static_cast<unsigned int>((cache_line_bytes - sizeof(unsigned int) * 2) / sizeof(edge));
+    /// @brief Number of edges above which the edge lookups of a vertex are resolved through a hash table
+    static constexpr unsigned int hash_threshold = 16;
+
+    // Constructor reserves space for `c` verticies, allocating all storage from `resource`
+    indexed_graph(unsigned int c, std::pmr::memory_resource* resource = std::pmr::get_default_resource()): names{c, resource},
+        adjacency{resource}, spilled_edges{resource}, spilled_slots{resource}, component_parents{resource}, component_sizes{resource},
+        component_count(0), edge_count(0),
+        min_weight(std::numeric_limits<Type>::max()), max_weight(Type{}), paired_edge_count(0), integral_weights(true),
+        revision(next_revision()) {
+        adjacency.reserve(c);
+        component_parents.reserve(c);
+        component_sizes.reserve(c);
+    }
+    // Constructor defaults to space for 5 verticies if no capacity argument is provided
+    indexed_graph(): indexed_graph(5) {}
+
+
+    /**
+         * Adds a vertex named `name` to the calling `indexed_graph` if it does not already exist
+         * @param name Name of the vertex to be added
+         * @return ID of the vertex named `name`
+         */
+    unsigned int add_vertex(std::string_view name) {
+        unsigned int id = names.intern(name);
+        if (id == adjacency.size()) {
+            adjacency.emplace_back();
+            component_parents.push_back(id);
+            component_sizes.push_back(1);
+            component_count++;
+            revision = next_revision();
+        }
+        return id;
+    }
+
+
+    /**
+         * Retrieves the number of verticies whose edges no longer fit within their vertex record
+         * @return Number of verticies with more than `inline_capacity` edges
+         */
+    unsigned int get_spilled_count() const {
+        return static_cast<unsigned int>(spilled_edges.size());
+    }
+
+
+    /**
+         * Adds a directed edge from the vertex with ID `from` to the vertex with ID `to` if no such edge exists yet
+         * (the weight of an existing edge is left unchanged)
+         * @param from ID of the vertex the edge starts from
+         * @param to ID of the vertex the edge leads to
+         * @param weight Weight of the new edge
+         * @return `true` if a new edge was added, else `false`
+         */
+    bool add_edge(unsigned int from, unsigned int to, Type weight) {
+        check_id(from);
+        check_id(to);
+        if (find_edge(from, to) != nullptr) {
+            return false;
+        }
+        // A loop is its own reverse edge, any other edge pairs with an existing reverse edge of equal weight
+        const edge* reverse_edge = find_edge(to, from);
+        if (from == to) {
+            paired_edge_count++;
+        } else if (reverse_edge != nullptr && reverse_edge->weight == weight) {
+            paired_edge_count += 2;
+        }
+        vertex_record& record = adjacency[from];
+        if (record.spill_index == name_arena::invalid_id && record.edge_total < inline_capacity) {
+            record.inline_edges[record.edge_total] = edge{to, weight};
+        } else {
+            // Move the inline edges of the vertex to its own array upon exceeding the capacity of its record
+            if (record.spill_index == name_arena::invalid_id) {
+                record.spill_index = static_cast<unsigned int>(spilled_edges.size());
+                spilled_edges.emplace_back();
+                spilled_slots.emplace_back();
+                spilled_edges.back().reserve(inline_capacity * 2);
+                spilled_edges.back().assign(record.inline_edges, record.inline_edges + record.edge_total);
+            }
+            auto& edges = spilled_edges[record.spill_index];
+            edges.push_back(edge{to, weight});
+            if (edges.size() > hash_threshold) {
+                auto& slots = spilled_slots[record.spill_index];
+                // Keep table load below 0.5 so quadratic probing is guaranteed to locate an empty position
+                if (edges.size() * 2 >= slots.size()) {
+                    rebuild_slots(record.spill_index);
+                } else {
+                    slots[probe_slot(record.spill_index, to)] = static_cast<unsigned int>(edges.size() - 1);
+                }
+            }
+        }
+        record.edge_total++;
+        edge_count++;
+        join_components(from, to);
+        min_weight = std::min(min_weight, weight);
+        max_weight = std::max(max_weight, weight);
+        integral_weights = integral_weights && std::trunc(weight) == weight;
+        revision = next_revision();
+        return true;
+    }
+
+
+    /**
+         * Adds a directed edge between the verticies named `from` and `to`, adding either vertex if it does not exist yet
+         * @param from Name of the vertex the edge starts from
+         * @param to Name of the vertex the edge leads to
+         * @param weight Weight of the new edge
+         * @return `true` if a new edge was added, else `false`
+         */
+    bool add_edge(std::string_view from, std::string_view to, Type weight) {
+        unsigned int from_id = add_vertex(from);
+        unsigned int to_id = add_vertex(to);
+        return add_edge(from_id, to_id, weight);
+    }
+
+
+    /**
+         * Sets the weight of the directed edge from the vertex with ID `from` to the vertex with ID `to`, adding the edge if it
+         * does not exist yet
+         * @param from ID of the vertex the edge starts from
+         * @param to ID of the vertex the edge leads to
+         * @param weight New weight of the edge
+         * @return `true` if a new edge was added, else `false` (the weight of the existing edge was replaced)
+         * @note A replaced weight only widens the recorded smallest and largest edge weights (and can only clear whether every
+         * weight is whole), so these remain bounds of the current edge weights
+         */
+    bool set_edge_weight(unsigned int from, unsigned int to, Type weight) {
+        check_id(from);
+        check_id(to);
+        // The edge is located through the const lookup, but belongs to the calling (non-const) graph
+        auto* existing_edge = const_cast<edge*>(find_edge(from, to));
+        if (existing_edge == nullptr) {
+            return add_edge(from, to, weight);
+        }
+        const edge* reverse_edge = find_edge(to, from);
+        if (from != to && reverse_edge != nullptr) {
+            if (reverse_edge->weight == existing_edge->weight) {
+                paired_edge_count -= 2;
+            }
+            if (reverse_edge->weight == weight) {
+                paired_edge_count += 2;
+            }
+        }
+        existing_edge->weight = weight;
+        min_weight = std::min(min_weight, weight);
+        max_weight = std::max(max_weight, weight);
+        integral_weights = integral_weights && std::trunc(weight) == weight;
+        revision = next_revision();
+        return false;
+    }
+
+
+    /**
+         * Sets the weight of the directed edge between the verticies named `from` and `to`, adding either vertex or the edge if
+         * it does not exist yet
+         * @param from Name of the vertex the edge starts from
+         * @param to Name of the vertex the edge leads to
+         * @param weight New weight of the edge
+         * @return `true` if a new edge was added, else `false`
+         */
+    bool set_edge_weight(std::string_view from, std::string_view to, Type weight) {
+        unsigned int from_id = add_vertex(from);
+        unsigned int to_id = add_vertex(to);
+        return set_edge_weight(from_id, to_id, weight);
+    }
+
+
+    /**
+         * Determines whether a vertex named `name` exists within the calling `indexed_graph`
+         * @param name Name of the vertex to be located
+         * @return `true` if the vertex exists, else `false`
+         */
+    bool contains_vertex(std::string_view name) const {
+        return names.contains_name(name);
+    }
+
+
+    /**
+         * Retrieves the ID of the vertex named `name` (Fails if the vertex does not exist)
+         * @param name Name of the vertex to be located
+         * @return ID of the vertex named `name`
+         */
+    unsigned int get_vertex_id(std::string_view name) const {
+        return names.get_id(name);
+    }
+
+
+    /**
+         * Retrieves the name of the vertex with ID `id` (Fails if `id` is not a valid vertex ID)
+         * @param id ID of the vertex
+         * @return View of the vertex name stored within the graph's `name_arena`
+         */
+    std::string_view get_vertex_name(unsigned int id) const {
+        return names.get_name(id);
+    }
+
+
+    /**
+         * Retrieves all vertex names in order of their IDs
+         * @return List holding a copy of every vertex name
+         */
+    std::list<std::string> get_vertex_names() const {
+        std::list<std::string> vertex_names;
+        for (unsigned int id = 0; id < get_vertex_count(); id++) {
+            vertex_names.emplace_back(names.get_name(id));
+        }
+        return vertex_names;
+    }
+
+
+    /**
+         * Retrieves the number of verticies within the calling `indexed_graph`
+         * @return Number of verticies (one greater than the largest valid vertex ID)
+         */
+    unsigned int get_vertex_count() const {
+        return static_cast<unsigned int>(adjacency.size());
+    }
+
+
+    /**
+         * Retrieves the number of directed edges within the calling `indexed_graph`
+         * @return Number of directed edges (twice the number of undirected edges)
+         */
+    unsigned long get_edge_count() const {
+        return edge_count;
+    }
+
+
+    /**
+         * Retrieves the outgoing edges of the vertex with ID `id` in the order they were added
+         * (Fails if `id` is not a valid vertex ID)
+         * @param id ID of the vertex
+         * @return View of all edges leaving the vertex (invalidated by adding further edges to the vertex)
+         */
+    edge_range get_adjacent(unsigned int id) const {
+        check_id(id);
+        const vertex_record& record = adjacency[id];
+        if (record.spill_index == name_arena::invalid_id) {
+            return edge_range(record.inline_edges, record.inline_edges + record.edge_total);
+        }
+        const auto& edges = spilled_edges[record.spill_index];
+        return edge_range(edges.data(), edges.data() + edges.size());
+    }
+
+
+    /**
+         * Determines whether a directed edge exists from the vertex with ID `from` to the vertex with ID `to`
+         * @param from ID of the vertex the edge starts from
+         * @param to ID of the vertex the edge leads to
+         * @return `true` if the edge exists, else `false`
+         */
+    bool contains_edge(unsigned int from, unsigned int to) const {
+        check_id(from);
+        return find_edge(from, to) != nullptr;
+    }
+
+
+    /**
+         * Retrieves the weight of the directed edge from the vertex with ID `from` to the vertex with ID `to`
+         * (Fails if the edge does not exist)
+         * @param from ID of the vertex the edge starts from
+         * @param to ID of the vertex the edge leads to
+         * @return Weight of the edge
+         */
+    Type get_edge_weight(unsigned int from, unsigned int to) const {
+        check_id(from);
+        const edge* found_edge = find_edge(from, to);
+        if (found_edge == nullptr) {
+            std::string explain = "ERROR: No edge exists from vertex '";
+            explain.append(names.get_name(from)).append("' to vertex with ID '").append(std::to_string(to)).append("'!");
+            throw(std::runtime_error(explain.c_str()));
+        }
+        return found_edge->weight;
+    }
+
+
+    /**
+         * Retrieves the component of the vertex with ID `id`, where two verticies share a component if an edge in either
+         * direction joins them or any chain of such edges does (Fails if `id` is not a valid vertex ID)
+         * @param id ID of the vertex
+         * @return ID of the vertex representing the component, shared by every vertex of the component
+         * @note Representatives change as components are joined, so they only identify components until the next edge is added
+         */
+    unsigned int get_component(unsigned int id) const {
+        check_id(id);
+        while (component_parents[id] != id) {
+            id = component_parents[id];
+        }
+        return id;
+    }
+
+
+    /**
+         * Determines whether the verticies with IDs `first` and `second` belong to the same component (see `get_component`),
+         * without which no path joins them
+         * @param first ID of one vertex
+         * @param second ID of the other vertex
+         * @return `true` if both verticies share a component, else `false`
+         * @note Edges are directed, so a shared component only guarantees a path for graphs whose edges are stored in both directions
+         */
+    bool same_component(unsigned int first, unsigned int second) const {
+        return get_component(first) == get_component(second);
+    }
+
+
+    /**
+         * Retrieves the number of components of the calling `indexed_graph`
+         * @return Number of components (1 for a connected graph with at least one vertex)
+         */
+    unsigned int get_component_count() const {
+        return component_count;
+    }
+
+
+    /**
+         * Fills `labels` with a dense label for the component of every vertex, numbered in order of the lowest vertex ID of each
+         * component
+         * @param labels Filled with the label (within [0, `get_component_count()`)) of each vertex, indexed by vertex ID
+         * @return Number of components
+         */
+    unsigned int label_components(std::pmr::vector<unsigned int>& labels) const {
+        labels.assign(get_vertex_count(), name_arena::invalid_id);
+        unsigned int label_count = 0;
+        for (unsigned int vertex = 0; vertex < get_vertex_count(); vertex++) {
+            unsigned int representative = get_component(vertex);
+            if (labels[representative] == name_arena::invalid_id) {
+                labels[representative] = label_count++;
+            }
+            labels[vertex] = labels[representative];
+        }
+        return label_count;
+    }
+
+
+    /**
+         * Retrieves the `name_arena` holding the names of all verticies
+         * @return Reference to the graph's `name_arena`
+         */
+    const name_arena& get_names() const {
+        return names;
+    }
+
+
+    /**
+         * Computes a 64-bit FNV-1a fingerprint of the vertex names, edges and edge weights of the calling `indexed_graph`,
+         * used to check that preprocessed files (see `landmark_table`) belong to an identical graph
+         * @return Fingerprint identifying the calling `indexed_graph`
+         */
+    std::uint64_t get_fingerprint() const {
+        std::uint64_t hash = 14695981039346656037ULL;
+        auto mix = [&hash](const void* bytes, size_t length) {
+            const auto* data = static_cast<const unsigned char*>(bytes);
+            for (size_t i = 0; i < length; i++) {
+                hash ^= data[i];
+                hash *= 1099511628211ULL;
+            }
+        };
+        for (unsigned int vertex = 0; vertex < get_vertex_count(); vertex++) {
+            std::string_view name = names.get_name(vertex);
+            // Names are hashed with their null terminator so adjacent names cannot be confused
+            mix(name.data(), name.size() + 1);
+            for (const auto& adjacent_edge : get_adjacent(vertex)) {
+                mix(&adjacent_edge.target, sizeof(adjacent_edge.target));
+                mix(&adjacent_edge.weight, sizeof(adjacent_edge.weight));
+            }
+        }
+        return hash;
+    }
+
+
+    /**
+         * Retrieves the smallest weight of any edge, recorded as edges are added (a lower bound once weights are replaced)
+         * @return Smallest edge weight (`std::numeric_limits<Type>::max()` if the graph has no edges)
+         */
+    Type get_min_weight() const {
+        return min_weight;
+    }
+
+
+    /**
+         * Retrieves the largest weight of any edge, recorded as edges are added (an upper bound once weights are replaced)
+         * @return Largest edge weight (a value-initialized `Type` if the graph has no edges)
+         */
+    Type get_max_weight() const {
+        return max_weight;
+    }
+
+
+    /**
+         * Determines whether every edge has the same weight, in which case the shortest paths are those with the fewest edges
+         * @return `true` if the graph has at least one edge and its smallest and largest edge weights are equal, else `false`
+         */
+    bool has_uniform_weights() const {
+        return edge_count > 0 && min_weight == max_weight;
+    }
+
+
+    /**
+         * Determines whether every edge weight is a whole number, recorded as edges are added
+         * @return `true` if no edge weight has a fractional part (including a graph without edges), else `false`
+         */
+    bool has_integral_weights() const {
+        return integral_weights;
+    }
+
+
+    /**
+         * Determines whether every edge is matched by an edge of equal weight in the opposite direction (as for undirected graphs
+         * built by `build_adjacency_list`), so that the edges leaving a vertex are also the edges reaching it
+         * @return `true` if every edge is paired with its reverse edge, else `false`
+         */
+    bool is_symmetric() const {
+        return paired_edge_count == edge_count;
+    }
+
+
+    /**
+         * Retrieves a stamp of the current contents of the calling `indexed_graph`, which changes whenever a vertex or edge is
+         * added or an edge weight is set, and is never shared by two separately built graphs, so results cached for a graph can detect that it was rebuilt
+         * without comparing fingerprints
+         * @return Revision stamp of the calling `indexed_graph`
+         */
+    std::uint64_t get_revision() const {
+        return revision;
+    }
+
+
+    /**
+         * Retrieves the memory resource from which all storage of the calling `indexed_graph` is allocated
+         * @return Pointer to the `std::pmr::memory_resource` used by the calling `indexed_graph`
+         */
+    std::pmr::memory_resource* get_memory_resource() const {
+        return adjacency.get_allocator().resource();
+    }
+
+
+    /**
+         * Overloading function for printing every vertex and its adjacent verticies to output streams
+         */
+    friend std::ostream& operator<<(std::ostream& out, const indexed_graph<Type>& graph) {
+        out << "{ ";
+        for (unsigned int id = 0; id < graph.get_vertex_count(); id++) {
+            out << graph.names.get_name(id) << " : { ";
+            auto adjacent = graph.get_adjacent(id);
+            for (size_t i = 0; i < adjacent.size(); i++) {
+                out << graph.names.get_name(adjacent[i].target) << " : " << adjacent[i].weight;
+                if (i + 1 != adjacent.size()) {
+                    out << ", ";
+                }
+            }
+            out << " }";
+            if (id + 1 != graph.get_vertex_count()) {
+                out << ", ";
+            }
+        }
+        out << " }";
+        return out;
+    }
+
+private:
+    /// @brief Vertex record holding either the first `inline_capacity` edges of the vertex or the position of its spilled edges
+    struct alignas(cache_line_bytes) vertex_record {
+        edge inline_edges[inline_capacity];
+        /// @brief Number of edges leaving the vertex
+        unsigned int edge_total = 0;
+        /// @brief Index of the vertex's arrays within `spilled_edges` and `spilled_slots` (`invalid_id` while edges are inline)
+        unsigned int spill_index = name_arena::invalid_id;
+    };
+
+
+    /**
+         * Draws a revision stamp that no graph has held before
+         * @return Next value of the process-wide revision counter
+         */
+    static std::uint64_t next_revision() {
+        static std::atomic<std::uint64_t> revision_counter{0};
+        return ++revision_counter;
+    }
+
+
+    /**
+         * Joins the components of two verticies, placing the smaller component below the representative of the larger one
+         * @param first ID of one vertex (must be valid)
+         * @param second ID of the other vertex (must be valid)
+         */
+    void join_components(unsigned int first, unsigned int second) {
+        // Every other vertex along each path is moved up to its grandparent, halving the paths searched by later lookups
+        auto find = [this](unsigned int vertex) {
+            while (component_parents[vertex] != vertex) {
+                component_parents[vertex] = component_parents[component_parents[vertex]];
+                vertex = component_parents[vertex];
+            }
+            return vertex;
+        };
+        unsigned int first_root = find(first);
+        unsigned int second_root = find(second);
+        if (first_root == second_root) {
+            return;
+        }
+        if (component_sizes[first_root] < component_sizes[second_root]) {
+            std::swap(first_root, second_root);
+        }
+        component_parents[second_root] = first_root;
+        component_sizes[first_root] += component_sizes[second_root];
+        component_count--;
+    }
+
+
+    /**
+         * Throws an exception if `id` is not the ID of an existing vertex
+         * @param id Vertex ID to be validated
+         */
+    void check_id(unsigned int id) const {
+        if (id >= adjacency.size()) {
+            std::string explain = "ERROR: No vertex with an ID of '";
+            explain.append(std::to_string(id)).append("' exists within the calling indexed_graph object!");
+            throw(std::runtime_error(explain.c_str()));
+        }
+    }
+
+
+    /**
+         * Locates the directed edge from the vertex with ID `from` to the vertex with ID `to`
+         * @param from ID of the vertex the edge starts from (must be valid)
+         * @param to ID of the vertex the edge leads to
+         * @return Pointer to the edge if it exists, else `nullptr`
+         */
+    const edge* find_edge(unsigned int from, unsigned int to) const {
+        const vertex_record& record = adjacency[from];
+        if (record.spill_index != name_arena::invalid_id && !spilled_slots[record.spill_index].empty()) {
+            unsigned int position = spilled_slots[record.spill_index][probe_slot(record.spill_index, to)];
+            return position == name_arena::invalid_id ? nullptr : &spilled_edges[record.spill_index][position];
+        }
+        for (const auto& adjacent_edge : get_adjacent(from)) {
+            if (adjacent_edge.target == to) {
+                return &adjacent_edge;
+            }
+        }
+        return nullptr;
+    }
+
+
+    /**
+         * Locates the position of the edge leading to `to` within the hash table of the spilled edges at `spill_index`,
+         * or the empty position where it would be placed
+         * @param spill_index Index of the spilled edges (and their non-empty hash table)
+         * @param to ID of the vertex the edge leads to
+         * @return Index position within `spilled_slots[spill_index]`
+         */
+    size_t probe_slot(unsigned int spill_index, unsigned int to) const {
+        const auto& slots = spilled_slots[spill_index];
+        const auto& edges = spilled_edges[spill_index];
+        size_t capacity = slots.size();
+        size_t hash_index = to % capacity;
+        // Apply quadratic probing to minimize chance of collisions
+        size_t j = 0;
+        size_t next_index = hash_index;
+        while (slots[next_index] != name_arena::invalid_id && edges[slots[next_index]].target != to) {
+            j++;
+            next_index = (hash_index + (j * j)) % capacity;
+        }
+        return next_index;
+    }
+
+
+    /**
+         * Rebuilds the hash table of the spilled edges at `spill_index` with a prime capacity of more than double their count
+         * @param spill_index Index of the spilled edges
+         */
+    void rebuild_slots(unsigned int spill_index) {
+        auto& slots = spilled_slots[spill_index];
+        const auto& edges = spilled_edges[spill_index];
+        slots.assign(get_next_prime(static_cast<unsigned int>(edges.size() * 4)), name_arena::invalid_id);
+        for (unsigned int position = 0; position < static_cast<unsigned int>(edges.size()); position++) {
+            slots[probe_slot(spill_index, edges[position].target)] = position;
+        }
+    }
+
+    /// @brief Interned names of all verticies, indexed by vertex ID
+    name_arena names;
+    /// @brief Cache-line sized records of every vertex, indexed by vertex ID
+    std::pmr::vector<vertex_record> adjacency;
+    /// @brief Edges of verticies that exceeded `inline_capacity` edges, indexed by `vertex_record::spill_index`
+    std::pmr::vector<std::pmr::vector<edge>> spilled_edges;
+    /// @brief Hash tables of edge positions for verticies that exceeded `hash_threshold` edges (empty below the threshold)
+    std::pmr::vector<std::pmr::vector<unsigned int>> spilled_slots;
+    /// @brief Union-find parent of each vertex (equal to its own ID for the representative of a component), indexed by vertex ID
+    std::pmr::vector<unsigned int> component_parents;
+    /// @brief Number of verticies below each representative, indexed by vertex ID (only kept current for representatives)
+    std::pmr::vector<unsigned int> component_sizes;
+    /// @brief Number of components
+    unsigned int component_count;
+    /// @brief Total number of directed edges
+    unsigned long edge_count;
+    /// @brief Smallest weight any edge has held
+    Type min_weight;
+    /// @brief Largest weight any edge has held
+    Type max_weight;
+    /// @brief Number of edges matched by a reverse edge of equal weight (loops count once, as their own reverse edge)
+    unsigned long paired_edge_count;
+    /// @brief Whether every weight any edge has held is a whole number
+    bool integral_weights;
+    /// @brief Stamp drawn from `next_revision` whenever the verticies or edges change
+    std::uint64_t revision;
+};
@@ -0,0 +1,319 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "indexed_graph.hpp"
+#include "pair_minheap.hpp"
+
+
+/// @brief Minimum priority queue used by a Dijkstra search (see `choose_queue`)
+enum class queue_kind {
+    /// @brief Chosen by `choose_queue` from the edge weights recorded while the graph was built
+    automatic,
+    /// @brief Binary minimum heap of `paired_min_heap`, for any edge weights
+    binary_heap,
+    /// @brief Circular buckets of `dial_queue`, for whole edge weights with a small largest weight
+    dial_buckets,
+    /// @brief Buckets of `radix_heap`, for whole edge weights of any size
+    radix_heap
+};
+
+/// @brief Largest number of buckets (largest edge weight plus one) for which `choose_queue` selects a `dial_queue`
+inline constexpr std::uint64_t dial_queue_max_buckets = 4096;
+
+
+/**
+ * Monotone minimum priority queue of whole number priorities (Dial's algorithm), holding one bucket per priority within
+ * [minimum, minimum + `max_step`] in a circular array, so that insertion is constant time and extraction only advances past
+ * empty buckets
+ * @tparam Type typename of the priorities (edge weights and distances), whose values must all be whole numbers
+ * @tparam Key typename of the key identifying each node
+ * @note Priorities added must never be less than the last extracted priority or more than `max_step` above it, as holds for
+ * the distances added by a Dijkstra search whose heaviest edge weighs `max_step`
+ */
+template <class Type, class Key = unsigned int>
+class dial_queue final {
+public:
+    // Constructor creates an empty queue for priorities rising at most `max_step` above the minimum, allocating all storage from `resource`
+    dial_queue(std::uint64_t max_step, std::pmr::memory_resource* resource = std::pmr::get_default_resource()):
+        buckets(static_cast<size_t>(max_step + 1), resource), current(0), node_count(0) {}
+
+
+    /**
+         * Determines if the calling `dial_queue` is empty
+         * @return `true` if no node is held, else `false`
+         */
+    bool is_empty() const {
+        return node_count == 0;
+    }
+
+
+    /**
+         * Adds a node identified by `key` with priority `data`
+         * @param key Key identifying the node
+         * @param data Priority of the node
+         */
+    void add_node(Key key, Type data) {
+        auto priority = static_cast<std::uint64_t>(data);
+        buckets[static_cast<size_t>(priority % buckets.size())].push_back(key);
+        node_count++;
+    }
+
+
+    /**
+         * Retrieves the node with the smallest priority (Fails if the calling `dial_queue` is empty)
+         * @return Pair of the key and priority of the node with the smallest priority
+         */
+    std::pair<Key, Type> get_min() {
+        advance();
+        return {buckets[static_cast<size_t>(current % buckets.size())].back(), static_cast<Type>(current)};
+    }
+
+
+    /**
+         * Removes the node with the smallest priority (Fails if the calling `dial_queue` is empty)
+         * @return Pair of the key and priority of the removed node
+         */
+    std::pair<Key, Type> remove_min() {
+        auto min_node = get_min();
+        buckets[static_cast<size_t>(current % buckets.size())].pop_back();
+        node_count--;
+        return min_node;
+    }
+
+
+    /**
+         * Removes every node from the calling `dial_queue` while keeping the storage of its buckets for subsequent insertions,
+         * after which priorities may again start from 0
+         */
+    void clear() {
+        if (node_count != 0) {
+            for (auto& bucket : buckets) {
+                bucket.clear();
+            }
+        }
+        current = 0;
+        node_count = 0;
+    }
+
+
+    /**
+         * Retrieves the largest amount by which an added priority may exceed the last extracted priority
+         * @return Value of `max_step` given to the constructor
+         */
+    std::uint64_t get_max_step() const {
+        return static_cast<std::uint64_t>(buckets.size() - 1);
+    }
+
+private:
+    /**
+         * Moves `current` forward to the priority of the first non-empty bucket
+         * @throws `std::runtime_error` if the calling `dial_queue` is empty
+         */
+    void advance() {
+        if (node_count == 0) {
+            throw std::runtime_error("ERROR: Cannot return minimum value of an empty dial_queue object!");
+        }
+        while (buckets[static_cast<size_t>(current % buckets.size())].empty()) {
+            current++;
+        }
+    }
+
+    /// @brief Keys of the nodes of every priority, at index (priority modulo the number of buckets)
+    std::pmr::vector<std::pmr::vector<Key>> buckets;
+    /// @brief Smallest priority any held node may have
+    std::uint64_t current;
+    /// @brief Number of held nodes
+    size_t node_count;
+};
+
+
+/**
+ * Monotone minimum priority queue of whole number priorities (radix heap), holding each node within the bucket numbered by
+ * the highest bit in which its priority differs from the last extracted priority, so that a node moves to a lower bucket at most
+ * once per bit and every operation takes amortized time logarithmic in the largest edge weight
+ * @tparam Type typename of the priorities (edge weights and distances), whose values must all be whole numbers
+ * @tparam Key typename of the key identifying each node
+ * @note Priorities added must never be less than the last extracted priority, as holds for the distances added by a Dijkstra search
+ */
+template <class Type, class Key = unsigned int>
+class radix_heap final {
+public:
+    /// @brief Number of buckets: one for the last extracted priority, plus one for each bit of a priority
+    static constexpr size_t bucket_count = 65;
+
+    // Constructor creates an empty heap, allocating all storage from `resource`
+    radix_heap(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): buckets(bucket_count, resource), last(0),
+        node_count(0) {}
+
+
+    /**
+         * Determines if the calling `radix_heap` is empty
+         * @return `true` if no node is held, else `false`
+         */
+    bool is_empty() const {
+        return node_count == 0;
+    }
+
+
+    /**
+         * Adds a node identified by `key` with priority `data`
+         * @param key Key identifying the node
+         * @param data Priority of the node
+         */
+    void add_node(Key key, Type data) {
+        auto priority = static_cast<std::uint64_t>(data);
+        buckets[bucket_of(priority)].emplace_back(key, priority);
+        node_count++;
+    }
+
+
+    /**
+         * Retrieves the node with the smallest priority (Fails if the calling `radix_heap` is empty)
+         * @return Pair of the key and priority of the node with the smallest priority
+         */
+    std::pair<Key, Type> get_min() {
+        refill();
+        return {buckets[0].back().first, static_cast<Type>(buckets[0].back().second)};
+    }
+
+
+    /**
+         * Removes the node with the smallest priority (Fails if the calling `radix_heap` is empty)
+         * @return Pair of the key and priority of the removed node
+         */
+    std::pair<Key, Type> remove_min() {
+        auto min_node = get_min();
+        buckets[0].pop_back();
+        node_count--;
+        return min_node;
+    }
+
+
+    /**
+         * Removes every node from the calling `radix_heap` while keeping the storage of its buckets for subsequent insertions,
+         * after which priorities may again start from 0
+         */
+    void clear() {
+        if (node_count != 0) {
+            for (auto& bucket : buckets) {
+                bucket.clear();
+            }
+        }
+        last = 0;
+        node_count = 0;
+    }
+
+private:
+    /**
+         * Numbers the bucket of `priority` by the highest bit in which it differs from the last extracted priority
+         * @param priority Priority of a node
+         * @return Bucket index (0 if `priority` equals the last extracted priority)
+         */
+    size_t bucket_of(std::uint64_t priority) const {
+        std::uint64_t difference = priority ^ last;
+        if (difference == 0) {
+            return 0;
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(64 - __builtin_clzll(difference));
+#else
+        size_t bit_count = 0;
+        for (; difference != 0; difference >>= 1) {
+            bit_count++;
+        }
+        return bit_count;
+#endif
+    }
+
+    /**
+         * Fills the first bucket when it is empty, by making the smallest priority of the first non-empty bucket the last
+         * extracted priority and moving every node of that bucket to a lower bucket
+         * @throws `std::runtime_error` if the calling `radix_heap` is empty
+         */
+    void refill() {
+        if (node_count == 0) {
+            throw std::runtime_error("ERROR: Cannot return minimum value of an empty radix_heap object!");
+        }
+        if (!buckets[0].empty()) {
+            return;
+        }
+        size_t index = 1;
+        while (buckets[index].empty()) {
+            index++;
+        }
+        auto& source_bucket = buckets[index];
+        last = source_bucket.front().second;
+        for (const auto& node : source_bucket) {
+            last = std::min(last, node.second);
+        }
+        // Every node of the bucket shares all bits above bit `index` with the new minimum, so each moves to a lower bucket
+        for (const auto& node : source_bucket) {
+            buckets[bucket_of(node.second)].push_back(node);
+        }
+        source_bucket.clear();
+    }
+
+    /// @brief Keys and priorities of the nodes of every bucket
+    std::pmr::vector<std::pmr::vector<std::pair<Key, std::uint64_t>>> buckets;
+    /// @brief Last extracted priority (the smallest priority any held node may have)
+    std::uint64_t last;
+    /// @brief Number of held nodes
+    size_t node_count;
+};
+
+
+/**
+ * Chooses the minimum priority queue of a Dijkstra search of `graph` from the edge weights recorded while it was built: whole
+ * weights use a `dial_queue` if the largest weight yields at most `dial_queue_max_buckets` buckets, else a `radix_heap`, while
+ * fractional weights (or distances too long to be held exactly) use a `paired_min_heap`
+ * @tparam Type typename of the edge weights of the graph
+ * @param graph Graph to be searched
+ * @return Kind of queue for the graph (never `queue_kind::automatic`)
+ */
+template <class Type>
+queue_kind choose_queue(const indexed_graph<Type>& graph) {
+    // Distances must stay whole numbers, so no path may exceed the largest integer every weight type holds exactly (2^53 for double)
+    constexpr double exact_limit = 9007199254740992.0;
+    if (graph.get_edge_count() == 0 || !graph.has_integral_weights() || graph.get_min_weight() < Type{} ||
+        static_cast<double>(graph.get_max_weight()) * graph.get_vertex_count() >= exact_limit) {
+        return queue_kind::binary_heap;
+    }
+    if (static_cast<std::uint64_t>(graph.get_max_weight()) < dial_queue_max_buckets) {
+        return queue_kind::dial_buckets;
+    }
+    return queue_kind::radix_heap;
+}
+
+
+/**
+ * Creates the minimum priority queue of kind `kind` for a Dijkstra search of `graph` and passes it to `search`
+ * @tparam Type typename of the edge weights of the graph
+ * @param graph Graph to be searched
+ * @param kind Kind of queue (`queue_kind::automatic` is replaced by `choose_queue(graph)`)
+ * @param resource Memory resource from which the queue allocates all storage
+ * @param search Callable invoked with the queue as an lvalue reference, returning the same type for every kind of queue
+ * @return Result of `search`
+ */
+template <class Type, class Callable>
+auto with_priority_queue(const indexed_graph<Type>& graph, queue_kind kind, std::pmr::memory_resource* resource, Callable&& search) {
+    if (kind == queue_kind::automatic) {
+        kind = choose_queue(graph);
+    }
+    if (kind == queue_kind::dial_buckets) {
+        auto queue = dial_queue<Type, unsigned int>(static_cast<std::uint64_t>(graph.get_max_weight()), resource);
+        return search(queue);
+    }
+    if (kind == queue_kind::radix_heap) {
+        auto queue = radix_heap<Type, unsigned int>(resource);
+        return search(queue);
+    }
+    auto queue = paired_min_heap<Type, unsigned int>(graph.get_vertex_count(), resource);
+    return search(queue);
+}
@@ -0,0 +1,419 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "indexed_graph.hpp"
+#include "path_search.hpp"
+#include "pair_minheap.hpp"
+
+
+/**
+ * Single path found by `k_shortest_paths`
+ * @tparam Type typename of the edge weights of the searched graph
+ */
+template <class Type>
+struct ranked_path {
+    /// @brief Length of the path (the sum of its edge weights, added from the source vertex onwards)
+    Type distance;
+    /// @brief IDs of the verticies along the path, from the source vertex to the destination vertex
+    std::pmr::vector<unsigned int> verticies;
+};
+
+
+/**
+ * The `k` shortest loopless paths between two verticies, in order of length, found by Yen's algorithm: every path after the
+ * first is the shortest deviation (spur path) from a prefix (root path) of an earlier path that avoids the other verticies of the
+ * root path and every edge leaving the root path along an earlier path sharing the same root
+ * @tparam Type typename of the edge weights of the searched graph
+ *
+ * Spur searches are A* searches directed by the distances to the destination vertex within a single shortest path tree rooted
+ * at the destination vertex (the reverse tree), which remain lower bounds once verticies and edges are removed. A spur search
+ * finishes along the reverse tree as soon as it extracts a vertex whose reverse tree path avoids the root path, which usually
+ * happens within a few verticies of the spur vertex, and stops as soon as its root path and lower bound exceed the longest
+ * candidate that could still be accepted. Only the verticies from the point at which each path deviates from its parent path
+ * are spurred (Lawler's refinement), and candidates that can no longer be accepted are discarded before their reverse tree
+ * paths are copied. The spur searches of each accepted path are independent and run in parallel, and their candidates are
+ * merged in order of spur vertex (and ordered by length and then by vertex IDs) so the result never depends on the thread count
+ *
+ * @note The reverse tree follows outgoing edges, so lower bounds and reuse require edges stored in both directions with equal
+ * weights (as done by `build_adjacency_list`); spur searches of any other graph are complete Dijkstra searches
+ */
+template <class Type>
+class k_shortest_paths final {
+public:
+    // Constructor creates an empty set of paths, allocating the paths and all arrays indexed by vertex ID from `resource`
+    k_shortest_paths(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): paths{resource},
+        to_destination{resource}, toward_destination{resource}, tree_order{resource}, path_positions{resource},
+        first_blocking{resource}, destination(name_arena::invalid_id), exact_bounds(false), spur_search_count(0), reused_count(0),
+        settled_count(0) {}
+
+
+    /**
+         * Replaces the contents of the calling `k_shortest_paths` with up to `k` shortest loopless paths of `graph` from
+         * `source_id` to `destination_id`
+         * @param graph Graph to be searched, whose edge weights must all be positive
+         * @param source_id ID of the source vertex
+         * @param destination_id ID of the destination vertex
+         * @param k Largest number of paths to be found
+         * @param thread_count Maximum number of threads running the spur searches of each path (0 uses one thread per hardware thread)
+         * @return Number of paths found (fewer than `k` if no further loopless path exists)
+         */
+    size_t build(const indexed_graph<Type>& graph, unsigned int source_id, unsigned int destination_id, size_t k,
+        unsigned int thread_count = 0) {
+        paths.clear();
+        spur_search_count = 0;
+        reused_count = 0;
+        settled_count = 0;
+        if (k == 0) {
+            return 0;
+        }
+        if (thread_count == 0) {
+            thread_count = std::max(1U, std::thread::hardware_concurrency());
+        }
+        auto vertex_count = graph.get_vertex_count();
+        destination = destination_id;
+        exact_bounds = graph.is_symmetric();
+        tree_order.clear();
+        if (exact_bounds) {
+            shortest_path_tree(graph, destination_id, to_destination, toward_destination);
+            // Every vertex follows a strictly nearer vertex towards the destination vertex, so this order visits it after its successor
+            for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+                if (to_destination[vertex] != unreachable_distance<Type>()) {
+                    tree_order.push_back(vertex);
+                }
+            }
+            std::sort(tree_order.begin(), tree_order.end(), [&](unsigned int a, unsigned int b) {
+                return to_destination[a] < to_destination[b];
+            });
+        } else {
+            to_destination.assign(vertex_count, Type{});
+            toward_destination.assign(vertex_count, name_arena::invalid_id);
+        }
+        path_positions.assign(vertex_count, name_arena::invalid_id);
+        first_blocking.assign(vertex_count, name_arena::invalid_id);
+        std::vector<spur_scratch> scratch(thread_count);
+        // Candidate paths keyed by length and vertex IDs, each holding the position at which it deviates from its parent path
+        std::map<std::pair<Type, std::vector<unsigned int>>, size_t> candidates;
+
+        // The shortest path is the spur path of the source vertex with nothing removed
+        std::pmr::vector<unsigned int> parent_path(1, source_id, paths.get_allocator().resource());
+        size_t deviation = 0;
+        size_t end_index = 1;
+        while (true) {
+            run_spurs(graph, parent_path, deviation, end_index, k, candidates, scratch, thread_count);
+            if (candidates.empty()) {
+                break;
+            }
+            auto shortest = candidates.begin();
+            paths.push_back(ranked_path<Type>{shortest->first.first, std::pmr::vector<unsigned int>(shortest->first.second.begin(),
+                shortest->first.second.end(), paths.get_allocator().resource())});
+            deviation = shortest->second;
+            candidates.erase(shortest);
+            if (paths.size() == k) {
+                break;
+            }
+            // Every vertex of an accepted path except the destination vertex is a spur vertex
+            parent_path = paths.back().verticies;
+            end_index = parent_path.size() - 1;
+        }
+        return paths.size();
+    }
+
+
+    /**
+         * Retrieves the number of paths found by `build`
+         * @return Number of paths
+         */
+    size_t get_path_count() const {
+        return paths.size();
+    }
+
+
+    /**
+         * Retrieves the path of rank `rank`
+         * @param rank Position of the path in order of length (0 for the shortest path)
+         * @return Length and verticies of the path
+         */
+    const ranked_path<Type>& get_path(size_t rank) const {
+        return paths[rank];
+    }
+
+
+    /**
+         * Retrieves the number of spur searches run by `build`
+         * @return Number of spur searches
+         */
+    unsigned long get_spur_search_count() const {
+        return spur_search_count;
+    }
+
+
+    /**
+         * Retrieves the number of spur searches finished along the reverse tree before reaching the destination vertex
+         * @return Number of spur paths ending with a reverse tree path
+         */
+    unsigned long get_reused_count() const {
+        return reused_count;
+    }
+
+
+    /**
+         * Retrieves the number of verticies settled across every spur search (excluding the reverse tree)
+         * @return Number of settled verticies
+         */
+    unsigned long get_settled_count() const {
+        return settled_count;
+    }
+
+private:
+    /// @brief Arrays reused by the spur searches of a single thread, sized to the graph on first use and restored after each search
+    struct spur_scratch {
+        /// @brief Distance from the spur vertex to each vertex reached by the current search, indexed by vertex ID
+        std::vector<Type> distances;
+        /// @brief ID of the vertex preceding each vertex reached by the current search, indexed by vertex ID
+        std::vector<unsigned int> predecessors;
+        /// @brief IDs of the verticies whose distance was set by the current search
+        std::vector<unsigned int> touched;
+        /// @brief Number of spur searches and reused spur paths, and the verticies settled by the searches
+        unsigned long search_count = 0, reuse_count = 0, settle_count = 0;
+    };
+
+    /// @brief Spur of an accepted path and the spur path found from it
+    struct spur_task {
+        /// @brief Position of the spur vertex within the parent path
+        size_t index;
+        /// @brief Length of the root path up to the spur vertex
+        Type root_distance;
+        /// @brief Targets of the edges leaving the spur vertex along earlier paths sharing the root path
+        std::vector<unsigned int> removed_targets;
+        /// @brief Verticies extracted by the search along the spur path, from the spur vertex to the vertex whose reverse tree path
+        /// completes it (empty if no spur path was found)
+        std::vector<unsigned int> spur_path;
+        /// @brief Length of the found path from the source vertex (estimated from the reverse tree until the path is kept)
+        Type distance;
+    };
+
+
+    /**
+         * Finds the spur paths of `parent_path` from every spur vertex within [`first_index`, `end_index`), adding the resulting
+         * paths to `candidates`
+         * @param graph Graph to be searched
+         * @param parent_path Verticies of the last accepted path (or the source vertex alone before the first path is found)
+         * @param first_index Position of the first spur vertex
+         * @param end_index Position following the last spur vertex
+         * @param k Largest number of paths to be found
+         * @param candidates Candidate paths found so far, holding no more than the paths still to be accepted
+         * @param scratch Arrays of each thread
+         * @param thread_count Maximum number of threads
+         */
+    void run_spurs(const indexed_graph<Type>& graph, const std::pmr::vector<unsigned int>& parent_path, size_t first_index,
+        size_t end_index, size_t k, std::map<std::pair<Type, std::vector<unsigned int>>, size_t>& candidates,
+        std::vector<spur_scratch>& scratch, unsigned int thread_count) {
+        if (first_index >= end_index) {
+            return;
+        }
+        // The spur search of position i removes every parent path vertex before position i, and a reverse tree path avoids its
+        // root path if the first parent path vertex along it lies beyond position i
+        for (size_t i = 0; i < parent_path.size(); i++) {
+            path_positions[parent_path[i]] = static_cast<unsigned int>(i);
+        }
+        for (unsigned int vertex : tree_order) {
+            first_blocking[vertex] = path_positions[vertex];
+            if (vertex != destination) {
+                first_blocking[vertex] = std::min(first_blocking[vertex], first_blocking[toward_destination[vertex]]);
+            }
+        }
+
+        // Number of leading verticies each accepted path shares with the parent path
+        std::vector<size_t> shared_lengths;
+        for (const auto& path : paths) {
+            auto mismatch = std::mismatch(parent_path.begin(), parent_path.end(), path.verticies.begin(), path.verticies.end());
+            shared_lengths.push_back(static_cast<size_t>(mismatch.first - parent_path.begin()));
+        }
+        std::vector<spur_task> tasks;
+        Type root_distance = 0;
+        for (size_t index = 0; index < end_index; index++) {
+            if (index > 0) {
+                root_distance = graph.get_edge_weight(parent_path[index - 1], parent_path[index]) + root_distance;
+            }
+            if (index < first_index) {
+                continue;
+            }
+            spur_task task{index, root_distance, {}, {}, unreachable_distance<Type>()};
+            for (size_t p = 0; p < paths.size(); p++) {
+                if (shared_lengths[p] > index && paths[p].verticies.size() > index + 1) {
+                    task.removed_targets.push_back(paths[p].verticies[index + 1]);
+                }
+            }
+            tasks.push_back(std::move(task));
+        }
+        // Only the candidates that could still be accepted matter, so no spur path may be longer than the last of them
+        size_t needed = k - paths.size();
+        Type limit = candidates.size() >= needed ? std::prev(candidates.end())->first.first : unreachable_distance<Type>();
+
+        auto worker_count = static_cast<unsigned int>(std::min<size_t>(thread_count, tasks.size()));
+        std::atomic<size_t> next_task{0};
+        auto claim_tasks = [&](unsigned int worker) {
+            for (size_t t = next_task++; t < tasks.size(); t = next_task++) {
+                find_spur_path(graph, parent_path, tasks[t], limit, scratch[worker]);
+            }
+        };
+        std::vector<std::thread> workers;
+        for (unsigned int w = 1; w < worker_count; w++) {
+            workers.emplace_back(claim_tasks, w);
+        }
+        claim_tasks(0);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (auto& thread_scratch : scratch) {
+            spur_search_count += std::exchange(thread_scratch.search_count, 0);
+            reused_count += std::exchange(thread_scratch.reuse_count, 0);
+            settled_count += std::exchange(thread_scratch.settle_count, 0);
+        }
+
+        // Candidates are merged in order of spur vertex, and a path found more than once keeps its earliest deviation
+        for (auto& task : tasks) {
+            if (task.spur_path.empty() || (candidates.size() >= needed && std::prev(candidates.end())->first.first < task.distance)) {
+                continue;
+            }
+            std::vector<unsigned int> candidate(parent_path.begin(), parent_path.begin() + static_cast<long>(task.index));
+            candidate.insert(candidate.end(), task.spur_path.begin(), task.spur_path.end());
+            while (candidate.back() != destination) {
+                candidate.push_back(toward_destination[candidate.back()]);
+            }
+            // Lengths of kept paths are summed from the source vertex onwards, in the same order as every other search
+            task.distance = task.root_distance;
+            for (size_t i = task.index + 1; i < candidate.size(); i++) {
+                task.distance = graph.get_edge_weight(candidate[i - 1], candidate[i]) + task.distance;
+            }
+            auto inserted = candidates.emplace(std::make_pair(task.distance, std::move(candidate)), task.index);
+            if (!inserted.second) {
+                inserted.first->second = std::min(inserted.first->second, task.index);
+            }
+            // Candidates beyond the number of paths still to be accepted can never be accepted
+            if (candidates.size() > needed) {
+                candidates.erase(std::prev(candidates.end()));
+            }
+        }
+        for (unsigned int vertex : parent_path) {
+            path_positions[vertex] = name_arena::invalid_id;
+        }
+    }
+
+
+    /**
+         * Finds the shortest path from the spur vertex of `task` to the destination vertex avoiding the root path and removed edges
+         * of `task` with an A* search, which finishes along the reverse tree as soon as it extracts a vertex whose reverse tree
+         * path avoids the root path (as no other path can then be shorter)
+         * @param graph Graph to be searched
+         * @param parent_path Verticies of the path the spur vertex belongs to
+         * @param task Spur to be searched, receiving the extracted verticies of the found spur path and its estimated length
+         * @param limit Length beyond which no spur path is needed
+         * @param scratch Arrays of the calling thread
+         */
+    void find_spur_path(const indexed_graph<Type>& graph, const std::pmr::vector<unsigned int>& parent_path, spur_task& task,
+        Type limit, spur_scratch& scratch) const {
+        unsigned int spur_vertex = parent_path[task.index];
+        if (to_destination[spur_vertex] == unreachable_distance<Type>()) {
+            return;
+        }
+        auto vertex_count = graph.get_vertex_count();
+        if (scratch.distances.size() != vertex_count) {
+            scratch.distances.assign(vertex_count, unreachable_distance<Type>());
+            scratch.predecessors.assign(vertex_count, name_arena::invalid_id);
+        }
+        auto spur_position = static_cast<unsigned int>(task.index);
+
+        scratch.search_count++;
+        auto heap = paired_min_heap<Type, unsigned int>(64);
+        scratch.distances[spur_vertex] = 0;
+        scratch.touched.push_back(spur_vertex);
+        heap.add_node(spur_vertex, to_destination[spur_vertex]);
+        unsigned int popped_vertex = 0;
+        Type popped_estimate = 0;
+        unsigned int last_vertex = name_arena::invalid_id;
+        while (!heap.is_empty()) {
+            std::tie(popped_vertex, popped_estimate) = heap.remove_min();
+            Type popped_distance = scratch.distances[popped_vertex];
+            if (popped_estimate > popped_distance + to_destination[popped_vertex]) {
+                continue;
+            }
+            if (popped_estimate + task.root_distance > limit) {
+                break;
+            }
+            scratch.settle_count++;
+            // The reverse tree path of the spur vertex itself may leave along a removed edge, so it is never reused
+            if (popped_vertex == destination || (exact_bounds && first_blocking[popped_vertex] > spur_position)) {
+                last_vertex = popped_vertex;
+                task.distance = popped_estimate + task.root_distance;
+                break;
+            }
+            for (const auto& adjacent_edge : graph.get_adjacent(popped_vertex)) {
+                unsigned int target = adjacent_edge.target;
+                if (to_destination[target] == unreachable_distance<Type>() || path_positions[target] < spur_position ||
+                    (popped_vertex == spur_vertex &&
+                    std::find(task.removed_targets.begin(), task.removed_targets.end(), target) != task.removed_targets.end())) {
+                    continue;
+                }
+                Type di = adjacent_edge.weight + popped_distance;
+                if (di < scratch.distances[target]) {
+                    if (scratch.distances[target] == unreachable_distance<Type>()) {
+                        scratch.touched.push_back(target);
+                    }
+                    scratch.distances[target] = di;
+                    scratch.predecessors[target] = popped_vertex;
+                    heap.add_node(target, di + to_destination[target]);
+                }
+            }
+        }
+
+        if (last_vertex != name_arena::invalid_id) {
+            if (last_vertex != destination) {
+                scratch.reuse_count++;
+            }
+            for (unsigned int vertex = last_vertex; vertex != spur_vertex; vertex = scratch.predecessors[vertex]) {
+                task.spur_path.push_back(vertex);
+            }
+            task.spur_path.push_back(spur_vertex);
+            std::reverse(task.spur_path.begin(), task.spur_path.end());
+        }
+        for (unsigned int vertex : scratch.touched) {
+            scratch.distances[vertex] = unreachable_distance<Type>();
+            scratch.predecessors[vertex] = name_arena::invalid_id;
+        }
+        scratch.touched.clear();
+    }
+
+    /// @brief Paths found by `build`, in order of length
+    std::pmr::vector<ranked_path<Type>> paths;
+    /// @brief Shortest distance from each vertex to the destination vertex (all 0 if the reverse tree is not exact), indexed by vertex ID
+    std::pmr::vector<Type> to_destination;
+    /// @brief ID of the vertex following each vertex on its shortest path to the destination vertex, indexed by vertex ID
+    std::pmr::vector<unsigned int> toward_destination;
+    /// @brief IDs of the verticies reaching the destination vertex, in order of their distance to it
+    std::pmr::vector<unsigned int> tree_order;
+    /// @brief Position of each vertex within the parent path being spurred (`name_arena::invalid_id` if absent), indexed by vertex ID
+    std::pmr::vector<unsigned int> path_positions;
+    /// @brief Smallest position within the parent path of any vertex along each vertex's reverse tree path, indexed by vertex ID
+    std::pmr::vector<unsigned int> first_blocking;
+    /// @brief ID of the destination vertex
+    unsigned int destination;
+    /// @brief Whether the reverse tree holds exact distances to the destination vertex (the graph is symmetric)
+    bool exact_bounds;
+    /// @brief Number of spur searches run by `build`
+    unsigned long spur_search_count;
+    /// @brief Number of spur searches of `build` finished along the reverse tree
+    unsigned long reused_count;
+    /// @brief Number of verticies settled by the spur searches of `build`
+    unsigned long settled_count;
+};
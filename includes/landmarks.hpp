@@ -0,0 +1,313 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "indexed_graph.hpp"
+#include "path_search.hpp"
+#include "pair_minheap.hpp"
+
+
+/**
+ * Precomputed shortest distances between a small set of landmark verticies and every vertex of a graph, used to derive
+ * admissible lower bounds on the distance between any two verticies through the triangle inequality (ALT preprocessing)
+ * @tparam Type typename of the edge weights of the graph
+ *
+ * Landmarks are chosen by farthest-point selection, where each landmark is the vertex farthest from all previously chosen
+ * landmarks (verticies of components without a landmark are chosen first), so that landmarks lie on the periphery of the graph
+ *
+ * @note Distances are stored vertex-major, so computing the lower bound of a vertex reads a single contiguous row
+ * @note Tables are only valid for the graph they were built from, which is identified by a fingerprint of its verticies and edges
+ * when tables are saved to and loaded from files
+ */
+template <class Type>
+class landmark_table final {
+public:
+    /// @brief Number of landmarks selected by `build` if no landmark count is provided
+    static constexpr unsigned int default_landmark_count = 8;
+    /// @brief Extension appended to the name of a graph text file to form the name of its landmark table file
+    static constexpr const char* file_extension = ".alt";
+
+    // Constructor creates an empty table (bounding every distance by 0), allocating all storage from `resource`
+    landmark_table(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): landmarks{resource},
+        table{resource}, vertex_count(0), graph_fingerprint(0) {}
+
+
+    /**
+         * Selects up to `landmark_count` landmarks within `graph` and computes the distance from each landmark to every vertex
+         * @param graph Graph whose edges are stored in both directions with equal weights (as done by `build_adjacency_list`)
+         * @param landmark_count Maximum number of landmarks to select (limited to the number of verticies in `graph`)
+         */
+    void build(const indexed_graph<Type>& graph, unsigned int landmark_count = default_landmark_count) {
+        vertex_count = graph.get_vertex_count();
+        graph_fingerprint = graph.get_fingerprint();
+        landmarks.clear();
+        table.clear();
+        if (vertex_count == 0) {
+            return;
+        }
+        landmark_count = std::min(landmark_count, vertex_count);
+        table.assign(static_cast<size_t>(vertex_count) * landmark_count, unreachable_distance<Type>());
+
+        std::pmr::unsynchronized_pool_resource build_pool;
+        std::pmr::vector<Type> distances(&build_pool);
+        std::pmr::vector<unsigned int> vertex_path(&build_pool);
+        // Minimum distance from each vertex to any chosen landmark (infinite until the vertex is reached from a landmark)
+        std::pmr::vector<Type> nearest_landmark(vertex_count, unreachable_distance<Type>(), &build_pool);
+
+        // The first landmark is the vertex farthest from vertex 0
+        shortest_path_tree(graph, 0, distances, vertex_path);
+        unsigned int next_landmark = farthest_vertex(distances);
+        while (landmarks.size() < landmark_count) {
+            unsigned int column = static_cast<unsigned int>(landmarks.size());
+            landmarks.push_back(next_landmark);
+            shortest_path_tree(graph, next_landmark, distances, vertex_path);
+            for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+                table[static_cast<size_t>(vertex) * landmark_count + column] = distances[vertex];
+                nearest_landmark[vertex] = std::min(nearest_landmark[vertex], distances[vertex]);
+            }
+            next_landmark = farthest_vertex(nearest_landmark);
+            // Stop early once every vertex is itself a landmark
+            if (nearest_landmark[next_landmark] == 0) {
+                break;
+            }
+        }
+        // Discard unused columns if fewer landmarks than requested were selected
+        if (landmarks.size() < landmark_count) {
+            auto used_count = static_cast<unsigned int>(landmarks.size());
+            for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+                for (unsigned int column = 0; column < used_count; column++) {
+                    table[static_cast<size_t>(vertex) * used_count + column] = table[static_cast<size_t>(vertex) * landmark_count + column];
+                }
+            }
+            table.resize(static_cast<size_t>(vertex_count) * used_count);
+        }
+    }
+
+
+    /**
+         * Computes a lower bound on the length of the shortest path between `vertex` and `target`
+         * @param vertex ID of the vertex the path starts from
+         * @param target ID of the vertex the path leads to
+         * @return Largest difference between the landmark distances of both verticies (infinity if any landmark reaches
+         * exactly one of them, meaning no path exists)
+         */
+    Type lower_bound(unsigned int vertex, unsigned int target) const {
+        Type bound = 0;
+        size_t count = landmarks.size();
+        const Type* vertex_row = table.data() + static_cast<size_t>(vertex) * count;
+        const Type* target_row = table.data() + static_cast<size_t>(target) * count;
+        for (size_t column = 0; column < count; column++) {
+            bool vertex_reached = vertex_row[column] != unreachable_distance<Type>();
+            bool target_reached = target_row[column] != unreachable_distance<Type>();
+            if (vertex_reached != target_reached) {
+                return unreachable_distance<Type>();
+            }
+            if (vertex_reached) {
+                Type difference = vertex_row[column] > target_row[column] ? vertex_row[column] - target_row[column] : target_row[column] - vertex_row[column];
+                bound = std::max(bound, difference);
+            }
+        }
+        return bound;
+    }
+
+
+    /**
+         * Retrieves the IDs of all selected landmarks in order of selection
+         * @return Array of landmark vertex IDs
+         */
+    const std::pmr::vector<unsigned int>& get_landmarks() const {
+        return landmarks;
+    }
+
+
+    /**
+         * Retrieves the number of verticies of the graph the calling `landmark_table` was built from
+         * @return Number of verticies covered by the distance tables
+         */
+    unsigned int get_vertex_count() const {
+        return vertex_count;
+    }
+
+
+    /**
+         * Determines whether the calling `landmark_table` was built from a graph identical to `graph`
+         * @param graph Graph to be compared against
+         * @return `true` if the number of verticies and the fingerprint of `graph` match, else `false`
+         */
+    bool matches(const indexed_graph<Type>& graph) const {
+        return vertex_count == graph.get_vertex_count() && graph_fingerprint == graph.get_fingerprint();
+    }
+
+
+    /**
+         * Writes the landmarks and distance tables to the binary file `filename`
+         * @param filename Relative path to the file to be written
+         * @return 0 if successful, -1 upon failure
+         */
+    int save(const std::string& filename) const {
+        static_assert(std::is_trivially_copyable_v<Type>, "Landmark tables can only be saved for trivially copyable weight types");
+        std::ofstream write_file(filename, std::ios::binary | std::ios::trunc);
+        if (!write_file.is_open()) {
+            std::cerr << "ERROR: Could not open file '" << filename << "' for writing landmark tables!" << '\n';
+            return -1;
+        }
+        std::uint32_t landmark_count = static_cast<std::uint32_t>(landmarks.size());
+        std::uint32_t type_size = static_cast<std::uint32_t>(sizeof(Type));
+        write_file.write(file_tag, sizeof(file_tag));
+        write_file.write(reinterpret_cast<const char*>(&type_size), sizeof(type_size));
+        write_file.write(reinterpret_cast<const char*>(&vertex_count), sizeof(vertex_count));
+        write_file.write(reinterpret_cast<const char*>(&landmark_count), sizeof(landmark_count));
+        write_file.write(reinterpret_cast<const char*>(&graph_fingerprint), sizeof(graph_fingerprint));
+        write_file.write(reinterpret_cast<const char*>(landmarks.data()), static_cast<std::streamsize>(landmarks.size() * sizeof(unsigned int)));
+        write_file.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(Type)));
+        if (!write_file.good()) {
+            std::cerr << "ERROR: An error was encountered while writing landmark tables to '" << filename << "'!" << '\n';
+            return -1;
+        }
+        return 0;
+    }
+
+
+    /**
+         * Replaces the contents of the calling `landmark_table` with the tables stored in the binary file `filename`, if they
+         * were built from a graph identical to `graph`
+         * @param filename Relative path to the file written by `save`
+         * @param graph Graph the loaded tables will be used with
+         * @return 0 if successful, -1 if the file does not exist, cannot be read or was built from a different graph
+         * (the calling `landmark_table` is left unchanged)
+         */
+    int load(const std::string& filename, const indexed_graph<Type>& graph) {
+        std::ifstream read_file(filename, std::ios::binary);
+        if (!read_file.is_open()) {
+            return -1;
+        }
+        char tag[sizeof(file_tag)] = {};
+        std::uint32_t type_size = 0;
+        unsigned int file_vertex_count = 0;
+        std::uint32_t landmark_count = 0;
+        std::uint64_t file_fingerprint = 0;
+        read_file.read(tag, sizeof(tag));
+        read_file.read(reinterpret_cast<char*>(&type_size), sizeof(type_size));
+        read_file.read(reinterpret_cast<char*>(&file_vertex_count), sizeof(file_vertex_count));
+        read_file.read(reinterpret_cast<char*>(&landmark_count), sizeof(landmark_count));
+        read_file.read(reinterpret_cast<char*>(&file_fingerprint), sizeof(file_fingerprint));
+        if (!read_file.good() || std::memcmp(tag, file_tag, sizeof(file_tag)) != 0 || type_size != sizeof(Type) ||
+            file_vertex_count != graph.get_vertex_count() || landmark_count > file_vertex_count || file_fingerprint != graph.get_fingerprint()) {
+            return -1;
+        }
+        std::pmr::vector<unsigned int> file_landmarks(landmark_count, 0, landmarks.get_allocator());
+        std::pmr::vector<Type> file_table(static_cast<size_t>(file_vertex_count) * landmark_count, Type{}, table.get_allocator());
+        read_file.read(reinterpret_cast<char*>(file_landmarks.data()), static_cast<std::streamsize>(file_landmarks.size() * sizeof(unsigned int)));
+        read_file.read(reinterpret_cast<char*>(file_table.data()), static_cast<std::streamsize>(file_table.size() * sizeof(Type)));
+        if (!read_file.good()) {
+            return -1;
+        }
+        for (unsigned int landmark : file_landmarks) {
+            if (landmark >= file_vertex_count) {
+                return -1;
+            }
+        }
+        landmarks = std::move(file_landmarks);
+        table = std::move(file_table);
+        vertex_count = file_vertex_count;
+        graph_fingerprint = file_fingerprint;
+        return 0;
+    }
+
+
+private:
+    /**
+         * Locates the vertex with the greatest distance within `distances`, treating unreachable verticies as farthest
+         * @param distances Array of distances indexed by vertex ID
+         * @return ID of the farthest vertex (the lowest such ID if several are equally far)
+         */
+    static unsigned int farthest_vertex(const std::pmr::vector<Type>& distances) {
+        unsigned int farthest = 0;
+        for (unsigned int vertex = 1; vertex < static_cast<unsigned int>(distances.size()); vertex++) {
+            if (distances[vertex] > distances[farthest]) {
+                farthest = vertex;
+            }
+        }
+        return farthest;
+    }
+
+    /// @brief Tag identifying landmark table files (and their format version)
+    static constexpr char file_tag[8] = {'G', 'R', 'P', 'H', 'A', 'L', 'T', '1'};
+    /// @brief IDs of all selected landmarks, in order of selection
+    std::pmr::vector<unsigned int> landmarks;
+    /// @brief Distance from each landmark to each vertex, stored vertex-major (`table[vertex * landmark count + landmark]`)
+    std::pmr::vector<Type> table;
+    /// @brief Number of verticies of the graph the tables were built from
+    unsigned int vertex_count;
+    /// @brief Fingerprint of the graph the tables were built from
+    std::uint64_t graph_fingerprint;
+};
+
+
+/**
+ * Finds the shortest path between `source_id` and `destination_id` with an A* search whose heuristic is the landmark lower
+ * bound of each vertex, so verticies leading away from the destination vertex are settled late or not at all (ALT search)
+ * @tparam Type typename of the edge weights of the searched graph
+ * @param graph Graph to be searched
+ * @param source_id ID of the source vertex
+ * @param destination_id ID of the destination vertex
+ * @param landmarks Landmark tables built from `graph`
+ * @param distances Filled with the shortest known distance from the source vertex to each vertex (see `forward_search`)
+ * @param vertex_path Filled with the ID of the vertex preceding each reached vertex on its shortest path (see `forward_search`)
+ * @return Distance to the destination vertex and the number of settled verticies
+ * @note Landmark lower bounds are consistent, so each vertex is settled at most once
+ */
+template <class Type>
+path_search_result<Type> landmark_search(const indexed_graph<Type>& graph, unsigned int source_id, unsigned int destination_id,
+    const landmark_table<Type>& landmarks, std::pmr::vector<Type>& distances, std::pmr::vector<unsigned int>& vertex_path) {
+    auto vertex_count = graph.get_vertex_count();
+    std::pmr::memory_resource* scratch = distances.get_allocator().resource();
+    distances.assign(vertex_count, unreachable_distance<Type>());
+    vertex_path.assign(vertex_count, name_arena::invalid_id);
+    std::pmr::vector<bool> settled(vertex_count, false, scratch);
+    // Heap is keyed by the distance from the source vertex plus the lower bound of the remaining distance to the destination vertex
+    auto mhp = paired_min_heap<Type, unsigned int>(vertex_count, scratch);
+
+    path_search_result<Type> result{unreachable_distance<Type>(), 0};
+    distances[source_id] = 0;
+    mhp.add_node(source_id, landmarks.lower_bound(source_id, destination_id));
+    unsigned int popped_vertex = 0;
+    Type popped_vertex_estimate = 0;
+    while (!mhp.is_empty()) {
+        std::tie(popped_vertex, popped_vertex_estimate) = mhp.remove_min();
+        if (settled[popped_vertex]) {
+            continue;
+        }
+        settled[popped_vertex] = true;
+        result.settled_count++;
+        if (popped_vertex == destination_id) {
+            break;
+        }
+        Type popped_vertex_distance = distances[popped_vertex];
+        for (const auto& adjacent_edge : graph.get_adjacent(popped_vertex)) {
+            Type di = adjacent_edge.weight + popped_vertex_distance;
+            if (!settled[adjacent_edge.target] && di < distances[adjacent_edge.target]) {
+                Type bound = landmarks.lower_bound(adjacent_edge.target, destination_id);
+                // Verticies from which the destination vertex cannot be reached are never explored
+                if (bound == unreachable_distance<Type>()) {
+                    continue;
+                }
+                distances[adjacent_edge.target] = di;
+                vertex_path[adjacent_edge.target] = popped_vertex;
+                mhp.add_node(adjacent_edge.target, di + bound);
+            }
+        }
+    }
+    gprintf("Landmark search settled %u verticies", result.settled_count);
+    result.distance = distances[destination_id];
+    return result;
+}
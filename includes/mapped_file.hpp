@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+
+/**
+ * Read-only view of the entire contents of a binary file, which is memory-mapped on Linux (so pages are only loaded
+ * when first read and are shared between processes mapping the same file) and otherwise read into a single buffer
+ *
+ * @note The address returned by `data` is aligned to at least 16 bytes and remains unchanged when the `mapped_file` is moved
+ */
+class mapped_file final {
+public:
+    // Constructor creates an empty view that does not refer to any file
+    mapped_file(): bytes(nullptr), byte_count(0), mapped(false) {}
+    ~mapped_file();
+
+    // Copying would unmap the shared view twice
+    mapped_file(const mapped_file& other_file) = delete;
+    mapped_file& operator=(const mapped_file& other_file) = delete;
+    // Move Constructor and Move operator (the mapping or buffer is transferred, so the address of the contents is unchanged)
+    mapped_file(mapped_file&& old_file) noexcept;
+    mapped_file& operator=(mapped_file&& old_file) noexcept;
+
+
+    /**
+         * Replaces the current view with the contents of `filename`
+         * @param filename Relative path to the file to be viewed
+         * @return 0 if successful, -1 if the file does not exist, is empty or cannot be read (the calling `mapped_file` is then empty)
+         */
+    int open(const std::string& filename);
+
+
+    /**
+         * Releases the current view, leaving the calling `mapped_file` empty
+         */
+    void close();
+
+
+    /**
+         * Retrieves the first byte of the viewed file
+         * @return Pointer to the file contents, or `nullptr` if no file is viewed
+         */
+    const char* data() const;
+
+
+    /**
+         * Retrieves the number of bytes of the viewed file
+         * @return Size of the file contents (0 if no file is viewed)
+         */
+    size_t size() const;
+
+
+    /**
+         * Determines whether the viewed file is memory-mapped rather than read into a buffer
+         * @return `true` if the contents are memory-mapped, else `false`
+         */
+    bool is_mapped() const;
+
+private:
+    /// @brief First byte of the mapping or buffer holding the file contents
+    const char* bytes;
+    /// @brief Number of bytes of the file contents
+    size_t byte_count;
+    /// @brief `true` if `bytes` refers to a memory mapping, `false` if it refers to `buffer`
+    bool mapped;
+    /// @brief Buffer holding the file contents on platforms without memory mapping
+    std::unique_ptr<char[]> buffer;
+};
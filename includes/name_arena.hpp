@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+/**
+ * Interning storage for vertex names that stores each distinct name exactly once and identifies it by a dense
+ * integer ID (0 to size - 1) assigned in order of first appearance
+ *
+ * The characters of all names are packed back to back within large contiguous blocks of a monotonic buffer, so
+ * containers built on top of a `name_arena` only hold 4-byte IDs or `std::string_view` objects instead of a separately
+ * allocated string per reference to a vertex
+ *
+ * @note Views returned by `get_name` remain valid for the lifetime of the `name_arena` (including after it is moved), and
+ * each stored name is followed by a null terminator so `get_name(id).data()` can be passed to C-style formatting functions
+ * @note Name lookups use an open-addressing table of IDs with quadratic probing and prime capacities (see `soa_hashmap`)
+ */
+class name_arena final {
+public:
+    /// @brief ID returned by `find_id` when the requested name has not been interned
+    static constexpr unsigned int invalid_id = UINT32_MAX;
+
+    // Constructor reserves space for `c` distinct names, allocating all storage from `resource`
+    name_arena(unsigned int c, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    // Constructor defaults to space for 5 names if no capacity argument is provided
+    name_arena(): name_arena(5) {}
+
+    // Copying would leave the copied views pointing into the storage of the original object
+    name_arena(const name_arena& other_arena) = delete;
+    name_arena& operator=(const name_arena& other_arena) = delete;
+    // Move Constructor and Move operator (character blocks are transferred, so existing views stay valid)
+    name_arena(name_arena&& old_arena) noexcept;
+    name_arena& operator=(name_arena&& old_arena) noexcept;
+
+
+    /**
+         * Stores `name` within the calling `name_arena` if it has not been stored before
+         * @param name Name to be interned
+         * @return ID of the stored copy of `name` (the existing ID if `name` was already interned)
+         */
+    unsigned int intern(std::string_view name);
+
+
+    /**
+         * Looks up the ID of a previously interned name
+         * @param name Name to be located
+         * @return ID of `name`, or `invalid_id` if `name` has not been interned
+         */
+    unsigned int find_id(std::string_view name) const;
+
+
+    /**
+         * Retrieves the ID of a previously interned name (Fails if `name` has not been interned)
+         * @param name Name to be located
+         * @return ID of `name`
+         */
+    unsigned int get_id(std::string_view name) const;
+
+
+    /**
+         * Determines whether `name` has been interned within the calling `name_arena`
+         * @param name Name to be located
+         * @return `true` if `name` has been interned, else `false`
+         */
+    bool contains_name(std::string_view name) const;
+
+
+    /**
+         * Retrieves the stored characters of the name with matching `id` (Fails if `id` is not a valid ID)
+         * @param id ID of the name to be retrieved
+         * @return View of the stored name, valid for the lifetime of the calling `name_arena`
+         */
+    std::string_view get_name(unsigned int id) const;
+
+
+    /**
+         * Retrieves the number of distinct names interned within the calling `name_arena`
+         * @return Number of interned names (one greater than the largest valid ID)
+         */
+    unsigned int get_size() const;
+
+
+    /**
+         * Retrieves the total number of name characters (including null terminators) held within the character blocks
+         * of the calling `name_arena`
+         * @return Number of bytes occupied by interned names
+         */
+    size_t get_name_bytes() const;
+
+
+    /**
+         * Retrieves the memory resource from which the ID table and character blocks are allocated
+         * @return Pointer to the `std::pmr::memory_resource` used by the calling `name_arena`
+         */
+    std::pmr::memory_resource* get_memory_resource() const;
+
+private:
+    /**
+         * Rebuilds the open-addressing ID table with a capacity of `new_capacity` (or the next greater prime value)
+         * @param new_capacity Minimum capacity of the rebuilt ID table
+         */
+    void resize_table(unsigned int new_capacity);
+
+
+    /**
+         * Locates the index position of `name` within `id_table`, or the empty position where it would be placed
+         * @param name Name to be located
+         * @return Index position within `id_table`
+         */
+    size_t probe(std::string_view name) const;
+
+    /// @brief Views of every interned name, indexed by ID
+    std::pmr::vector<std::string_view> names;
+    /// @brief Open-addressing table holding the IDs of interned names (`invalid_id` marks empty positions)
+    std::pmr::vector<unsigned int> id_table;
+    /// @brief Monotonic buffer whose contiguous blocks hold the characters of every interned name
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> char_blocks;
+    /// @brief Total number of characters (including null terminators) stored within `char_blocks`
+    size_t name_bytes;
+};
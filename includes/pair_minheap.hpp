@@ -5,6 +5,9 @@
 #include <string>
 #include <cassert>
 #include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <stdexcept>
 #include "../includes/gprintf.hpp"
@@ -15,26 +18,38 @@
  * Customized class that utilizes its underlying storage array `start_heap` as an array representation of
  * a proper binary minimum heap structure.
  * @tparam Type typename of values for each nodes value to hold
+ * @tparam Key typename of the key identifying each node, either `std::string` (vertex names) or an integer type (vertex IDs)
  * @param heap_size Number of `vertex_pair` objects currently stored in `paired_min_heap`
  * @param capacity Number of `vertex_pair` objects that `paired_min_heap` has currently preallocated memory for storage
- * @param vertex_pair Node-like struct objects containing a key : value pair, `value_pair`
+ * @param vertex_pair Node-like struct objects containing a key : value pair
  * @param start_heap Underlying data storage array for storing `vertex_pair` objects
+ * @note `vertex_pair` nodes (and their keys) are stored by value within `start_heap`, which allocates from the
+ * `std::pmr::memory_resource` provided on construction (the default resource if none is provided)
  */
-template<class Type>
+template<class Type, class Key = std::string>
 class paired_min_heap {
 public:
-    // Constructor for initialization with provided pre-allocation size
-    paired_min_heap(unsigned int i): heap_size(0), capacity(i) {fill_heap();}
+    /// @brief Whether node keys are strings (stored within the heap's memory resource) rather than integer IDs
+    static constexpr bool string_keys = std::is_same_v<Key, std::string>;
+    /// @brief Type of the key held by each node
+    using stored_key = std::conditional_t<string_keys, std::pmr::string, Key>;
+    /// @brief Type through which keys are passed to `add_node`
+    using key_param = std::conditional_t<string_keys, std::string_view, Key>;
+
+    // Constructor for initialization with provided pre-allocation size, allocating all storage from `resource`
+    paired_min_heap(unsigned int i, std::pmr::memory_resource* resource = std::pmr::get_default_resource()): heap_size(0),
+        capacity(i), start_heap{resource} {fill_heap();}
 
     // Default zero-initializtion constructor
     paired_min_heap(): heap_size(0), capacity(5) {fill_heap();}
 
     // Constructor for initialization with provided vector of key: value pairs
-    paired_min_heap(std::vector<std::pair<std::string, Type>>& heap_array): heap_size(0), capacity(0) {
+    paired_min_heap(std::vector<std::pair<Key, Type>>& heap_array,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource()): heap_size(0), capacity(0), start_heap{resource} {
         start_heap.reserve(heap_array.size());
         capacity = static_cast<unsigned int>(heap_array.size());
         for (size_t s = 0; s < heap_array.size(); s++) {
-                std::string key = std::get<0>(heap_array[s]);
+                Key key = std::get<0>(heap_array[s]);
                 Type value = std::get<1>(heap_array[s]);
                 add_node(key, value);
         }
@@ -42,27 +57,31 @@ public:
     }
 
     // Paired_min_heap Copy Constructor
-    paired_min_heap(const paired_min_heap<Type>& other_pheap) : heap_size{other_pheap.size},
+    paired_min_heap(const paired_min_heap<Type, Key>& other_pheap) : heap_size{other_pheap.heap_size},
         capacity{other_pheap.capacity},
         start_heap{ other_pheap.start_heap} {}
 
     // Paired_min_heap Copy Assignment Operator overloading constructor
-    paired_min_heap<Type>& operator=(paired_min_heap<Type>& old_pheap) {
+    paired_min_heap<Type, Key>& operator=(paired_min_heap<Type, Key>& old_pheap) {
         std::swap(heap_size, old_pheap.heap_size);
         std::swap(capacity, old_pheap.capacity);
-        std::swap(start_heap, old_pheap.start_heap);
+        // Swapped through move operations (rather than `std::vector::swap`) as both objects may use different memory resources
+        auto temp_heap = std::move(start_heap);
+        start_heap = std::move(old_pheap.start_heap);
+        old_pheap.start_heap = std::move(temp_heap);
         return *this;
     }
     // Move Constructor for paired_min_heap objects
-    paired_min_heap(paired_min_heap<Type>&& old_min_heap): heap_size{std::exchange(old_min_heap.heap_size, 0)},
+    paired_min_heap(paired_min_heap<Type, Key>&& old_min_heap) noexcept: heap_size{std::exchange(old_min_heap.heap_size, 0)},
         capacity{std::exchange(old_min_heap.capacity, 0)},
-        start_heap{std::exchange(old_min_heap.start_heap, nullptr)} {}
+        start_heap{std::move(old_min_heap.start_heap)} {}
 
     // Move operator overloading function for transferring ownership between paired_min_heap objects
-    paired_min_heap<Type>& operator=(paired_min_heap<Type>&& old_min_heap) {
+    paired_min_heap<Type, Key>& operator=(paired_min_heap<Type, Key>&& old_min_heap) {
         heap_size = std::exchange(old_min_heap.heap_size, 0);
         capacity = std::exchange(old_min_heap.capacity, 0);
-        start_heap = std::exchange(old_min_heap.start_heap, nullptr);
+        start_heap = std::move(old_min_heap.start_heap);
+        old_min_heap.start_heap.clear();
         return *this;
     }
 
@@ -72,12 +91,12 @@ public:
          * @return Tuple of (key, value) whose value is the smallest of all currently held in `paired_min_heap` instance.
          * Fails if calling `paired_min_heap` instance is empty.
          */
-    std::pair<std::string, Type> get_min() {
+    std::pair<Key, Type> get_min() {
         /// Notify user of error type and throw exception
         if (heap_size == 0) {
             throw(std::runtime_error("ERROR: Cannot return minimum value of an empty paired_minheap object!\n"));
         }
-        return start_heap[0] -> value_pair;
+        return start_heap[0].get_value_pair();
     }
 
 
@@ -112,29 +131,34 @@ public:
     }
 
 
+    /**
+         * Removes every key : value pair from the calling `paired_min_heap` instance while keeping the preallocated
+         * storage of `start_heap` for subsequent insertions
+         */
+    void clear() {
+        start_heap.clear();
+        heap_size = 0;
+    }
+
+
     /**
          * Inserts a new key : value pair as a tuple of (`key`, `data`) into the underlying storage array of the
          * `paired_min_heap` instance and rearranges the array contents until it is restored to reflect the
          * array representation of a proper minimum heap.
-         * @param key String value representing the identity of the node to be inserted
+         * @param key String value (or integer ID) representing the identity of the node to be inserted
          * @param value Data whose value will be used to determine the "minimum" value
          */
-    void add_node(std::string key, Type data) {
+    void add_node(key_param key, Type data) {
         // Fill new node with tuple of key : value pair and add to end of start_heap
         Type data_val = data;
-        std::string key_val = key;
-        // Initialize new vertex_pair struct using passed key and value args
-        auto pair_val = vertex_pair(key_val, data_val);
-        // Create new smart pointer to reference newly initialized vertex_pair struct
-        std::unique_ptr<vertex_pair> new_pair = std::make_unique<vertex_pair>(std::move(pair_val));
+        // Construct new vertex_pair struct in place at the end of the min heap's storage array `start_heap`
+        start_heap.emplace_back(key, data_val);
+        heap_size++;
 
-        gprintf("ADDED NODE: %s : ", std::get<0>(new_pair -> value_pair).c_str());
+        gprintf("ADDED NODE: %s : ", key_text(start_heap.back().key).c_str());
 #ifdef DEBUG
-        std::cerr << std::get<1>(new_pair -> value_pair) << '\n';
-#endif \
-    // Move pointer referencing new vertex_pair into min heap's storage array `start_heap`
-        start_heap.emplace_back(std::move(new_pair));
-        heap_size++;
+        std::cerr << start_heap.back().value << '\n';
+#endif
 
         // If newly added node is only stored node, no further processing is necessary
         if (heap_size - 1 == 0) {
@@ -144,11 +168,11 @@ public:
 
         gprintf("STARTING HEAP : [ ");
 #ifdef DEBUG
-        for (const auto& ptr_val : start_heap) {
-            if (ptr_val == start_heap.back()) {
-                std::cerr << std::get<0>(ptr_val -> value_pair) << " : " << std::get<1>(ptr_val -> value_pair);
+        for (const auto& node : start_heap) {
+            if (&node == &start_heap.back()) {
+                std::cerr << node.key << " : " << node.value;
             } else {
-                std::cerr << std::get<0>(ptr_val -> value_pair) << " : " << std::get<1>(ptr_val -> value_pair) << ", ";
+                std::cerr << node.key << " : " << node.value << ", ";
             }
         }
         std::cerr << " ]\n";
@@ -158,8 +182,7 @@ public:
              * and extract key : pair value from its stored tuple
              */
         int next_parent_index = (new_val_index - 1) / 2;
-        auto next_parent_pair = start_heap[static_cast<size_t>(next_parent_index)] -> value_pair;
-        auto prox_parent_pair = next_parent_pair;
+        Type next_parent_value = start_heap[static_cast<size_t>(next_parent_index)].value;
         /**
              * If the calculated index position of the parent node of the newly added node
              * is not the first index position of the `start_heap` array (0), the newly added node
@@ -169,18 +192,16 @@ public:
         gprintf("\nSTARTING POSITIONS FOR NEXT PARENT INDEX AND ADDED NODE INDEX\n");
 #ifdef DEBUG
         std::cerr << "next_parent_index: " << "START_HEAP[" << next_parent_index << "] = ";
-        print_value_pair(start_heap[static_cast<size_t>(next_parent_index)] -> value_pair, std::cerr);
+        print_value_pair(start_heap[static_cast<size_t>(next_parent_index)].get_value_pair(), std::cerr);
         std::cerr << "\nnew_val_index: " << "START_HEAP[" << new_val_index << "] = ";
-        print_value_pair(start_heap[static_cast<size_t>(new_val_index)] -> value_pair, std::cerr);
+        print_value_pair(start_heap[static_cast<size_t>(new_val_index)].get_value_pair(), std::cerr);
         std::cerr << '\n';
 #endif
         gprintf("ENTERING WHILE LOOP FOR POSITION SWAPPING\n");
-        while (next_parent_index >= 0 && data_val < std::get<1>(next_parent_pair)){
-            // Initiate swapping operation with parent using temporary pair
-            prox_parent_pair = next_parent_pair;
-
+        while (next_parent_index >= 0 && data_val < next_parent_value){
+            // Initiate swapping operation with parent
             std::swap(start_heap[static_cast<size_t>(next_parent_index)], start_heap[static_cast<size_t>(new_val_index)]);
-            data_val = std::get<1>(start_heap[static_cast<size_t>(next_parent_index)] -> value_pair);
+            data_val = start_heap[static_cast<size_t>(next_parent_index)].value;
 
             // Recalculate and update new parent node's index position
             new_val_index = next_parent_index;
@@ -188,17 +209,17 @@ public:
 
             // Update parent node's value with next index while it remains within bounds
             if (next_parent_index >= 0) {
-                next_parent_pair = start_heap[static_cast<size_t>(next_parent_index)] -> value_pair;
+                next_parent_value = start_heap[static_cast<size_t>(next_parent_index)].value;
             }
         }
 
 #ifdef DEBUG
         gprintf("HEAP AFTER ADDING NODE: [ ");
-        for (const auto& ptr_val : start_heap) {
-            if (ptr_val == start_heap.back()) {
-                std::cerr << std::get<0>(ptr_val -> value_pair) << " : " << std::get<1>(ptr_val -> value_pair);
+        for (const auto& node : start_heap) {
+            if (&node == &start_heap.back()) {
+                std::cerr << node.key << " : " << node.value;
             } else {
-                std::cerr << std::get<0>(ptr_val -> value_pair) << " : " << std::get<1>(ptr_val -> value_pair) << ", ";
+                std::cerr << node.key << " : " << node.value << ", ";
             }
         }
         std::cerr << " ]\n";
@@ -231,14 +252,14 @@ public:
 
 #ifdef DEBUG
         gprintf("\nBEGINNING PERCOLATION with: ");
-        print_value_pair(start_heap[static_cast<size_t>(perc_index)] -> value_pair, std::cerr);
+        print_value_pair(start_heap[static_cast<size_t>(perc_index)].get_value_pair(), std::cerr);
         std::cerr << '\n';
 #endif
 
         // For loop iterates until percolating node has either reached maximum depth or cannot swap downward further in heap
         for (int i = 0; i < max_loops_req; i++) {
-            // Extract and store key:value pair for current position of percolating node
-            auto perc_element_pair = start_heap[static_cast<size_t>(perc_index)] -> value_pair;
+            // Extract and store value for current position of percolating node
+            Type perc_element_value = start_heap[static_cast<size_t>(perc_index)].value;
 
             // Check if position of next expected left child exists and update index if it does
             if ( left_child_index >= 0 && left_child_index <= heap_length) {
@@ -251,8 +272,8 @@ public:
 #ifdef DEBUG
             std::cerr << "EVALUATING children from PERCOLATED NODE'S CURRENT POSITION OF: " << perc_index << '\n';
 #endif
-            // Pass index position and key:pair value of percolating node along with index positions of its children to helper function
-            int end_check = evaluate_children(left_child_index, right_child_index, perc_element_pair, perc_index);
+            // Pass index position and value of percolating node along with index positions of its children to helper function
+            int end_check = evaluate_children(left_child_index, right_child_index, perc_element_value, perc_index);
             /**
                  * If swapping function returns 0, percolation is complete and the loop is exited. Otherwise, percolation continues
                  * from updated index postion of percolating node until it reaches a position where it cannot proceed further downward
@@ -266,44 +287,45 @@ public:
 
 
     /**
-         * Swaps positions of percolating node at index position of `perc_index` containing the key:value pair within `perc_pair`
+         * Swaps positions of percolating node at index position of `perc_index` holding the value `perc_value`
          * with the child node containing the minimum value if this child node has a greater value than the percolating node.
          * @param left_child_index Calculated index position of left child of percolating node
          * @param right_child_index Calculated index position of right child of percolating node
-         * @param perc_pair Tuple containing the key:value pair of the percolating node
+         * @param perc_value Value held by the percolating node
          * @param perc_index Index position of percolating node within array representation of binary minimum heap `paired_min_heap`
          * @return 1 if percolating node has swapped positions (percolation is not complete), else 0 (percolation is complete)
          */
-    int evaluate_children(int left_child_index, int right_child_index, std::pair<std::string, Type>& perc_pair, int& perc_index) {
+    int evaluate_children(int left_child_index, int right_child_index, const Type& perc_value, int& perc_index) {
         int heap_length = heap_size - 1;
+        int start_index = perc_index;
         // Check if percolating node has any children
         if (left_child_index >= 0 && left_child_index <= heap_length) {
             // Percolating node has a left child
             if (right_child_index >= 0 && right_child_index <= heap_length) {
                 // Percolating node has both a left child node and right child node
-                std::pair<std::string, Type> left_child_pair = start_heap[static_cast<size_t>(left_child_index)] -> value_pair;
-                std::pair<std::string, Type> right_child_pair = start_heap[static_cast<size_t>(right_child_index)] -> value_pair;
+                const Type& left_child_value = start_heap[static_cast<size_t>(left_child_index)].value;
+                const Type& right_child_value = start_heap[static_cast<size_t>(right_child_index)].value;
                 // If left child node has the minimum value and value of percolating node is greater than it
-                if (std::get<1>(left_child_pair) < std::get<1>(right_child_pair) && std::get<1>(perc_pair) > std::get<1>(left_child_pair)) {
+                if (left_child_value < right_child_value && perc_value > left_child_value) {
                     // Percolating node swaps positions with left child
                     std::swap(start_heap[static_cast<size_t>(perc_index)], start_heap[static_cast<size_t>(left_child_index)]);
                     perc_index = left_child_index;
                     // If right child node has the minimum value and value of percolating node is greater than it
-                } else if (std::get<1>(right_child_pair) < std::get<1>(left_child_pair) && std::get<1>(perc_pair) > std::get<1>(right_child_pair)) {
+                } else if (right_child_value < left_child_value && perc_value > right_child_value) {
                     // Percolating node swaps positions with right child
                     std::swap(start_heap[static_cast<size_t>(perc_index)], start_heap[static_cast<size_t>(right_child_index)]);
                     perc_index = right_child_index;
                     // If both child nodes contain same value and value of percolating node is greater than this value
-                } else if (std::get<1>(right_child_pair) == std::get<1>(left_child_pair) && std::get<1>(perc_pair) > std::get<1>(left_child_pair)) {
+                } else if (right_child_value == left_child_value && perc_value > left_child_value) {
                     // Percolating node swaps postions with left child
                     std::swap(start_heap[static_cast<size_t>(perc_index)], start_heap[static_cast<size_t>(left_child_index)]);
                     perc_index = left_child_index;
                 }
                 // Percolating node has a left child but does not have a right child
             } else {
-                std::pair<std::string, Type> left_child_pair = start_heap[static_cast<size_t>(left_child_index)] -> value_pair;
+                const Type& left_child_value = start_heap[static_cast<size_t>(left_child_index)].value;
                 // If value of percolating node is greater than value of left child node
-                if (std::get<1>(perc_pair) > std::get<1>(left_child_pair)) {
+                if (perc_value > left_child_value) {
                     // Percolating node swaps postions with left child
                     std::swap(start_heap[static_cast<size_t>(perc_index)], start_heap[static_cast<size_t>(left_child_index)]);
                     perc_index = left_child_index;
@@ -311,19 +333,19 @@ public:
             }
             // If percolating node has a right child but does not have left child
         } else if (right_child_index >= 0 && right_child_index <= heap_length) {
-            std::pair<std::string, Type> right_child_pair = start_heap[static_cast<size_t>(right_child_index)] -> value_pair;
+            const Type& right_child_value = start_heap[static_cast<size_t>(right_child_index)].value;
             // If value of percolating node is greater than value of right child node
-            if (std::get<1>(perc_pair) > std::get<1>(right_child_pair)) {
+            if (perc_value > right_child_value) {
                 // Percolating node swaps positions with right child
                 std::swap(start_heap[static_cast<size_t>(perc_index)], start_heap[static_cast<size_t>(right_child_index)]);
                 perc_index = right_child_index;
             }
-            // If percolating node has no child nodes or was unable to swap positions, returns 0 to indicate percolation is complete
+            // If percolating node has no child nodes, returns 0 to indicate percolation is complete
         } else {
             return 0;
         }
-        // If percolating node has swapped positions this iteration, return 1 to indicate percolation is not complete
-        return 1;
+        // If percolating node has swapped positions this iteration, return 1 to indicate percolation is not complete (0 if it was unable to swap)
+        return perc_index != start_index ? 1 : 0;
     }
 
 
@@ -331,8 +353,8 @@ public:
          * Retrieves the tuple containing the minimum value and removes it from the calling `paired_min_heap` instance
          * @return Tuple of key : value pair containing the lowest value currently stored within the instance
          */
-    std::pair<std::string, Type> remove_min() {
-        std::pair<std::string, Type> root_pair;
+    std::pair<Key, Type> remove_min() {
+        std::pair<Key, Type> root_pair;
         // Notfies user of error type and throws exception
         if (heap_size == 0) {
             throw (std::runtime_error("ERROR: Cannot remove minimum value from an empty paired_minheap object!"));
@@ -347,7 +369,7 @@ public:
 
 #ifdef DEBUG
         gprintf("REMOVING NODE WITH MINIMUM VALUE: ");
-        print_value_pair(start_heap[0] -> value_pair, std::cerr);
+        print_value_pair(start_heap[0].get_value_pair(), std::cerr);
         std::cerr << '\n';
 #endif
 
@@ -374,7 +396,7 @@ public:
          * @param print_val Pair of string key : `Type` value to be written to specified I/O stream
          * @param stream_type I/O stream to which formatted values of `pair_val` will be written to
          */
-    void print_value_pair(const std::pair<std::string, Type>& print_val, std::ostream& stream_type) {
+    void print_value_pair(const std::pair<Key, Type>& print_val, std::ostream& stream_type) {
         stream_type << std::get<0>(print_val) << " : " << std::get<1>(print_val);
     }
 
@@ -402,11 +424,11 @@ public:
          */
     friend std::ostream& operator<<(std::ostream& out, const paired_min_heap& mh) {
         out << "[ ";
-        for (auto const& value : mh.start_heap) {
-            if (value == mh.start_heap.back()) {
-                out << std::get<0>(value -> value_pair) << " : " << std::get<1>(value -> value_pair);
+        for (auto const& node : mh.start_heap) {
+            if (&node == &mh.start_heap.back()) {
+                out << node.key << " : " << node.value;
             } else {
-                out << std::get<0>(value -> value_pair) << " : " << std::get<1>(value -> value_pair) << ", ";
+                out << node.key << " : " << node.value << ", ";
             }
         }
         out << " ]";
@@ -428,6 +450,20 @@ private:
         start_heap.reserve(static_cast<size_t>(capacity));
     }
 
+
+    /**
+         * Converts the key of a node into a printable string (used for debug printing)
+         * @param key Key held by a node
+         * @return String value of `key`
+         */
+    static std::string key_text(const stored_key& key) {
+        if constexpr (string_keys) {
+            return std::string(key);
+        } else {
+            return std::to_string(key);
+        }
+    }
+
     /// @brief Current number of nodes stored in `paired_min_heap` instance
     int heap_size;
 
@@ -435,40 +471,64 @@ private:
     unsigned int capacity;
     /**
          *  Node elements of `paired_min_heap`
-         * @param key String value for 'key' of node
+         * @param key String value (or integer ID) for 'key' of node
          * @param value Value with deduced type that is value associated with node
-         * @param value_pair Tuple of a string-type "key" and numerical "value" pair
          */
     struct vertex_pair {
-        std::string key;
+        /// @brief Allocator type through which `std::pmr::vector` passes its memory resource to each stored `vertex_pair`
+        using allocator_type = std::pmr::polymorphic_allocator<char>;
+        stored_key key;
         Type value;
-        std::pair<std::string, Type> value_pair = {key, value};
         // Vertex_pair Copy Constructor
-        vertex_pair(const vertex_pair& other_vpair) : key{other_vpair.key},
-            value{other_vpair.value}, value_pair{other_vpair.value_pair} {}
+        vertex_pair(const vertex_pair& other_vpair, const allocator_type& alloc = {}) : key{make_key(other_vpair.key, alloc)},
+            value{other_vpair.value} {}
 
         // Vertex_pair Copy Assignment Operator overloading constructor
-        vertex_pair& operator=(vertex_pair& old_vpair) {
-            std::swap(key, old_vpair.key);
-            std::swap(value, old_vpair.value);
-            std::swap(value_pair, old_vpair.value_pair);
+        vertex_pair& operator=(const vertex_pair& old_vpair) {
+            key = old_vpair.key;
+            value = old_vpair.value;
             return *this;
         }
 
-        vertex_pair(std::string k, Type v): key{k}, value{v}, value_pair{k,v} {}
+        vertex_pair(key_param k, Type v, const allocator_type& alloc = {}): key{make_key(k, alloc)}, value{v} {}
 
         // Vertex_pair Move Constructor
         vertex_pair(vertex_pair&& other_pair) noexcept: key{std::move(other_pair.key)},
-            value{std::move(other_pair.value)}, value_pair{std::move(other_pair.value_pair)} {}
+            value{std::move(other_pair.value)} {}
+        vertex_pair(vertex_pair&& other_pair, const allocator_type& alloc): key{make_key(std::move(other_pair.key), alloc)},
+            value{std::move(other_pair.value)} {}
 
         // Vertex_pair Move Assignment Operator overloading function
         vertex_pair& operator=(vertex_pair&& old_pair) noexcept {
             key = std::move(old_pair.key);
             value = std::move(old_pair.value);
-            value_pair = std::move(old_pair.value_pair);
             return *this;
         }
+
+        /**
+             * Builds a tuple of the "key" and "value" pair held by the node
+             * @return Tuple of (key, value) held by the node
+             */
+        std::pair<Key, Type> get_value_pair() const {
+            return {Key(key), value};
+        }
+
+        /**
+             * Builds the stored key of a node from `k`, placing string keys within the memory resource of `alloc`
+             * @param k Key value (or key of another node) to be stored
+             * @param alloc Allocator of the heap's storage array
+             * @return Key to be held by the node
+             */
+        template <class Source>
+        static stored_key make_key(Source&& k, const allocator_type& alloc) {
+            if constexpr (string_keys) {
+                return stored_key{std::forward<Source>(k), alloc};
+            } else {
+                (void)alloc;
+                return static_cast<stored_key>(k);
+            }
+        }
     };
     /// @brief  underlying storage array of `paired_min_heap` class instance
-    std::vector<std::unique_ptr<vertex_pair>> start_heap {};
-};
+    std::pmr::vector<vertex_pair> start_heap {};
+};
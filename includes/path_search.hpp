@@ -0,0 +1,1030 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory_resource>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "indexed_graph.hpp"
+#include "breadth_first.hpp"
+#include "delta_stepping.hpp"
+#include "integer_queues.hpp"
+#include "pair_minheap.hpp"
+#include "query_scratch.hpp"
+#include "gprintf.hpp"
+
+
+/// @brief Strategy used by `find_shortest_path` to answer a single source to destination query
+enum class search_mode {
+    /// @brief Single Dijkstra search from the source vertex, stopped once the destination vertex is extracted
+    forward,
+    /// @brief Alternating Dijkstra searches from both the source and destination verticies, stopped once they meet
+    bidirectional,
+    /// @brief A* search directed towards the destination vertex by landmark distance lower bounds (see `landmark_table`)
+    landmarks,
+    /// @brief Upward-only searches from both the source and destination verticies over a precomputed hierarchy (see `contraction_hierarchy`)
+    hierarchy,
+    /// @brief No search, the path is read from precomputed next hops between every pair of verticies (see `all_pairs_table`)
+    all_pairs,
+    /// @brief Direction-optimizing breadth-first search from the source vertex, for graphs whose edges share a single weight
+    breadth_first,
+    /// @brief Dijkstra search from the source vertex over the edges flagged for the region of the destination vertex (see `arc_flag_table`)
+    arc_flags
+};
+
+
+/**
+ * Summary of a completed point-to-point search
+ * @tparam Type typename of the edge weights of the searched graph
+ */
+template <class Type>
+struct path_search_result {
+    /// @brief Length of the shortest path from source to destination (infinity if the destination is unreachable)
+    Type distance;
+    /// @brief Number of verticies extracted from the minimum heap(s) with a final distance (across both directions)
+    unsigned int settled_count;
+};
+
+
+/**
+ * Finds the shortest paths from `source_id` to every vertex of `graph` with a Dijkstra search that runs until all reachable
+ * verticies have been settled
+ * @tparam Type typename of the edge weights of the searched graph
+ * @param graph Graph to be searched
+ * @param source_id ID of the source vertex
+ * @param distances Filled with the shortest distance from the source vertex to each vertex (infinity if unreachable), indexed by vertex ID
+ * @param vertex_path Filled with the ID of the vertex preceding each reached vertex on its shortest path (see `forward_search`)
+ * @param queue Kind of minimum priority queue ordering the verticies (see `choose_queue`)
+ * @return Number of settled verticies
+ * @note The minimum priority queue is allocated from the memory resource of `distances`
+ * @note Where several shortest paths reach a vertex, its predecessor is the candidate nearest to the source vertex, with ties
+ * broken by the lower vertex ID, so the tree does not depend on the order of equal distances within the heap (and matches
+ * the tree of `delta_stepping_tree`)
+ */
+template <class Type>
+unsigned int shortest_path_tree(const indexed_graph<Type>& graph, unsigned int source_id, std::pmr::vector<Type>& distances,
+    std::pmr::vector<unsigned int>& vertex_path, queue_kind queue = queue_kind::automatic) {
+    auto vertex_count = graph.get_vertex_count();
+    distances.assign(vertex_count, unreachable_distance<Type>());
+    vertex_path.assign(vertex_count, name_arena::invalid_id);
+
+    return with_priority_queue(graph, queue, distances.get_allocator().resource(), [&](auto& mhp) {
+        unsigned int settled_count = 0;
+        distances[source_id] = 0;
+        mhp.add_node(source_id, 0);
+        unsigned int popped_vertex = 0;
+        Type popped_vertex_distance = 0;
+        while (!mhp.is_empty()) {
+            std::tie(popped_vertex, popped_vertex_distance) = mhp.remove_min();
+            if (popped_vertex_distance > distances[popped_vertex]) {
+                continue;
+            }
+            settled_count++;
+            for (const auto& adjacent_edge : graph.get_adjacent(popped_vertex)) {
+                Type di = adjacent_edge.weight + popped_vertex_distance;
+                if (di < distances[adjacent_edge.target]) {
+                    distances[adjacent_edge.target] = di;
+                    vertex_path[adjacent_edge.target] = popped_vertex;
+                    mhp.add_node(adjacent_edge.target, di);
+                } else if (di == distances[adjacent_edge.target] && adjacent_edge.target != source_id) {
+                    // Verticies are settled in order of distance, so an equally short path can only come from an equally distant predecessor
+                    unsigned int& predecessor = vertex_path[adjacent_edge.target];
+                    if (distances[popped_vertex] == distances[predecessor] && popped_vertex < predecessor) {
+                        predecessor = popped_vertex;
+                    }
+                }
+            }
+        }
+        return settled_count;
+    });
+}
+
+
+/**
+ * Finds the shortest path between `source_id` and `destination_id` with a single Dijkstra search from the source vertex
+ * @tparam Type typename of the edge weights of the searched graph
+ * @param graph Graph to be searched
+ * @param source_id ID of the source vertex
+ * @param destination_id ID of the destination vertex
+ * @param distances Filled with the shortest known distance from the source vertex to each vertex, indexed by vertex ID
+ * @param vertex_path Filled with the ID of the vertex preceding each reached vertex on its shortest path (`name_arena::invalid_id`
+ * for the source vertex and verticies not reached), indexed by vertex ID
+ * @param queue Kind of minimum priority queue ordering the verticies (see `choose_queue`)
+ * @return Distance to the destination vertex and the number of settled verticies
+ * @note The minimum priority queue is allocated from the memory resource of `distances`
+ */
+template <class Type>
+path_search_result<Type> forward_search(const indexed_graph<Type>& graph, unsigned int source_id, unsigned int destination_id,
+    std::pmr::vector<Type>& distances, std::pmr::vector<unsigned int>& vertex_path, queue_kind queue = queue_kind::automatic) {
+    auto vertex_count = graph.get_vertex_count();
+    distances.assign(vertex_count, unreachable_distance<Type>());
+    vertex_path.assign(vertex_count, name_arena::invalid_id);
+
+    path_search_result<Type> result{unreachable_distance<Type>(), 0};
+    with_priority_queue(graph, queue, distances.get_allocator().resource(), [&](auto& mhp) {
+        distances[source_id] = 0;
+        mhp.add_node(source_id, 0);
+        unsigned int popped_vertex = 0;
+        Type popped_vertex_distance = 0;
+        while (!mhp.is_empty()) {
+            std::tie(popped_vertex, popped_vertex_distance) = mhp.remove_min();
+            // Skip outdated heap entries of verticies whose distance has since been lowered
+            if (popped_vertex_distance > distances[popped_vertex]) {
+                continue;
+            }
+            result.settled_count++;
+            // If extracted vertex is destination vertex, shortest path has been found to destination vertex
+            if (popped_vertex == destination_id) {
+                break;
+            }
+            for (const auto& adjacent_edge : graph.get_adjacent(popped_vertex)) {
+                Type di = adjacent_edge.weight + popped_vertex_distance;
+                if (di < distances[adjacent_edge.target]) {
+                    if (adjacent_edge.target == destination_id) {
+                        gprintf("UPDATING MINIMUM DISTANCE/PATH FROM SOURCE VERTEX TO DESTINATION VERTEX");
+                        gprintf("Current vertex is %s", graph.get_vertex_name(popped_vertex).data());
+                        gprintf("Previous minimum distance to destination vertex is %.2lf", static_cast<double>(distances[destination_id]));
+                        gprintf("Updated minimum distance from to destination vertex is %.2lf\n", static_cast<double>(di));
+                    }
+                    distances[adjacent_edge.target] = di;
+                    vertex_path[adjacent_edge.target] = popped_vertex;
+                    mhp.add_node(adjacent_edge.target, di);
+                }
+            }
+        }
+    });
+    result.distance = distances[destination_id];
+    return result;
+}
+
+
+/**
+ * Finds the shortest path between `source_id` and `destination_id` with a single Dijkstra search from the source vertex, kept
+ * within `scratch` so that only the verticies reached by the search are written
+ * @tparam Type typename of the edge weights of the searched graph
+ * @param graph Graph to be searched
+ * @param source_id ID of the source vertex
+ * @param destination_id ID of the destination vertex
+ * @param scratch Receives the distance to and predecessor of each reached vertex (see `forward_search`), replacing those of its previous search
+ * @return Distance to the destination vertex and the number of settled verticies
+ * @note Verticies are ordered by the queue of `scratch` of the kind chosen by `choose_queue`
+ */
+template <class Type>
+path_search_result<Type> forward_search(const indexed_graph<Type>& graph, unsigned int source_id, unsigned int destination_id,
+    query_scratch<Type>& scratch) {
+    scratch.begin(graph.get_vertex_count());
+    path_search_result<Type> result{unreachable_distance<Type>(), 0};
+    auto search = [&](auto& mhp) {
+        scratch.reach(source_id, 0, name_arena::invalid_id);
+        mhp.add_node(source_id, 0);
+        unsigned int popped_vertex = 0;
+        Type popped_vertex_distance = 0;
+        while (!mhp.is_empty()) {
+            std::tie(popped_vertex, popped_vertex_distance) = mhp.remove_min();
+            // Skip outdated heap entries of verticies already settled with a lower distance
+            if (scratch.is_settled(popped_vertex)) {
+                continue;
+            }
+            scratch.settle(popped_vertex);
+            result.settled_count++;
+            if (popped_vertex == destination_id) {
+                break;
+            }
+            for (const auto& adjacent_edge : graph.get_adjacent(popped_vertex)) {
+                Type di = adjacent_edge.weight + popped_vertex_distance;
+                if (di < scratch.get_distance(adjacent_edge.target)) {
+                    scratch.reach(adjacent_edge.target, di, popped_vertex);
+                    mhp.add_node(adjacent_edge.target, di);
+                }
+            }
+        }
+    };
+    switch (choose_queue(graph)) {
+        case queue_kind::dial_buckets:
+            search(scratch.get_dial_queue(static_cast<std::uint64_t>(graph.get_max_weight())));
+            break;
+        case queue_kind::radix_heap:
+            search(scratch.get_radix_heap());
+            break;
+        default:
+            search(scratch.get_heap());
+            break;
+    }
+    result.distance = scratch.get_distance(destination_id);
+    return result;
+}
+
+
+/**
+ * Finds the shortest path between `source_id` and `destination_id` by alternating a forward Dijkstra search from the source
+ * vertex with a backward Dijkstra search from the destination vertex, always advancing the search whose next extracted
+ * distance is smaller. The searches stop once the sum of both minimum heap keys reaches the length of the shortest path
+ * found through any vertex reached by both searches
+ * @tparam Type typename of the edge weights of the searched graph
+ * @param graph Graph to be searched, whose edges must be stored in both directions with equal weights (as done by
+ * `build_adjacency_list`), so the backward search can follow outgoing edges
+ * @param source_id ID of the source vertex
+ * @param destination_id ID of the destination vertex
+ * @param forward_scratch Receives the shortest known distance from the source vertex to each vertex reached by the forward
+ * search or lying on the shortest path, and the predecessor of each such vertex (see `forward_search`), so that following
+ * the predecessors back from `destination_id` yields the same form of path as a forward search
+ * @param backward_scratch Receives the distance from each vertex reached by the backward search to the destination vertex
+ * @return Distance to the destination vertex and the number of settled verticies (across both searches)
+ */
+template <class Type>
+path_search_result<Type> bidirectional_search(const indexed_graph<Type>& graph, unsigned int source_id, unsigned int destination_id,
+    query_scratch<Type>& forward_scratch, query_scratch<Type>& backward_scratch) {
+    auto vertex_count = graph.get_vertex_count();
+    forward_scratch.begin(vertex_count);
+    backward_scratch.begin(vertex_count);
+    auto& forward_heap = forward_scratch.get_heap();
+    auto& backward_heap = backward_scratch.get_heap();
+
+    path_search_result<Type> result{unreachable_distance<Type>(), 0};
+    unsigned int meeting_vertex = name_arena::invalid_id;
+    // The backward search records the ID of the vertex following each vertex towards the destination as its predecessor
+    forward_scratch.reach(source_id, 0, name_arena::invalid_id);
+    backward_scratch.reach(destination_id, 0, name_arena::invalid_id);
+    forward_heap.add_node(source_id, 0);
+    backward_heap.add_node(destination_id, 0);
+    if (source_id == destination_id) {
+        meeting_vertex = source_id;
+        result.distance = 0;
+    }
+
+    unsigned int popped_vertex = 0;
+    Type popped_vertex_distance = 0;
+    while (!forward_heap.is_empty() && !backward_heap.is_empty()) {
+        Type forward_min = forward_heap.get_min().second;
+        Type backward_min = backward_heap.get_min().second;
+        // No path through an unsettled vertex can be shorter than the best path found through a vertex reached by both searches
+        if (forward_min + backward_min >= result.distance) {
+            break;
+        }
+        bool is_forward = forward_min <= backward_min;
+        auto& own = is_forward ? forward_scratch : backward_scratch;
+        const auto& other = is_forward ? backward_scratch : forward_scratch;
+        auto& heap = own.get_heap();
+
+        std::tie(popped_vertex, popped_vertex_distance) = heap.remove_min();
+        if (own.is_settled(popped_vertex)) {
+            continue;
+        }
+        own.settle(popped_vertex);
+        result.settled_count++;
+        for (const auto& adjacent_edge : graph.get_adjacent(popped_vertex)) {
+            Type di = adjacent_edge.weight + popped_vertex_distance;
+            if (di < own.get_distance(adjacent_edge.target)) {
+                own.reach(adjacent_edge.target, di, popped_vertex);
+                heap.add_node(adjacent_edge.target, di);
+            }
+            // Record the shortest path found so far through any vertex reached by both searches
+            Type through_distance = di + other.get_distance(adjacent_edge.target);
+            if (through_distance < result.distance) {
+                result.distance = through_distance;
+                meeting_vertex = adjacent_edge.target;
+            }
+        }
+    }
+    gprintf("Bidirectional search settled %u verticies", result.settled_count);
+
+    if (meeting_vertex == name_arena::invalid_id) {
+        return result;
+    }
+    // Re-link the backward half of the path so every vertex from the meeting vertex to the destination points to its predecessor
+    unsigned int current_vertex = meeting_vertex;
+    forward_scratch.reach(current_vertex, result.distance - backward_scratch.get_distance(current_vertex),
+        forward_scratch.get_predecessor(current_vertex));
+    while (current_vertex != destination_id) {
+        unsigned int following_vertex = backward_scratch.get_predecessor(current_vertex);
+        forward_scratch.reach(following_vertex, result.distance - backward_scratch.get_distance(following_vertex), current_vertex);
+        current_vertex = following_vertex;
+    }
+    return result;
+}
+
+
+/**
+ * Finds the shortest path between `source_id` and `destination_id` with `bidirectional_search` over scratch arrays of its own,
+ * copying the forward search into `distances` and `vertex_path`
+ * @tparam Type typename of the edge weights of the searched graph
+ * @param graph Graph to be searched, whose edges must be stored in both directions with equal weights (as done by
+ * `build_adjacency_list`), so the backward search can follow outgoing edges
+ * @param source_id ID of the source vertex
+ * @param destination_id ID of the destination vertex
+ * @param distances Filled with the shortest known distance from the source vertex to each vertex reached by the forward
+ * search or lying on the shortest path, indexed by vertex ID
+ * @param vertex_path Filled with the ID of the vertex preceding each vertex (see `forward_search`), so that following
+ * `vertex_path` back from `destination_id` yields the same form of path as a forward search
+ * @return Distance to the destination vertex and the number of settled verticies (across both searches)
+ * @note Both minimum heaps and the scratch arrays of both searches are allocated from the memory resource of `distances`
+ */
+template <class Type>
+path_search_result<Type> bidirectional_search(const indexed_graph<Type>& graph, unsigned int source_id, unsigned int destination_id,
+    std::pmr::vector<Type>& distances, std::pmr::vector<unsigned int>& vertex_path) {
+    std::pmr::memory_resource* scratch = distances.get_allocator().resource();
+    auto forward_scratch = query_scratch<Type>(scratch);
+    auto backward_scratch = query_scratch<Type>(scratch);
+    auto result = bidirectional_search(graph, source_id, destination_id, forward_scratch, backward_scratch);
+    forward_scratch.copy_to(distances, vertex_path);
+    return result;
+}
+
+
+/**
+ * Finds the shortest path between `source_id` and `destination_id` of a graph whose edges all have the same weight with
+ * `breadth_first_tree`, stopped once the level of the destination vertex has been reached
+ * @tparam Type typename of the edge weights of the searched graph
+ * @param graph Graph to be searched, for which `suits_breadth_first` holds
+ * @param source_id ID of the source vertex
+ * @param destination_id ID of the destination vertex
+ * @param distances Filled with the shortest distance from the source vertex to each reached vertex, indexed by vertex ID
+ * @param vertex_path Filled with the ID of the vertex preceding each reached vertex on its shortest path (see `forward_search`)
+ * @return Distance to the destination vertex and the number of reached verticies
+ */
+template <class Type>
+path_search_result<Type> breadth_first_search(const indexed_graph<Type>& graph, unsigned int source_id, unsigned int destination_id,
+    std::pmr::vector<Type>& distances, std::pmr::vector<unsigned int>& vertex_path) {
+    path_search_result<Type> result{unreachable_distance<Type>(), 0};
+    result.settled_count = breadth_first_tree(graph, source_id, distances, vertex_path, destination_id);
+    result.distance = distances[destination_id];
+    return result;
+}
+
+
+/**
+ * Complete shortest path tree from a single source vertex, holding the distance to and predecessor of every vertex so that
+ * the shortest paths to any number of destination verticies are extracted without searching the graph again
+ * @tparam Type typename of the edge weights of the searched graph
+ */
+template <class Type>
+class path_tree final {
+public:
+    // Constructor creates an empty tree, allocating all storage from `resource`
+    path_tree(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): distances{resource}, predecessors{resource},
+        source_id(name_arena::invalid_id), settled_count(0) {}
+
+
+    /**
+         * Replaces the calling `path_tree` with the shortest path tree of `graph` rooted at `source`
+         * @param graph Graph to be searched
+         * @param source ID of the source vertex
+         * @note Graphs for which `suits_breadth_first` holds are searched by `breadth_first_tree`, which yields the same tree
+         */
+    void build(const indexed_graph<Type>& graph, unsigned int source) {
+        source_id = source;
+        if (suits_breadth_first(graph)) {
+            settled_count = breadth_first_tree(graph, source, distances, predecessors);
+        } else {
+            settled_count = shortest_path_tree(graph, source, distances, predecessors);
+        }
+    }
+
+
+    /**
+         * Replaces the calling `path_tree` with the shortest path tree of `graph` rooted at `source`, found by relaxing the
+         * edges of each bucket of `delta_stepping_tree` in parallel (yielding the same tree as `build`)
+         * @param graph Graph to be searched, whose edge weights must all be positive
+         * @param source ID of the source vertex
+         * @param thread_count Maximum number of threads (0 uses one thread per hardware thread)
+         * @note The bucket width is chosen by `suggest_delta` from the edge weights recorded while `graph` was built
+         * @note Graphs for which `suits_breadth_first` holds are searched by `breadth_first_tree` on the calling thread instead
+         */
+    void build_parallel(const indexed_graph<Type>& graph, unsigned int source, unsigned int thread_count = 0) {
+        source_id = source;
+        if (suits_breadth_first(graph)) {
+            settled_count = breadth_first_tree(graph, source, distances, predecessors);
+        } else {
+            settled_count = delta_stepping_tree(graph, source, distances, predecessors, Type{}, thread_count);
+        }
+    }
+
+
+    /**
+         * Repairs the calling `path_tree` after the weight of the edge between `first` and `second` changed in both directions
+         * (or the edge was added), searching only the verticies whose distances change in the manner of Ramalingam and Reps:
+         * a shorter edge is propagated outwards from its farther end, while a longer tree edge first marks the verticies of its
+         * subtree left without an equally short path from outside of the marked verticies, then settles only those verticies
+         * again from their unmarked neighbors. Predecessors are then chosen again by the rule of `shortest_path_tree` for the
+         * ends of the edge and every vertex whose own distance or a neighbor's distance changed, so the repaired tree is
+         * identical to a tree built again by `build`
+         * @param graph Graph the tree was built from, already holding the new weight in both directions, whose edge weights must
+         * all be positive
+         * @param first ID of one vertex of the changed edge
+         * @param second ID of the other vertex of the changed edge
+         * @return Number of verticies whose distance changed
+         * @note Repairs follow outgoing edges as incoming edges, so trees of graphs for which `indexed_graph::is_symmetric` does not
+         * hold are built again instead (and every vertex is counted as changed)
+         * @note Verticies added to the graph since the tree was built are unreachable until reached through a repaired edge
+         */
+    unsigned int repair(const indexed_graph<Type>& graph, unsigned int first, unsigned int second) {
+        auto vertex_count = graph.get_vertex_count();
+        if (!graph.is_symmetric()) {
+            build(graph, source_id);
+            return vertex_count;
+        }
+        distances.resize(vertex_count, unreachable_distance<Type>());
+        predecessors.resize(vertex_count, name_arena::invalid_id);
+        if (first == second) {
+            return 0;
+        }
+        auto* resource = distances.get_allocator().resource();
+        std::pmr::vector<unsigned int> changed(resource);
+        auto heap = paired_min_heap<Type, unsigned int>(64, resource);
+        // Settles the queued verticies in order of distance, recording each as changed
+        auto settle_queued = [&]() {
+            unsigned int popped_vertex = 0;
+            Type popped_vertex_distance = 0;
+            while (!heap.is_empty()) {
+                std::tie(popped_vertex, popped_vertex_distance) = heap.remove_min();
+                if (popped_vertex_distance > distances[popped_vertex]) {
+                    continue;
+                }
+                changed.push_back(popped_vertex);
+                for (const auto& adjacent_edge : graph.get_adjacent(popped_vertex)) {
+                    Type di = adjacent_edge.weight + popped_vertex_distance;
+                    if (di < distances[adjacent_edge.target]) {
+                        distances[adjacent_edge.target] = di;
+                        heap.add_node(adjacent_edge.target, di);
+                    }
+                }
+            }
+        };
+
+        unsigned int near_end = distances[first] <= distances[second] ? first : second;
+        unsigned int far_end = near_end == first ? second : first;
+        Type through_edge = graph.get_edge_weight(near_end, far_end) + distances[near_end];
+        if (through_edge < distances[far_end]) {
+            unsigned int reached_count = 0;
+            distances[far_end] = through_edge;
+            heap.add_node(far_end, through_edge);
+            settle_queued();
+            for (unsigned int vertex : changed) {
+                if (predecessors[vertex] == name_arena::invalid_id && vertex != source_id) {
+                    reached_count++;
+                }
+            }
+            settled_count += reached_count;
+        } else if (predecessors[far_end] == near_end && distances[far_end] < through_edge) {
+            // Collect the subtree below the lengthened edge, whose verticies are the only ones that may become more distant
+            std::pmr::vector<unsigned int> subtree(1, far_end, resource);
+            for (size_t i = 0; i < subtree.size(); i++) {
+                for (const auto& adjacent_edge : graph.get_adjacent(subtree[i])) {
+                    if (predecessors[adjacent_edge.target] == subtree[i]) {
+                        subtree.push_back(adjacent_edge.target);
+                    }
+                }
+            }
+            std::sort(subtree.begin(), subtree.end(), [&](unsigned int a, unsigned int b) {
+                return distances[a] < distances[b] || (distances[a] == distances[b] && a < b);
+            });
+            // Any equally short path reaches a vertex through a nearer vertex, which has already been marked or left unmarked
+            std::pmr::unordered_set<unsigned int> affected(resource);
+            for (unsigned int vertex : subtree) {
+                bool kept = false;
+                for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                    if (adjacent_edge.weight + distances[adjacent_edge.target] == distances[vertex] &&
+                        affected.find(adjacent_edge.target) == affected.end()) {
+                        kept = true;
+                        break;
+                    }
+                }
+                if (!kept) {
+                    affected.insert(vertex);
+                }
+            }
+            for (unsigned int vertex : affected) {
+                distances[vertex] = unreachable_distance<Type>();
+            }
+            for (unsigned int vertex : affected) {
+                for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                    Type di = adjacent_edge.weight + distances[adjacent_edge.target];
+                    if (di < distances[vertex]) {
+                        distances[vertex] = di;
+                    }
+                }
+                if (distances[vertex] != unreachable_distance<Type>()) {
+                    heap.add_node(vertex, distances[vertex]);
+                }
+            }
+            settle_queued();
+            // Affected verticies left unsettled can no longer be reached at all
+            changed.assign(affected.begin(), affected.end());
+            for (unsigned int vertex : changed) {
+                if (distances[vertex] == unreachable_distance<Type>()) {
+                    settled_count--;
+                }
+            }
+        }
+
+        // A predecessor only depends on the distances of a vertex and its neighbors and the weights of its edges
+        std::pmr::vector<unsigned int> stale(changed.begin(), changed.end(), resource);
+        for (unsigned int vertex : changed) {
+            for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                stale.push_back(adjacent_edge.target);
+            }
+        }
+        stale.push_back(first);
+        stale.push_back(second);
+        std::sort(stale.begin(), stale.end());
+        stale.erase(std::unique(stale.begin(), stale.end()), stale.end());
+        for (unsigned int vertex : stale) {
+            unsigned int& predecessor = predecessors[vertex];
+            predecessor = name_arena::invalid_id;
+            if (vertex == source_id || distances[vertex] == unreachable_distance<Type>()) {
+                continue;
+            }
+            for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                unsigned int candidate = adjacent_edge.target;
+                if (adjacent_edge.weight + distances[candidate] == distances[vertex] && (predecessor == name_arena::invalid_id ||
+                    distances[candidate] < distances[predecessor] ||
+                    (distances[candidate] == distances[predecessor] && candidate < predecessor))) {
+                    predecessor = candidate;
+                }
+            }
+        }
+        return static_cast<unsigned int>(changed.size());
+    }
+
+
+    /**
+         * Determines whether a path exists from the source vertex to `destination_id`
+         * @param destination_id ID of the destination vertex
+         * @return `true` if the destination vertex was reached by the search, else `false`
+         */
+    bool reaches(unsigned int destination_id) const {
+        return distances[destination_id] != unreachable_distance<Type>();
+    }
+
+
+    /**
+         * Retrieves the length of the shortest path from the source vertex to `destination_id`
+         * @param destination_id ID of the destination vertex
+         * @return Shortest distance (infinity if the destination vertex is unreachable)
+         */
+    Type get_distance(unsigned int destination_id) const {
+        return distances[destination_id];
+    }
+
+
+    /**
+         * Writes the IDs of the verticies along the shortest path from the source vertex to `destination_id` into `path`, in
+         * time proportional to the length of the path
+         * @param destination_id ID of the destination vertex
+         * @param path Filled with the vertex IDs from the source vertex to the destination vertex (emptied if unreachable)
+         * @return `true` if a path exists, else `false`
+         */
+    bool extract_path(unsigned int destination_id, std::pmr::vector<unsigned int>& path) const {
+        path.clear();
+        if (!reaches(destination_id)) {
+            return false;
+        }
+        for (unsigned int vertex = destination_id; vertex != name_arena::invalid_id; vertex = predecessors[vertex]) {
+            path.push_back(vertex);
+        }
+        std::reverse(path.begin(), path.end());
+        return true;
+    }
+
+
+    /**
+         * Retrieves the ID of the vertex the tree is rooted at
+         * @return ID of the source vertex (`name_arena::invalid_id` before `build` is called)
+         */
+    unsigned int get_source() const {
+        return source_id;
+    }
+
+
+    /**
+         * Retrieves the number of verticies settled while building the tree
+         * @return Number of verticies reachable from the source vertex
+         */
+    unsigned int get_settled_count() const {
+        return settled_count;
+    }
+
+
+    /**
+         * Retrieves the distance from the source vertex to every vertex
+         * @return Array of distances indexed by vertex ID (infinity if unreachable)
+         */
+    const std::pmr::vector<Type>& get_distances() const {
+        return distances;
+    }
+
+
+    /**
+         * Retrieves the predecessor of every vertex on its shortest path from the source vertex
+         * @return Array of vertex IDs indexed by vertex ID (`name_arena::invalid_id` for the source vertex and unreachable verticies)
+         */
+    const std::pmr::vector<unsigned int>& get_predecessors() const {
+        return predecessors;
+    }
+
+private:
+    /// @brief Shortest distance from the source vertex to each vertex, indexed by vertex ID
+    std::pmr::vector<Type> distances;
+    /// @brief ID of the vertex preceding each vertex on its shortest path, indexed by vertex ID
+    std::pmr::vector<unsigned int> predecessors;
+    /// @brief ID of the source vertex
+    unsigned int source_id;
+    /// @brief Number of verticies settled while building the tree
+    unsigned int settled_count;
+};
+
+
+/**
+ * Finds the shortest path from the nearest of several source verticies to every vertex of `graph` with a single Dijkstra search
+ * whose minimum priority queue is seeded with every source vertex at distance 0, in place of one search per source vertex
+ * @tparam Type typename of the edge weights of the searched graph (which must all be positive)
+ * @param graph Graph to be searched
+ * @param sources IDs of the source verticies (repeated IDs are searched once)
+ * @param distances Filled with the shortest distance from the nearest source vertex to each vertex (infinity if unreachable),
+ * indexed by vertex ID
+ * @param vertex_path Filled with the ID of the vertex preceding each reached vertex on its shortest path (`name_arena::invalid_id`
+ * for the source verticies and unreachable verticies), indexed by vertex ID
+ * @param nearest_sources Filled with the ID of the source vertex each reached vertex's shortest path starts from
+ * (`name_arena::invalid_id` if unreachable), indexed by vertex ID
+ * @param queue Kind of minimum priority queue ordering the verticies (see `choose_queue`)
+ * @return Number of settled verticies
+ * @note Predecessors are chosen by the rule of `shortest_path_tree`, and each vertex takes the nearest source vertex of its
+ * predecessor, so a vertex equally distant from several source verticies is assigned the same one regardless of heap order
+ * @note The minimum priority queue is allocated from the memory resource of `distances`
+ */
+template <class Type>
+unsigned int multi_source_tree(const indexed_graph<Type>& graph, const std::pmr::vector<unsigned int>& sources,
+    std::pmr::vector<Type>& distances, std::pmr::vector<unsigned int>& vertex_path, std::pmr::vector<unsigned int>& nearest_sources,
+    queue_kind queue = queue_kind::automatic) {
+    auto vertex_count = graph.get_vertex_count();
+    distances.assign(vertex_count, unreachable_distance<Type>());
+    vertex_path.assign(vertex_count, name_arena::invalid_id);
+    nearest_sources.assign(vertex_count, name_arena::invalid_id);
+
+    return with_priority_queue(graph, queue, distances.get_allocator().resource(), [&](auto& mhp) {
+        unsigned int settled_count = 0;
+        for (unsigned int source_id : sources) {
+            if (distances[source_id] != 0) {
+                distances[source_id] = 0;
+                mhp.add_node(source_id, 0);
+            }
+        }
+        unsigned int popped_vertex = 0;
+        Type popped_vertex_distance = 0;
+        while (!mhp.is_empty()) {
+            std::tie(popped_vertex, popped_vertex_distance) = mhp.remove_min();
+            if (popped_vertex_distance > distances[popped_vertex]) {
+                continue;
+            }
+            settled_count++;
+            // The predecessor of a vertex is final once the vertex is extracted, and was itself extracted earlier
+            unsigned int predecessor = vertex_path[popped_vertex];
+            nearest_sources[popped_vertex] = predecessor == name_arena::invalid_id ? popped_vertex : nearest_sources[predecessor];
+            for (const auto& adjacent_edge : graph.get_adjacent(popped_vertex)) {
+                Type di = adjacent_edge.weight + popped_vertex_distance;
+                if (di < distances[adjacent_edge.target]) {
+                    distances[adjacent_edge.target] = di;
+                    vertex_path[adjacent_edge.target] = popped_vertex;
+                    mhp.add_node(adjacent_edge.target, di);
+                } else if (di == distances[adjacent_edge.target] && vertex_path[adjacent_edge.target] != name_arena::invalid_id) {
+                    unsigned int& target_predecessor = vertex_path[adjacent_edge.target];
+                    if (distances[popped_vertex] == distances[target_predecessor] && popped_vertex < target_predecessor) {
+                        target_predecessor = popped_vertex;
+                    }
+                }
+            }
+        }
+        return settled_count;
+    });
+}
+
+
+/**
+ * Shortest path forest rooted at several source verticies (such as depots or facilities), holding for every vertex the nearest
+ * source vertex, the distance to it and the predecessor on the path from it, all found by a single search of the graph
+ * @tparam Type typename of the edge weights of the searched graph
+ */
+template <class Type>
+class nearest_source_forest final {
+public:
+    // Constructor creates an empty forest, allocating all storage from `resource`
+    nearest_source_forest(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): distances{resource},
+        predecessors{resource}, nearest_sources{resource}, settled_count(0) {}
+
+
+    /**
+         * Replaces the calling `nearest_source_forest` with the shortest path forest of `graph` rooted at `sources`
+         * @param graph Graph to be searched
+         * @param sources IDs of the source verticies
+         */
+    void build(const indexed_graph<Type>& graph, const std::pmr::vector<unsigned int>& sources) {
+        settled_count = multi_source_tree(graph, sources, distances, predecessors, nearest_sources);
+    }
+
+
+    /**
+         * Determines whether a path exists from any source vertex to `vertex_id`
+         * @param vertex_id ID of the vertex
+         * @return `true` if the vertex was reached by the search, else `false`
+         */
+    bool reaches(unsigned int vertex_id) const {
+        return distances[vertex_id] != unreachable_distance<Type>();
+    }
+
+
+    /**
+         * Retrieves the length of the shortest path from the nearest source vertex to `vertex_id`
+         * @param vertex_id ID of the vertex
+         * @return Shortest distance (infinity if no source vertex reaches the vertex)
+         */
+    Type get_distance(unsigned int vertex_id) const {
+        return distances[vertex_id];
+    }
+
+
+    /**
+         * Retrieves the source vertex nearest to `vertex_id`
+         * @param vertex_id ID of the vertex
+         * @return ID of the nearest source vertex (`name_arena::invalid_id` if no source vertex reaches the vertex)
+         */
+    unsigned int get_nearest_source(unsigned int vertex_id) const {
+        return nearest_sources[vertex_id];
+    }
+
+
+    /**
+         * Writes the IDs of the verticies along the shortest path from the nearest source vertex to `vertex_id` into `path`, in
+         * time proportional to the length of the path
+         * @param vertex_id ID of the vertex
+         * @param path Filled with the vertex IDs from the nearest source vertex to `vertex_id` (emptied if unreachable)
+         * @return `true` if a path exists, else `false`
+         */
+    bool extract_path(unsigned int vertex_id, std::pmr::vector<unsigned int>& path) const {
+        path.clear();
+        if (!reaches(vertex_id)) {
+            return false;
+        }
+        for (unsigned int vertex = vertex_id; vertex != name_arena::invalid_id; vertex = predecessors[vertex]) {
+            path.push_back(vertex);
+        }
+        std::reverse(path.begin(), path.end());
+        return true;
+    }
+
+
+    /**
+         * Retrieves the number of verticies settled while building the forest
+         * @return Number of verticies reachable from any source vertex
+         */
+    unsigned int get_settled_count() const {
+        return settled_count;
+    }
+
+private:
+    /// @brief Shortest distance from the nearest source vertex to each vertex, indexed by vertex ID
+    std::pmr::vector<Type> distances;
+    /// @brief ID of the vertex preceding each vertex on its shortest path, indexed by vertex ID
+    std::pmr::vector<unsigned int> predecessors;
+    /// @brief ID of the source vertex nearest to each vertex, indexed by vertex ID
+    std::pmr::vector<unsigned int> nearest_sources;
+    /// @brief Number of verticies settled while building the forest
+    unsigned int settled_count;
+};
+
+
+/**
+ * Bounded cache of complete shortest path trees keyed by source vertex ID, evicting the least recently used tree once the
+ * trees held exceed a memory budget, so that repeated queries from the same source verticies are answered by extracting the
+ * path from a cached tree instead of searching the graph
+ * @tparam Type typename of the edge weights of the searched graph
+ *
+ * Every cached tree belongs to the revision of the graph it was built from (see `indexed_graph::get_revision`), and all
+ * cached trees are discarded as soon as a lookup is made against a different or modified graph. Edge weights changed through
+ * `update_edge` are instead repaired within every cached tree (see `path_tree::repair`), which keeps the trees valid
+ *
+ * @note The most recently requested tree is always kept, even if it alone exceeds the memory budget
+ */
+template <class Type>
+class path_tree_cache final {
+public:
+    // Constructor creates an empty cache holding at most `budget` bytes of trees, allocating all trees from `resource`
+    path_tree_cache(size_t budget, std::pmr::memory_resource* resource = std::pmr::get_default_resource()): byte_budget(budget),
+        byte_count(0), graph_revision(0), hit_count(0), miss_count(0), eviction_count(0), invalidation_count(0), repair_count(0),
+        tree_resource(resource) {}
+
+
+    /**
+         * Retrieves the shortest path tree of `graph` rooted at `source`, building it if it is not cached and evicting the
+         * least recently used trees until the cache fits within its budget again
+         * @param graph Graph to be searched
+         * @param source ID of the source vertex
+         * @return Reference to the cached tree, which remains valid until it is evicted or the cache is invalidated
+         */
+    const path_tree<Type>& get_tree(const indexed_graph<Type>& graph, unsigned int source) {
+        if (graph.get_revision() != graph_revision) {
+            if (!trees.empty()) {
+                invalidation_count++;
+            }
+            clear();
+            graph_revision = graph.get_revision();
+        }
+        auto position = tree_positions.find(source);
+        if (position != tree_positions.end()) {
+            hit_count++;
+            trees.splice(trees.begin(), trees, position -> second);
+            return trees.front();
+        }
+        miss_count++;
+        trees.emplace_front(tree_resource);
+        trees.front().build(graph, source);
+        tree_positions.emplace(source, trees.begin());
+        byte_count += tree_bytes(trees.front());
+        while (byte_count > byte_budget && trees.size() > 1) {
+            byte_count -= tree_bytes(trees.back());
+            tree_positions.erase(trees.back().get_source());
+            trees.pop_back();
+            eviction_count++;
+        }
+        return trees.front();
+    }
+
+
+    /**
+         * Sets the weight of the undirected edge between `first` and `second` within `graph` (adding the edge if it does not
+         * exist yet), then repairs every cached tree instead of discarding it
+         * @param graph Graph the cached trees were built from
+         * @param first ID of one vertex of the edge
+         * @param second ID of the other vertex of the edge
+         * @param weight New weight of the edge in both directions
+         * @return `true` if a new edge was added, else `false` (the weight of the existing edge was replaced)
+         * @throws `std::runtime_error` if `weight` is not positive
+         * @note Trees cached for a different or otherwise modified graph are discarded first, as by `get_tree`
+         */
+    bool update_edge(indexed_graph<Type>& graph, unsigned int first, unsigned int second, Type weight) {
+        if (!(weight > Type{})) {
+            throw std::runtime_error("ERROR: Updated edge weights must be positive!");
+        }
+        if (graph.get_revision() != graph_revision) {
+            if (!trees.empty()) {
+                invalidation_count++;
+            }
+            clear();
+        }
+        bool added = graph.set_edge_weight(first, second, weight);
+        graph.set_edge_weight(second, first, weight);
+        byte_count = 0;
+        for (auto& tree : trees) {
+            tree.repair(graph, first, second);
+            byte_count += tree_bytes(tree);
+            repair_count++;
+        }
+        graph_revision = graph.get_revision();
+        return added;
+    }
+
+
+    /**
+         * Sets the weight of the undirected edge between the verticies named `first` and `second` within `graph`, adding either
+         * vertex or the edge if it does not exist yet, then repairs every cached tree (see `update_edge`)
+         * @param graph Graph the cached trees were built from
+         * @param first Name of one vertex of the edge
+         * @param second Name of the other vertex of the edge
+         * @param weight New weight of the edge in both directions
+         * @return `true` if a new edge was added, else `false`
+         * @throws `std::runtime_error` if `weight` is not positive
+         */
+    bool update_edge(indexed_graph<Type>& graph, std::string_view first, std::string_view second, Type weight) {
+        bool current = graph.get_revision() == graph_revision;
+        unsigned int first_id = graph.add_vertex(first);
+        unsigned int second_id = graph.add_vertex(second);
+        // New verticies alone do not change any cached tree, which is extended by the repair
+        if (current) {
+            graph_revision = graph.get_revision();
+        }
+        return update_edge(graph, first_id, second_id, weight);
+    }
+
+
+    /**
+         * Determines whether the tree rooted at `source` is currently cached (without affecting its recency)
+         * @param source ID of the source vertex
+         * @return `true` if the tree is cached, else `false`
+         */
+    bool contains(unsigned int source) const {
+        return tree_positions.find(source) != tree_positions.end();
+    }
+
+
+    /**
+         * Discards every cached tree without affecting the hit, miss or eviction counts
+         */
+    void clear() {
+        trees.clear();
+        tree_positions.clear();
+        byte_count = 0;
+    }
+
+
+    /**
+         * Retrieves the number of trees currently cached
+         * @return Number of cached trees
+         */
+    size_t get_tree_count() const {
+        return trees.size();
+    }
+
+
+    /**
+         * Retrieves the memory held by the cached trees
+         * @return Number of bytes of distances and predecessors held by all cached trees
+         */
+    size_t get_byte_count() const {
+        return byte_count;
+    }
+
+
+    /**
+         * Retrieves the number of lookups answered by a cached tree
+         * @return Number of cache hits
+         */
+    unsigned long get_hit_count() const {
+        return hit_count;
+    }
+
+
+    /**
+         * Retrieves the number of lookups that built a new tree
+         * @return Number of cache misses
+         */
+    unsigned long get_miss_count() const {
+        return miss_count;
+    }
+
+
+    /**
+         * Retrieves the number of trees discarded to stay within the memory budget
+         * @return Number of evictions
+         */
+    unsigned long get_eviction_count() const {
+        return eviction_count;
+    }
+
+
+    /**
+         * Retrieves the number of times the cached trees were discarded due to a rebuilt or modified graph
+         * @return Number of invalidations
+         */
+    unsigned long get_invalidation_count() const {
+        return invalidation_count;
+    }
+
+
+    /**
+         * Retrieves the number of cached trees repaired by `update_edge`
+         * @return Number of tree repairs
+         */
+    unsigned long get_repair_count() const {
+        return repair_count;
+    }
+
+private:
+    /**
+         * Computes the memory held by the arrays of `tree`
+         * @param tree Tree whose size is computed
+         * @return Number of bytes of distances and predecessors held by `tree`
+         */
+    static size_t tree_bytes(const path_tree<Type>& tree) {
+        return tree.get_distances().capacity() * sizeof(Type) + tree.get_predecessors().capacity() * sizeof(unsigned int);
+    }
+
+    /// @brief Cached trees ordered from most to least recently used
+    std::list<path_tree<Type>> trees;
+    /// @brief Position of each cached tree within `trees`, keyed by the ID of its source vertex
+    std::unordered_map<unsigned int, typename std::list<path_tree<Type>>::iterator> tree_positions;
+    /// @brief Maximum number of bytes of trees held before the least recently used trees are evicted
+    size_t byte_budget;
+    /// @brief Number of bytes held by all cached trees
+    size_t byte_count;
+    /// @brief Revision of the graph all cached trees were built from
+    std::uint64_t graph_revision;
+    /// @brief Number of lookups answered by a cached tree
+    unsigned long hit_count;
+    /// @brief Number of lookups that built a new tree
+    unsigned long miss_count;
+    /// @brief Number of trees evicted to stay within `byte_budget`
+    unsigned long eviction_count;
+    /// @brief Number of times all cached trees were discarded due to a rebuilt or modified graph
+    unsigned long invalidation_count;
+    /// @brief Number of cached trees repaired by `update_edge`
+    unsigned long repair_count;
+    /// @brief Memory resource all cached trees are allocated from
+    std::pmr::memory_resource* tree_resource;
+};
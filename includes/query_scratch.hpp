@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+#include "indexed_graph.hpp"
+#include "integer_queues.hpp"
+#include "pair_minheap.hpp"
+
+
+/**
+ * Dense distance, predecessor and settled arrays of a single search, together with its minimum priority queues, kept between
+ * searches so that back-to-back queries neither allocate nor initialize an entry for every vertex. Every entry is stamped with the
+ * generation of the search that wrote it, and `begin` starts a new generation, so entries of earlier searches read as unreached
+ * @tparam Type typename of the edge weights of the searched graphs
+ * @note Not synchronized, so each thread searches with its own `query_scratch` (see `find_shortest_path`)
+ */
+template <class Type>
+class query_scratch final {
+public:
+    explicit query_scratch(std::pmr::memory_resource* resource = std::pmr::get_default_resource()): distances{resource},
+        predecessors{resource}, reached{resource}, settled{resource}, heap(16, resource), generation{0} {}
+
+
+    /**
+         * Starts a new search of a graph with `vertex_count` verticies, after which every vertex reads as unreached and unsettled
+         * and every minimum priority queue is empty. Only a change of the vertex count, or the wrap of the generation counter after 2^32
+         * searches, clears the arrays
+         * @param vertex_count Number of verticies of the graph about to be searched
+         */
+    void begin(unsigned int vertex_count) {
+        heap.clear();
+        if (dial.has_value()) {
+            dial -> clear();
+        }
+        if (radix.has_value()) {
+            radix -> clear();
+        }
+        if (reached.size() != vertex_count) {
+            distances.resize(vertex_count);
+            predecessors.resize(vertex_count);
+            reached.assign(vertex_count, 0);
+            settled.assign(vertex_count, 0);
+            generation = 0;
+        }
+        if (++generation == 0) {
+            std::fill(reached.begin(), reached.end(), 0);
+            std::fill(settled.begin(), settled.end(), 0);
+            generation = 1;
+        }
+    }
+
+
+    /**
+         * Records `distance` and `predecessor` as the shortest known path to `vertex` within the current search
+         * @param vertex ID of the reached vertex
+         * @param distance Length of the path from the source vertex
+         * @param predecessor ID of the vertex preceding `vertex` on the path (`name_arena::invalid_id` for the source vertex)
+         */
+    void reach(unsigned int vertex, Type distance, unsigned int predecessor) {
+        distances[vertex] = distance;
+        predecessors[vertex] = predecessor;
+        reached[vertex] = generation;
+    }
+
+
+    /**
+         * Marks `vertex` as settled (extracted from the minimum heap with its final distance) within the current search
+         * @param vertex ID of the settled vertex
+         */
+    void settle(unsigned int vertex) {
+        settled[vertex] = generation;
+    }
+
+
+    /**
+         * Retrieves the shortest known distance to `vertex` within the current search
+         * @param vertex ID of the vertex
+         * @return Distance from the source vertex, or `unreachable_distance<Type>()` if not reached by the current search
+         */
+    Type get_distance(unsigned int vertex) const {
+        return reached[vertex] == generation ? distances[vertex] : unreachable_distance<Type>();
+    }
+
+
+    /**
+         * Retrieves the ID of the vertex preceding `vertex` on its shortest known path within the current search
+         * @param vertex ID of the vertex
+         * @return ID of the preceding vertex, or `name_arena::invalid_id` for the source vertex and verticies not reached
+         */
+    unsigned int get_predecessor(unsigned int vertex) const {
+        return reached[vertex] == generation ? predecessors[vertex] : name_arena::invalid_id;
+    }
+
+
+    /**
+         * Determines if `vertex` has been settled by the current search
+         * @param vertex ID of the vertex
+         * @return `true` if `settle` was called for `vertex` since the last call to `begin`
+         */
+    bool is_settled(unsigned int vertex) const {
+        return settled[vertex] == generation;
+    }
+
+
+    /**
+         * Retrieves the minimum heap of the current search, emptied by `begin`
+         * @return Minimum heap ordering verticies by distance (or estimate) for the current search
+         */
+    paired_min_heap<Type, unsigned int>& get_heap() {
+        return heap;
+    }
+
+
+    /**
+         * Retrieves the bucket queue of the current search, created upon first use (or whenever `max_step` changes) and emptied by `begin`
+         * @param max_step Largest edge weight of the searched graph (see `dial_queue`)
+         * @return Bucket queue ordering verticies by distance for the current search
+         */
+    dial_queue<Type, unsigned int>& get_dial_queue(std::uint64_t max_step) {
+        if (!dial.has_value() || dial -> get_max_step() != max_step) {
+            dial.emplace(max_step, distances.get_allocator().resource());
+        }
+        return *dial;
+    }
+
+
+    /**
+         * Retrieves the radix heap of the current search, created upon first use and emptied by `begin`
+         * @return Radix heap ordering verticies by distance for the current search
+         */
+    radix_heap<Type, unsigned int>& get_radix_heap() {
+        if (!radix.has_value()) {
+            radix.emplace(distances.get_allocator().resource());
+        }
+        return *radix;
+    }
+
+
+    /**
+         * Retrieves the number of verticies of the graph given to the last call to `begin`
+         * @return Number of entries of each array
+         */
+    unsigned int get_vertex_count() const {
+        return static_cast<unsigned int>(reached.size());
+    }
+
+
+    /**
+         * Retrieves the generation stamped onto the entries written by the current search
+         * @return Number of searches begun since the arrays were last cleared
+         */
+    std::uint32_t get_generation() const {
+        return generation;
+    }
+
+
+    /**
+         * Copies the distances and predecessors of the current search into arrays indexed by vertex ID, in the form filled by
+         * `forward_search`, visiting every vertex
+         * @param vertex_distances Filled with the distance to each vertex (infinity if not reached)
+         * @param vertex_path Filled with the predecessor of each vertex (`name_arena::invalid_id` if not reached)
+         */
+    void copy_to(std::pmr::vector<Type>& vertex_distances, std::pmr::vector<unsigned int>& vertex_path) const {
+        vertex_distances.resize(reached.size());
+        vertex_path.resize(reached.size());
+        for (size_t vertex = 0; vertex < reached.size(); vertex++) {
+            vertex_distances[vertex] = get_distance(static_cast<unsigned int>(vertex));
+            vertex_path[vertex] = get_predecessor(static_cast<unsigned int>(vertex));
+        }
+    }
+
+private:
+    /// @brief Distance from the source vertex to each vertex, valid where `reached` holds the current generation
+    std::pmr::vector<Type> distances;
+    /// @brief ID of the vertex preceding each vertex on its shortest known path, valid where `reached` holds the current generation
+    std::pmr::vector<unsigned int> predecessors;
+    /// @brief Generation of the search that last reached each vertex, indexed by vertex ID
+    std::pmr::vector<std::uint32_t> reached;
+    /// @brief Generation of the search that last settled each vertex, indexed by vertex ID
+    std::pmr::vector<std::uint32_t> settled;
+    /// @brief Minimum heap kept with its storage between searches
+    paired_min_heap<Type, unsigned int> heap;
+    /// @brief Bucket queue of searches of graphs whose whole edge weights are small (see `choose_queue`), kept between searches
+    std::optional<dial_queue<Type, unsigned int>> dial;
+    /// @brief Radix heap of searches of graphs whose whole edge weights are large (see `choose_queue`), kept between searches
+    std::optional<radix_heap<Type, unsigned int>> radix;
+    /// @brief Generation of the current search (0 before the first call to `begin`)
+    std::uint32_t generation;
+};
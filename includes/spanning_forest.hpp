@@ -0,0 +1,111 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "indexed_graph.hpp"
+#include "dynamic_mst.hpp"
+#include "pair_minheap.hpp"
+
+
+/**
+ * Finds the minimum spanning forest of `graph` by running Prim's algorithm separately within every component labelled while the
+ * graph was built (see `indexed_graph::label_components`), with the components claimed in turn by up to `thread_count` threads,
+ * largest first. Components share no verticies, so every thread marks its own verticies within shared arrays
+ * @tparam Type typename of the edge weights of the graph
+ * @param graph Graph whose edges are stored in both directions with equal weights (as done by `build_adjacency_list`)
+ * @param forest_edges Filled with the edges of the forest, grouped by component in order of component label and listed within
+ * each component in the order Prim's algorithm adds them from the lowest vertex ID of the component
+ * @param thread_count Maximum number of threads (0 uses one thread per hardware thread)
+ * @return Total weight of the forest, summed in the order the edges are listed so it does not depend on the thread count
+ * @note Arrays indexed by vertex ID are allocated from the memory resource of `graph`, while the heap of each thread is
+ * allocated from the default memory resource (as the resource of `graph` need not be synchronized)
+ */
+template <class Type>
+Type minimum_spanning_forest(const indexed_graph<Type>& graph, std::vector<spanning_edge<Type>>& forest_edges,
+    unsigned int thread_count = 0) {
+    auto vertex_count = graph.get_vertex_count();
+    auto* resource = graph.get_memory_resource();
+    if (thread_count == 0) {
+        thread_count = std::max(1U, std::thread::hardware_concurrency());
+    }
+    std::pmr::vector<unsigned int> labels(resource);
+    unsigned int component_count = graph.label_components(labels);
+    // Verticies are grouped by component, so the lowest vertex of each component starts its group
+    std::pmr::vector<unsigned int> component_sizes(component_count, 0, resource);
+    std::pmr::vector<unsigned int> component_roots(component_count, name_arena::invalid_id, resource);
+    for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+        if (component_sizes[labels[vertex]]++ == 0) {
+            component_roots[labels[vertex]] = vertex;
+        }
+    }
+    std::pmr::vector<unsigned int> claim_order(component_count, 0, resource);
+    for (unsigned int label = 0; label < component_count; label++) {
+        claim_order[label] = label;
+    }
+    std::stable_sort(claim_order.begin(), claim_order.end(), [&](unsigned int a, unsigned int b) {
+        return component_sizes[a] > component_sizes[b];
+    });
+
+    std::pmr::vector<Type> lightest(vertex_count, unreachable_distance<Type>(), resource);
+    std::pmr::vector<unsigned int> lightest_from(vertex_count, name_arena::invalid_id, resource);
+    std::pmr::vector<unsigned char> in_forest(vertex_count, 0, resource);
+    std::vector<std::vector<spanning_edge<Type>>> component_edges(component_count);
+    auto grow_tree = [&](unsigned int label) {
+        auto heap = paired_min_heap<Type, unsigned int>(component_sizes[label]);
+        auto& edges = component_edges[label];
+        edges.reserve(component_sizes[label] - 1);
+        lightest[component_roots[label]] = 0;
+        heap.add_node(component_roots[label], 0);
+        unsigned int vertex = 0;
+        Type weight = 0;
+        while (!heap.is_empty()) {
+            std::tie(vertex, weight) = heap.remove_min();
+            if (in_forest[vertex] != 0 || weight > lightest[vertex]) {
+                continue;
+            }
+            in_forest[vertex] = 1;
+            if (lightest_from[vertex] != name_arena::invalid_id) {
+                edges.push_back(spanning_edge<Type>{std::min(vertex, lightest_from[vertex]), std::max(vertex, lightest_from[vertex]), weight});
+            }
+            for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+                if (in_forest[adjacent_edge.target] == 0 && adjacent_edge.weight < lightest[adjacent_edge.target]) {
+                    lightest[adjacent_edge.target] = adjacent_edge.weight;
+                    lightest_from[adjacent_edge.target] = vertex;
+                    heap.add_node(adjacent_edge.target, adjacent_edge.weight);
+                }
+            }
+        }
+    };
+
+    auto worker_count = static_cast<unsigned int>(std::min<size_t>(thread_count, component_count));
+    std::atomic<size_t> next_component{0};
+    auto claim_components = [&]() {
+        for (size_t c = next_component++; c < claim_order.size(); c = next_component++) {
+            grow_tree(claim_order[c]);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned int t = 1; t < worker_count; t++) {
+        workers.emplace_back(claim_components);
+    }
+    claim_components();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    forest_edges.clear();
+    Type total_weight = 0;
+    for (const auto& edges : component_edges) {
+        for (const auto& forest_edge : edges) {
+            forest_edges.push_back(forest_edge);
+            total_weight += forest_edge.weight;
+        }
+    }
+    return total_weight;
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "indexed_graph.hpp"
+
+
+/// @brief Number of verticies from which graphs are relabelled after loading, as the distance arrays of smaller graphs fit within the L2 cache
+inline constexpr unsigned int vertex_reorder_threshold = 1U << 16;
+
+
+/// @brief Order in which `compute_vertex_order` places the verticies of a graph
+enum class vertex_ordering {
+    /// Breadth-first order from the lowest vertex ID of each component, visiting neighbors in the order their edges were added
+    breadth_first,
+    /// Reverse Cuthill-McKee order: breadth-first from a vertex of least degree, visiting neighbors by increasing degree, then reversed
+    reverse_cuthill_mckee
+};
+
+
+/**
+ * Computes an order of the verticies of `graph` in which verticies joined by an edge lie close together, so that relabelling
+ * the graph in this order (see `reorder_graph`) places the entries of neighboring verticies within nearby cache lines
+ * @tparam Type typename of the edge weights of the graph
+ * @param graph Graph to be ordered (for directed graphs, only the edges leaving each vertex are followed)
+ * @param ordering Rule by which verticies are placed
+ * @param order Filled with the current ID of the vertex at each position of the new order
+ */
+template <class Type>
+void compute_vertex_order(const indexed_graph<Type>& graph, vertex_ordering ordering, std::pmr::vector<unsigned int>& order) {
+    auto vertex_count = graph.get_vertex_count();
+    auto* resource = order.get_allocator().resource();
+    auto degree_order = [&graph](unsigned int a, unsigned int b) {
+        size_t a_degree = graph.get_adjacent(a).size();
+        size_t b_degree = graph.get_adjacent(b).size();
+        return a_degree < b_degree || (a_degree == b_degree && a < b);
+    };
+    // Each component is started from the first unplaced vertex of `starts`
+    std::pmr::vector<unsigned int> starts(vertex_count, 0, resource);
+    for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+        starts[vertex] = vertex;
+    }
+    bool by_degree = ordering == vertex_ordering::reverse_cuthill_mckee;
+    if (by_degree) {
+        std::sort(starts.begin(), starts.end(), degree_order);
+    }
+
+    order.clear();
+    order.reserve(vertex_count);
+    std::pmr::vector<unsigned char> placed(vertex_count, 0, resource);
+    std::pmr::vector<unsigned int> neighbors(resource);
+    for (unsigned int start : starts) {
+        if (placed[start] != 0) {
+            continue;
+        }
+        placed[start] = 1;
+        order.push_back(start);
+        // Placed verticies double as the queue of the breadth-first traversal
+        for (size_t head = order.size() - 1; head < order.size(); head++) {
+            neighbors.clear();
+            for (const auto& adjacent_edge : graph.get_adjacent(order[head])) {
+                if (placed[adjacent_edge.target] == 0) {
+                    placed[adjacent_edge.target] = 1;
+                    neighbors.push_back(adjacent_edge.target);
+                }
+            }
+            if (by_degree) {
+                std::sort(neighbors.begin(), neighbors.end(), degree_order);
+            }
+            order.insert(order.end(), neighbors.begin(), neighbors.end());
+        }
+    }
+    if (by_degree) {
+        std::reverse(order.begin(), order.end());
+    }
+}
+
+
+/**
+ * Builds a copy of `graph` whose verticies are relabelled in the order given by `order`, with the edges of every vertex sorted
+ * by target ID. Vertex names are carried over, so names resolve to the new IDs and name the same verticies as before
+ * @tparam Type typename of the edge weights of the graph
+ * @param graph Graph to be relabelled
+ * @param order Current ID of the vertex receiving each new ID (see `compute_vertex_order`)
+ * @param old_to_new Filled with the new ID of each vertex, indexed by its current ID
+ * @param resource Memory resource supplying all storage of the relabelled graph
+ * @return Relabelled graph
+ * @throws `std::runtime_error` if `order` is not a permutation of the vertex IDs of `graph`
+ */
+template <class Type>
+indexed_graph<Type> reorder_graph(const indexed_graph<Type>& graph, const std::pmr::vector<unsigned int>& order,
+    std::pmr::vector<unsigned int>& old_to_new, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    auto vertex_count = graph.get_vertex_count();
+    if (order.size() != vertex_count) {
+        throw std::runtime_error("ERROR: Vertex order does not hold every vertex of the graph exactly once!");
+    }
+    old_to_new.assign(vertex_count, name_arena::invalid_id);
+    for (unsigned int position = 0; position < vertex_count; position++) {
+        if (order[position] >= vertex_count || old_to_new[order[position]] != name_arena::invalid_id) {
+            std::string explain = "ERROR: Vertex order does not hold every vertex of the graph exactly once (position '";
+            explain.append(std::to_string(position)).append("')!");
+            throw std::runtime_error(explain);
+        }
+        old_to_new[order[position]] = position;
+    }
+
+    auto reordered = indexed_graph<Type>(vertex_count, resource);
+    for (unsigned int vertex : order) {
+        reordered.add_vertex(graph.get_vertex_name(vertex));
+    }
+    std::vector<typename indexed_graph<Type>::edge> edges;
+    for (unsigned int position = 0; position < vertex_count; position++) {
+        edges.clear();
+        for (const auto& adjacent_edge : graph.get_adjacent(order[position])) {
+            edges.push_back({old_to_new[adjacent_edge.target], adjacent_edge.weight});
+        }
+        std::sort(edges.begin(), edges.end(), [](const auto& a, const auto& b) { return a.target < b.target; });
+        for (const auto& adjacent_edge : edges) {
+            reordered.add_edge(position, adjacent_edge.target, adjacent_edge.weight);
+        }
+    }
+    return reordered;
+}
+
+
+/**
+ * Measures how far apart the IDs of verticies joined by an edge lie, which bounds how far apart their entries lie within
+ * every array indexed by vertex ID
+ * @tparam Type typename of the edge weights of the graph
+ * @param graph Graph to be measured
+ * @return Mean absolute difference between the IDs at either end of each edge (0 if the graph has no edges)
+ */
+template <class Type>
+double mean_edge_span(const indexed_graph<Type>& graph) {
+    double span_total = 0;
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+            span_total += vertex > adjacent_edge.target ? vertex - adjacent_edge.target : adjacent_edge.target - vertex;
+        }
+    }
+    return graph.get_edge_count() == 0 ? 0 : span_total / static_cast<double>(graph.get_edge_count());
+}
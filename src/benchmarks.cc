@@ -0,0 +1,885 @@
+// Stand-alone benchmarking executable for measuring the performance of the customized containers and graph processing loops
+// Results are written to standard output (redirect into 'bench_output.txt' to keep a record of a run)
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+// The hardware cache miss counter is only read through the performance events of Linux
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "../includes/pair_minheap.hpp"
+#include "../includes/derived_hashmap.hpp"
+#include "../includes/indexed_graph.hpp"
+#include "../includes/path_search.hpp"
+#include "../includes/contraction_hierarchy.hpp"
+#include "../includes/hub_labels.hpp"
+#include "../includes/distance_matrix.hpp"
+#include "../includes/delta_stepping.hpp"
+#include "../includes/integer_queues.hpp"
+#include "../includes/k_shortest_paths.hpp"
+#include "../includes/dynamic_mst.hpp"
+#include "../includes/spanning_forest.hpp"
+#include "../includes/vertex_order.hpp"
+#include "../includes/arc_flags.hpp"
+#include "../includes/query_scratch.hpp"
+#include "../src/gprintf.cpp"
+#include "../src/derived_hashmap.cpp"
+#include "../src/name_arena.cpp"
+#include "../src/mapped_file.cpp"
+
+
+/**
+ * Measures elapsed wall-clock time of the callable `work` in nanoseconds
+ * @param work Callable to be timed
+ * @return Number of nanoseconds elapsed during the call to `work`
+ */
+template <class Callable>
+static double time_nanoseconds(Callable&& work) {
+    auto start = std::chrono::steady_clock::now();
+    work();
+    auto stop = std::chrono::steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+}
+
+
+/**
+ * Fills `adj_list` with a connected, ring-shaped graph of `vertex_count` verticies named "V0" to "V<vertex_count - 1>",
+ * where each vertex is joined to the next vertex and to the vertex `stride` positions ahead of it
+ * @param adj_list Container receiving the generated undirected edges
+ * @param vertex_count Number of unique verticies to be generated
+ * @param stride Distance (in vertex names) between each vertex and its second neighbor
+ */
+static void build_ring_graph(main_hashmap<double>& adj_list, unsigned int vertex_count, unsigned int stride) {
+    auto add_directed = [&adj_list, vertex_count](const std::string& from, const std::string& to, double weight) {
+        if (!adj_list.contains_key(from)) {
+            soa_hashmap<double> adjacent(vertex_count);
+            adjacent.add(to, weight);
+            adj_list.add(from, std::move(adjacent));
+        } else if (!adj_list.get_hash_key(from).contains_key(to)) {
+            adj_list.get_hash_key(from).add(to, weight);
+        }
+    };
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        std::string vertex = "V" + std::to_string(i);
+        std::string next = "V" + std::to_string((i + 1) % vertex_count);
+        std::string skip = "V" + std::to_string((i + stride) % vertex_count);
+        double next_weight = static_cast<double>((i * 7) % 13 + 1);
+        double skip_weight = static_cast<double>((i * 11) % 29 + 5);
+        add_directed(vertex, next, next_weight);
+        add_directed(next, vertex, next_weight);
+        add_directed(vertex, skip, skip_weight);
+        add_directed(skip, vertex, skip_weight);
+    }
+}
+
+
+// ==================================================== HASHMAP DISPATCH BENCHMARK ==================================================================
+
+/**
+ * Polymorphic lookup interface reproducing the dynamic dispatch of the previous `virtual` hashmap member functions
+ */
+class virtual_lookup {
+public:
+    virtual ~virtual_lookup() = default;
+    virtual bool contains_key(const std::string& key) = 0;
+    virtual double get_val(const std::string& key) = 0;
+};
+
+
+/**
+ * Forwards every lookup through the `virtual_lookup` interface to the wrapped `soa_hashmap`
+ */
+class forwarding_lookup : public virtual_lookup {
+public:
+    forwarding_lookup(soa_hashmap<double>& m): adjacent(m) {}
+    bool contains_key(const std::string& key) override { return adjacent.contains_key(key); }
+    double get_val(const std::string& key) override { return adjacent.get_val(key); }
+private:
+    soa_hashmap<double>& adjacent;
+};
+
+
+/**
+ * Replicates the relaxation loop of `find_shortest_path` (every popped vertex probes every vertex of the graph for adjacency)
+ * with each adjacency lookup issued through `lookup_adjacent`
+ * @param adj_list Graph to be searched
+ * @param source Name of the source vertex
+ * @param lookup_adjacent Callable receiving the adjacent `soa_hashmap` of the popped vertex and a candidate vertex name, which
+ * returns the weight of the edge between them or a negative value if none exists
+ * @param lookup_count Accumulates the number of adjacency lookups performed
+ * @return Sum of all settled shortest distances (prevents the search from being optimized away)
+ */
+template <class Lookup>
+static double run_dijkstra_lookups(main_hashmap<double>& adj_list, const std::string& source, Lookup&& lookup_adjacent, unsigned long& lookup_count) {
+    auto vertex_list = adj_list.get_keys();
+    auto vertex_count = static_cast<unsigned int>(vertex_list.size());
+    auto visited_vertices = soa_hashmap<double>(vertex_count);
+    auto mhp = paired_min_heap<double>(vertex_count);
+    for (const auto& vertex : vertex_list) {
+        visited_vertices.add(vertex, std::numeric_limits<double>::infinity());
+    }
+    visited_vertices.add(source, 0.0);
+    mhp.add_node(source, 0.0);
+
+    std::string popped_vertex;
+    double popped_vertex_distance = 0;
+    double distance_sum = 0;
+    while (!mhp.is_empty()) {
+        std::tie(popped_vertex, popped_vertex_distance) = mhp.remove_min();
+        if (popped_vertex_distance > visited_vertices.get_val(popped_vertex)) {
+            continue;
+        }
+        distance_sum += popped_vertex_distance;
+        soa_hashmap<double>& adjacent = adj_list.get_hash_key(popped_vertex);
+        for (const auto& vertex : vertex_list) {
+            lookup_count++;
+            double weight = lookup_adjacent(adjacent, vertex);
+            if (weight < 0) {
+                continue;
+            }
+            double di = weight + popped_vertex_distance;
+            if (di < visited_vertices.get_val(vertex)) {
+                visited_vertices.add(vertex, di);
+                mhp.add_node(vertex, di);
+            }
+        }
+    }
+    return distance_sum;
+}
+
+
+/**
+ * Compares the per-lookup cost of the adjacency probes made inside `find_shortest_path` when issued directly on the
+ * `final` hashmap classes against the same probes issued through a virtual interface
+ */
+static void benchmark_hashmap_dispatch() {
+    const unsigned int vertex_count = 2000;
+    auto adj_list = main_hashmap<double>(vertex_count);
+    build_ring_graph(adj_list, vertex_count, 37);
+
+    unsigned long direct_lookups = 0;
+    double direct_sum = 0;
+    double direct_ns = time_nanoseconds([&]() {
+        direct_sum = run_dijkstra_lookups(adj_list, "V0", [](soa_hashmap<double>& adjacent, const std::string& vertex) {
+            if (adjacent.contains_key(vertex)) {
+                return adjacent.get_val(vertex);
+            }
+            return -1.0;
+        }, direct_lookups);
+    });
+
+    unsigned long virtual_lookups = 0;
+    double virtual_sum = 0;
+    double virtual_ns = time_nanoseconds([&]() {
+        virtual_sum = run_dijkstra_lookups(adj_list, "V0", [](soa_hashmap<double>& adjacent, const std::string& vertex) {
+            forwarding_lookup forwarder(adjacent);
+            // Volatile pointer hides the dynamic type of the forwarder from the optimizer, forcing true virtual dispatch
+            virtual_lookup* volatile opaque = &forwarder;
+            virtual_lookup& lookup = *opaque;
+            if (lookup.contains_key(vertex)) {
+                return lookup.get_val(vertex);
+            }
+            return -1.0;
+        }, virtual_lookups);
+    });
+
+    std::cout << "=============================== HASHMAP DISPATCH (find_shortest_path lookups) ===============================\n";
+    std::cout << "Verticies: " << vertex_count << ", adjacency lookups per search: " << direct_lookups << '\n';
+    std::cout << "Final (inlined) lookups:   " << direct_ns / static_cast<double>(direct_lookups) << " ns/lookup\n";
+    std::cout << "Virtual dispatch lookups:  " << virtual_ns / static_cast<double>(virtual_lookups) << " ns/lookup\n";
+    std::cout << "Speedup:                   " << virtual_ns / direct_ns << "x\n";
+    if (direct_sum != virtual_sum) {
+        std::cerr << "ERROR: Searches using final and virtual lookups produced different distances!\n";
+    }
+    std::cout << '\n';
+}
+
+
+// ==================================================== DISTANCE QUERY BENCHMARK ==================================================================
+
+/**
+ * Builds a connected, ring-shaped `indexed_graph` with the same verticies and edges as `build_ring_graph`
+ * @param vertex_count Number of unique verticies to be generated
+ * @param stride Distance (in vertex names) between each vertex and its second neighbor
+ * @return Graph holding every generated edge in both directions
+ */
+static indexed_graph<double> build_indexed_ring(unsigned int vertex_count, unsigned int stride) {
+    auto graph = indexed_graph<double>(vertex_count);
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        std::string vertex = "V" + std::to_string(i);
+        std::string next = "V" + std::to_string((i + 1) % vertex_count);
+        std::string skip = "V" + std::to_string((i + stride) % vertex_count);
+        double next_weight = static_cast<double>((i * 7) % 13 + 1);
+        double skip_weight = static_cast<double>((i * 11) % 29 + 5);
+        graph.add_edge(vertex, next, next_weight);
+        graph.add_edge(next, vertex, next_weight);
+        graph.add_edge(vertex, skip, skip_weight);
+        graph.add_edge(skip, vertex, skip_weight);
+    }
+    return graph;
+}
+
+
+/**
+ * Compares the latency of distance-only queries answered by a bidirectional Dijkstra search, a contraction hierarchy search
+ * and a merge of hub labels, along with the preprocessing time of the hierarchy and the labels
+ */
+static void benchmark_distance_queries() {
+    const unsigned int vertex_count = 5000;
+    const unsigned int stride = 37;
+    const unsigned int query_count = 2000;
+    auto graph = build_indexed_ring(vertex_count, stride);
+    auto hierarchy = contraction_hierarchy<double>();
+    auto labels = hub_labels<double>();
+    double hierarchy_build_ns = time_nanoseconds([&]() { hierarchy.build(graph); });
+    double label_build_ns = time_nanoseconds([&]() { labels.build(hierarchy); });
+
+    std::pmr::unsynchronized_pool_resource query_pool;
+    std::pmr::vector<double> distances(&query_pool);
+    std::pmr::vector<unsigned int> vertex_path(&query_pool);
+    double dijkstra_checksum = 0;
+    double hierarchy_checksum = 0;
+    double label_checksum = 0;
+    auto query_pair = [vertex_count](unsigned int q) {
+        return std::make_pair((q * 7919) % vertex_count, (q * 104729 + 13) % vertex_count);
+    };
+    double dijkstra_ns = time_nanoseconds([&]() {
+        for (unsigned int q = 0; q < query_count; q++) {
+            auto [source, destination] = query_pair(q);
+            dijkstra_checksum += bidirectional_search(graph, source, destination, distances, vertex_path).distance;
+        }
+    });
+    double hierarchy_ns = time_nanoseconds([&]() {
+        for (unsigned int q = 0; q < query_count; q++) {
+            auto [source, destination] = query_pair(q);
+            hierarchy_checksum += hierarchy_search(hierarchy, source, destination, distances, vertex_path).distance;
+        }
+    });
+    double label_ns = time_nanoseconds([&]() {
+        for (unsigned int q = 0; q < query_count; q++) {
+            auto [source, destination] = query_pair(q);
+            label_checksum += labels.distance(source, destination);
+        }
+    });
+
+    std::cout << "=============================== DISTANCE QUERIES ===============================\n";
+    std::cout << "Verticies: " << vertex_count << ", queries: " << query_count << '\n';
+    std::cout << "Hierarchy build:      " << hierarchy_build_ns / 1e6 << " ms (" << hierarchy.get_shortcut_count() << " shortcuts)\n";
+    std::cout << "Hub label build:      " << label_build_ns / 1e6 << " ms (" << static_cast<double>(labels.get_entry_count()) / vertex_count << " hubs/vertex)\n";
+    std::cout << "Bidirectional search: " << dijkstra_ns / query_count / 1e3 << " us/query\n";
+    std::cout << "Hierarchy search:     " << hierarchy_ns / query_count / 1e3 << " us/query\n";
+    std::cout << "Hub label merge:      " << label_ns / query_count / 1e3 << " us/query\n";
+    if (dijkstra_checksum != hierarchy_checksum || dijkstra_checksum != label_checksum) {
+        std::cerr << "ERROR: Distance queries returned different distances!\n";
+    }
+    std::cout << '\n';
+}
+
+
+// ==================================================== DISTANCE MATRIX BENCHMARK ==================================================================
+
+/**
+ * Compares the time taken to fill a many-to-many distance matrix on a single thread and on every hardware thread
+ */
+static void benchmark_distance_matrix() {
+    const unsigned int vertex_count = 5000;
+    const unsigned int stride = 37;
+    const unsigned int side = 500;
+    auto graph = build_indexed_ring(vertex_count, stride);
+    std::vector<unsigned int> sources;
+    std::vector<unsigned int> targets;
+    for (unsigned int i = 0; i < side; i++) {
+        sources.push_back((i * 7919) % vertex_count);
+        targets.push_back((i * 104729 + 13) % vertex_count);
+    }
+    unsigned int thread_count = std::max(1U, std::thread::hardware_concurrency());
+    auto single_thread = distance_matrix<double>();
+    auto multi_thread = distance_matrix<double>();
+    double single_ns = time_nanoseconds([&]() { single_thread.compute(graph, sources, targets, 1); });
+    double multi_ns = time_nanoseconds([&]() { multi_thread.compute(graph, sources, targets, thread_count); });
+
+    std::cout << "=============================== DISTANCE MATRIX ===============================\n";
+    std::cout << "Verticies: " << vertex_count << ", matrix: " << side << " x " << side << '\n';
+    std::cout << "Settled per row:      " << static_cast<double>(single_thread.get_settled_count()) / side << '\n';
+    std::cout << "Single thread:        " << single_ns / 1e6 << " ms\n";
+    std::cout << "Hardware threads:     " << multi_ns / 1e6 << " ms (" << thread_count << " threads, " << single_ns / multi_ns << "x speedup)\n";
+    if (std::memcmp(single_thread.data(), multi_thread.data(), side * side * sizeof(double)) != 0) {
+        std::cerr << "ERROR: Distance matrices computed with different thread counts differ!\n";
+    }
+    std::cout << '\n';
+}
+
+
+// ==================================================== SINGLE-SOURCE TREE BENCHMARK ==================================================================
+
+/**
+ * Compares the time taken to build a complete shortest path tree with a sequential Dijkstra search and with delta-stepping
+ * on a single thread and on every hardware thread
+ */
+static void benchmark_single_source_trees() {
+    const unsigned int vertex_count = 200000;
+    const unsigned int stride = 37;
+    auto graph = build_indexed_ring(vertex_count, stride);
+    // Long-range edges keep the frontier of each bucket wide enough to be relaxed in parallel
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        unsigned int other = static_cast<unsigned int>((static_cast<unsigned long>(i) * 104729 + 13) % vertex_count);
+        double weight = static_cast<double>((i * 5) % 23 + 10);
+        graph.add_edge(i, other, weight);
+        graph.add_edge(other, i, weight);
+    }
+    unsigned int thread_count = std::max(1U, std::thread::hardware_concurrency());
+    std::pmr::unsynchronized_pool_resource query_pool;
+    std::pmr::vector<double> expected_distances(&query_pool);
+    std::pmr::vector<unsigned int> expected_path(&query_pool);
+    std::pmr::vector<double> distances(&query_pool);
+    std::pmr::vector<unsigned int> vertex_path(&query_pool);
+    double delta = suggest_delta(graph);
+    double dijkstra_ns = time_nanoseconds([&]() { shortest_path_tree(graph, 0, expected_distances, expected_path); });
+    double single_ns = time_nanoseconds([&]() { delta_stepping_tree(graph, 0, distances, vertex_path, delta, 1); });
+    double multi_ns = time_nanoseconds([&]() { delta_stepping_tree(graph, 0, distances, vertex_path, delta, thread_count); });
+
+    std::cout << "=============================== SINGLE-SOURCE TREES ===============================\n";
+    std::cout << "Verticies: " << vertex_count << ", edges: " << graph.get_edge_count() << ", suggested delta: " << delta << '\n';
+    std::cout << "Sequential Dijkstra:  " << dijkstra_ns / 1e6 << " ms\n";
+    std::cout << "Delta-stepping (1):   " << single_ns / 1e6 << " ms\n";
+    std::cout << "Delta-stepping (all): " << multi_ns / 1e6 << " ms (" << thread_count << " threads)\n";
+    if (distances != expected_distances || vertex_path != expected_path) {
+        std::cerr << "ERROR: Delta-stepping and Dijkstra's algorithm built different trees!\n";
+    }
+    std::cout << '\n';
+}
+
+
+/**
+ * Compares complete Dijkstra searches ordered by the binary heap of `paired_min_heap`, by the circular buckets of `dial_queue`
+ * and by `radix_heap` on graphs with whole edge weights drawn from a narrow and from a wide range
+ */
+static void benchmark_integer_queues() {
+    const unsigned int vertex_count = 200000;
+    std::cout << "================================ INTEGER QUEUES =================================\n";
+    for (unsigned int weight_range : {100U, 1000000U}) {
+        auto graph = indexed_graph<double>(vertex_count);
+        for (unsigned int i = 0; i < vertex_count; i++) {
+            graph.add_vertex("V" + std::to_string(i));
+        }
+        for (unsigned int i = 0; i < vertex_count; i++) {
+            for (unsigned int other : {(i + 1) % vertex_count, (i + 37) % vertex_count,
+                static_cast<unsigned int>((static_cast<unsigned long>(i) * 104729 + 13) % vertex_count)}) {
+                auto weight = static_cast<double>((static_cast<unsigned long>(i) * 7919 + other) % weight_range + 1);
+                graph.add_edge(i, other, weight);
+                graph.add_edge(other, i, weight);
+            }
+        }
+        std::pmr::unsynchronized_pool_resource query_pool;
+        std::pmr::vector<double> expected_distances(&query_pool);
+        std::pmr::vector<unsigned int> expected_path(&query_pool);
+        std::pmr::vector<double> distances(&query_pool);
+        std::pmr::vector<unsigned int> vertex_path(&query_pool);
+        double heap_ns = time_nanoseconds([&]() { shortest_path_tree(graph, 0, expected_distances, expected_path, queue_kind::binary_heap); });
+        double dial_ns = time_nanoseconds([&]() { shortest_path_tree(graph, 0, distances, vertex_path, queue_kind::dial_buckets); });
+        bool same_trees = distances == expected_distances && vertex_path == expected_path;
+        double radix_ns = time_nanoseconds([&]() { shortest_path_tree(graph, 0, distances, vertex_path, queue_kind::radix_heap); });
+        same_trees = same_trees && distances == expected_distances && vertex_path == expected_path;
+
+        std::cout << "Weights 1 to " << weight_range << " (" << graph.get_edge_count() << " edges, automatic choice: "
+            << (choose_queue(graph) == queue_kind::dial_buckets ? "Dial's buckets" : "radix heap") << ")\n";
+        std::cout << "Binary heap:     " << heap_ns / 1e6 << " ms\n";
+        std::cout << "Dial's buckets:  " << dial_ns / 1e6 << " ms\n";
+        std::cout << "Radix heap:      " << radix_ns / 1e6 << " ms\n";
+        if (!same_trees) {
+            std::cerr << "ERROR: Dijkstra searches with different queues built different trees!\n";
+        }
+    }
+    std::cout << '\n';
+}
+
+
+
+// ==================================================== K SHORTEST PATHS BENCHMARK ==================================================================
+
+/**
+ * Compares the time taken by Yen's algorithm to find the 10 shortest loopless paths between two distant verticies with the
+ * time taken by 10 complete Dijkstra searches, along with the work saved by reusing the reverse tree and by A* spur searches
+ */
+static void benchmark_k_shortest_paths() {
+    const unsigned int vertex_count = 200000;
+    const size_t k = 10;
+    auto graph = build_indexed_ring(vertex_count, 37);
+    unsigned int destination = vertex_count / 2;
+    std::pmr::unsynchronized_pool_resource query_pool;
+    std::pmr::vector<double> distances(&query_pool);
+    std::pmr::vector<unsigned int> vertex_path(&query_pool);
+    auto paths = k_shortest_paths<double>(&query_pool);
+    double dijkstra_ns = time_nanoseconds([&]() {
+        for (size_t i = 0; i < k; i++) {
+            shortest_path_tree(graph, 0, distances, vertex_path);
+        }
+    });
+    size_t found = 0;
+    double yen_ns = time_nanoseconds([&]() { found = paths.build(graph, 0, destination, k); });
+
+    std::cout << "================================ K SHORTEST PATHS =================================\n";
+    std::cout << "Verticies: " << vertex_count << ", edges: " << graph.get_edge_count() << ", paths found: " << found << " of " << k << '\n';
+    std::cout << k << " Dijkstra trees:     " << dijkstra_ns / 1e6 << " ms\n";
+    std::cout << "Yen's algorithm:      " << yen_ns / 1e6 << " ms (" << paths.get_spur_search_count() << " spur searches settling "
+        << paths.get_settled_count() << " verticies, " << paths.get_reused_count() << " spur paths reused)\n";
+    if (found != k || paths.get_path(0).distance != distances[destination]) {
+        std::cerr << "ERROR: Yen's algorithm did not find the shortest path first!\n";
+    }
+    std::cout << '\n';
+}
+
+// ==================================================== EDGE UPDATES BENCHMARK ==================================================================
+
+/**
+ * Compares repairing four cached shortest path trees after each of a series of edge weight changes (both shorter and longer)
+ * against building all four trees again after every change
+ */
+static void benchmark_edge_updates() {
+    const unsigned int vertex_count = 200000;
+    const unsigned int update_count = 40;
+    auto graph = build_indexed_ring(vertex_count, 37);
+    auto rebuilt_graph = build_indexed_ring(vertex_count, 37);
+    std::vector<unsigned int> sources = {0, vertex_count / 4, vertex_count / 2, vertex_count * 3 / 4};
+    auto cache = path_tree_cache<double>(size_t(1) << 30);
+    for (unsigned int source : sources) {
+        cache.get_tree(graph, source);
+    }
+    // Each update rescales one edge to between half and twice its previous weight
+    auto update_edge = [&](const indexed_graph<double>& updated, unsigned int update, unsigned int& first, unsigned int& second, double& weight) {
+        first = (update * 7919U) % vertex_count;
+        second = update % 2 == 0 ? (first + 1) % vertex_count : (first + 37) % vertex_count;
+        weight = updated.get_edge_weight(first, second) * (update % 3 == 0 ? 0.5 : 2.0);
+    };
+    unsigned int first = 0;
+    unsigned int second = 0;
+    double weight = 0;
+    double repair_ns = time_nanoseconds([&]() {
+        for (unsigned int update = 0; update < update_count; update++) {
+            update_edge(graph, update, first, second, weight);
+            cache.update_edge(graph, first, second, weight);
+        }
+    });
+    std::vector<path_tree<double>> trees(sources.size());
+    double rebuild_ns = time_nanoseconds([&]() {
+        for (unsigned int update = 0; update < update_count; update++) {
+            update_edge(rebuilt_graph, update, first, second, weight);
+            rebuilt_graph.set_edge_weight(first, second, weight);
+            rebuilt_graph.set_edge_weight(second, first, weight);
+            for (size_t i = 0; i < sources.size(); i++) {
+                trees[i].build(rebuilt_graph, sources[i]);
+            }
+        }
+    });
+
+    std::cout << "================================== EDGE UPDATES ===================================\n";
+    std::cout << "Verticies: " << vertex_count << ", edges: " << graph.get_edge_count() << ", cached trees: " << sources.size()
+        << ", weight changes: " << update_count << '\n';
+    std::cout << "Rebuilt trees:        " << rebuild_ns / update_count / 1e3 << " us per change\n";
+    std::cout << "Repaired trees:       " << repair_ns / update_count / 1e3 << " us per change\n";
+    for (size_t i = 0; i < sources.size(); i++) {
+        if (cache.get_tree(graph, sources[i]).get_distances() != trees[i].get_distances()) {
+            std::cerr << "ERROR: Repaired tree differs from the rebuilt tree!\n";
+        }
+    }
+    std::cout << '\n';
+}
+
+
+// ==================================================== DYNAMIC MST BENCHMARK ==================================================================
+
+/**
+ * Compares keeping a minimum spanning forest current through a series of edge insertions and weight decreases against running
+ * Kruskal's algorithm over the whole graph again after each of them
+ */
+static void benchmark_dynamic_mst() {
+    const unsigned int vertex_count = 200000;
+    const unsigned int update_count = 20000;
+    const unsigned int rebuild_count = 5;
+    auto graph = build_indexed_ring(vertex_count, 37);
+    auto forest = dynamic_mst<double>();
+    double build_ns = time_nanoseconds([&]() { forest.build(graph); });
+    double update_ns = time_nanoseconds([&]() {
+        for (unsigned int update = 0; update < update_count; update++) {
+            unsigned int first = (update * 7919U) % vertex_count;
+            // Shortcuts across the ring replace the heaviest edge of the cycle they close whenever they are lighter
+            unsigned int second = (first + 1000 + update % 5000) % vertex_count;
+            forest.insert_edge(first, second, static_cast<double>(update % 40 + 1));
+        }
+    });
+    double rebuild_ns = time_nanoseconds([&]() {
+        for (unsigned int rebuild = 0; rebuild < rebuild_count; rebuild++) {
+            auto rebuilt = dynamic_mst<double>();
+            rebuilt.build(graph);
+        }
+    });
+
+    std::cout << "=================================== DYNAMIC MST ===================================\n";
+    std::cout << "Verticies: " << vertex_count << ", edges: " << graph.get_edge_count() << ", updates: " << update_count
+        << " (" << forest.get_replacement_count() << " forest edges replaced)\n";
+    std::cout << "Initial forest:       " << build_ns / 1e6 << " ms\n";
+    std::cout << "Rebuilt forest:       " << rebuild_ns / rebuild_count / 1e3 << " us per update\n";
+    std::cout << "Updated forest:       " << update_ns / update_count / 1e3 << " us per update\n";
+    std::cout << "Forest weight:        " << forest.get_total_weight() << " over " << forest.get_edge_count() << " edges\n";
+    std::cout << '\n';
+}
+
+
+// ==================================================== COMPONENTS BENCHMARK ==================================================================
+
+/**
+ * Compares rejecting queries between separate components by the union-find maintained while the graph is built against a
+ * search that exhausts the component of the source vertex, along with the minimum spanning forest grown by one thread compared
+ * to one thread per hardware thread
+ */
+static void benchmark_components() {
+    const unsigned int component_count = 32;
+    const unsigned int component_size = 8000;
+    const unsigned int query_count = 200;
+    auto graph = indexed_graph<double>(component_count * component_size);
+    for (unsigned int component = 0; component < component_count; component++) {
+        std::string prefix = "C" + std::to_string(component) + " V";
+        for (unsigned int i = 0; i < component_size; i++) {
+            std::string vertex = prefix + std::to_string(i);
+            std::string next = prefix + std::to_string((i + 1) % component_size);
+            std::string skip = prefix + std::to_string((i + 37) % component_size);
+            double next_weight = static_cast<double>((i * 7) % 13 + 1);
+            double skip_weight = static_cast<double>((i * 11) % 29 + 5);
+            graph.add_edge(vertex, next, next_weight);
+            graph.add_edge(next, vertex, next_weight);
+            graph.add_edge(vertex, skip, skip_weight);
+            graph.add_edge(skip, vertex, skip_weight);
+        }
+    }
+
+    std::pmr::unsynchronized_pool_resource query_pool;
+    std::pmr::vector<double> distances(&query_pool);
+    std::pmr::vector<unsigned int> vertex_path(&query_pool);
+    // Every query pairs verticies of neighbouring components, so no path exists
+    auto query_pair = [&](unsigned int q) {
+        unsigned int source = (q * 7919U) % graph.get_vertex_count();
+        return std::make_pair(source, (source + component_size) % graph.get_vertex_count());
+    };
+    unsigned int searched_rejections = 0;
+    unsigned int component_rejections = 0;
+    double search_ns = time_nanoseconds([&]() {
+        for (unsigned int q = 0; q < query_count; q++) {
+            auto [source, destination] = query_pair(q);
+            if (forward_search(graph, source, destination, distances, vertex_path).distance == unreachable_distance<double>()) {
+                searched_rejections++;
+            }
+        }
+    });
+    double component_ns = time_nanoseconds([&]() {
+        for (unsigned int q = 0; q < query_count; q++) {
+            auto [source, destination] = query_pair(q);
+            if (!graph.same_component(source, destination)) {
+                component_rejections++;
+            }
+        }
+    });
+
+    unsigned int thread_count = std::max(1U, std::thread::hardware_concurrency());
+    std::vector<spanning_edge<double>> forest_edges;
+    double sequential_weight = 0;
+    double threaded_weight = 0;
+    double sequential_ns = time_nanoseconds([&]() { sequential_weight = minimum_spanning_forest(graph, forest_edges, 1); });
+    double threaded_ns = time_nanoseconds([&]() { threaded_weight = minimum_spanning_forest(graph, forest_edges, thread_count); });
+
+    std::cout << "=================================== COMPONENTS ===================================\n";
+    std::cout << "Verticies: " << graph.get_vertex_count() << ", edges: " << graph.get_edge_count() << ", components: "
+        << graph.get_component_count() << ", queries between components: " << query_count << '\n';
+    std::cout << "Search rejection:     " << search_ns / query_count / 1e3 << " us per query (" << searched_rejections << " rejected)\n";
+    std::cout << "Component rejection:  " << component_ns / query_count << " ns per query (" << component_rejections << " rejected)\n";
+    std::cout << "Forest (1 thread):    " << sequential_ns / 1e6 << " ms, weight " << sequential_weight << " over "
+        << forest_edges.size() << " edges\n";
+    std::cout << "Forest (" << thread_count << " threads):   " << threaded_ns / 1e6 << " ms, weight " << threaded_weight << '\n';
+    std::cout << '\n';
+}
+
+
+// ==================================================== VERTEX ORDER BENCHMARK ==================================================================
+
+/**
+ * Counts the hardware cache misses of the calling thread during the call to `work`
+ * @param work Callable to be measured
+ * @return Number of cache misses, or -1 if the counter cannot be read (on other platforms, or without access to performance events)
+ */
+template <class Callable>
+static long long count_cache_misses(Callable&& work) {
+#ifdef __linux__
+    perf_event_attr attributes;
+    std::memset(&attributes, 0, sizeof(attributes));
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.size = sizeof(attributes);
+    attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    long counter = syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+    if (counter >= 0) {
+        long long misses = -1;
+        ioctl(static_cast<int>(counter), PERF_EVENT_IOC_RESET, 0);
+        ioctl(static_cast<int>(counter), PERF_EVENT_IOC_ENABLE, 0);
+        work();
+        ioctl(static_cast<int>(counter), PERF_EVENT_IOC_DISABLE, 0);
+        if (read(static_cast<int>(counter), &misses, sizeof(misses)) != static_cast<ssize_t>(sizeof(misses))) {
+            misses = -1;
+        }
+        close(static_cast<int>(counter));
+        return misses;
+    }
+#endif
+    work();
+    return -1;
+}
+
+
+/**
+ * Compares complete Dijkstra searches over a large grid whose verticies are numbered in a scattered order (as names may appear
+ * within a file) against the same grid relabelled in breadth-first and in reverse Cuthill-McKee order, measuring the time, the
+ * hardware cache misses (where available) of a complete search and the mean distance between the IDs of neighboring verticies
+ */
+static void benchmark_vertex_order() {
+    const unsigned int side = 512;
+    const unsigned int vertex_count = side * side;
+    const unsigned int search_count = 5;
+    auto name = [](unsigned int cell) { return "R" + std::to_string(cell / side) + " C" + std::to_string(cell % side); };
+    auto graph = indexed_graph<double>(vertex_count);
+    // Names are added in a shuffled order, and edges are then added between the IDs of grid cells
+    std::vector<unsigned int> cells(vertex_count);
+    std::iota(cells.begin(), cells.end(), 0U);
+    std::shuffle(cells.begin(), cells.end(), std::mt19937(7919));
+    std::vector<unsigned int> cell_ids(vertex_count);
+    for (unsigned int cell : cells) {
+        cell_ids[cell] = graph.add_vertex(name(cell));
+    }
+    for (unsigned int cell = 0; cell < vertex_count; cell++) {
+        double weight = static_cast<double>((cell * 7) % 13 + 1);
+        if (cell % side + 1 < side) {
+            graph.add_edge(cell_ids[cell], cell_ids[cell + 1], weight);
+            graph.add_edge(cell_ids[cell + 1], cell_ids[cell], weight);
+        }
+        if (cell + side < vertex_count) {
+            graph.add_edge(cell_ids[cell], cell_ids[cell + side], weight + 3);
+            graph.add_edge(cell_ids[cell + side], cell_ids[cell], weight + 3);
+        }
+    }
+    std::string source = name(vertex_count / 2 + side / 2);
+    std::string destination = name(vertex_count - 1);
+
+    std::pmr::unsynchronized_pool_resource query_pool;
+    std::pmr::vector<double> distances(&query_pool);
+    std::pmr::vector<unsigned int> vertex_path(&query_pool);
+    std::pmr::vector<unsigned int> order(&query_pool);
+    std::pmr::vector<unsigned int> old_to_new(&query_pool);
+    std::cout << "=================================== VERTEX ORDER ===================================\n";
+    std::cout << "Verticies: " << vertex_count << ", edges: " << graph.get_edge_count() << " (grid of " << side << " x " << side << ")\n";
+    double expected_distance = 0;
+    auto measure = [&](const char* label, const indexed_graph<double>& ordered, double relabel_ns) {
+        unsigned int source_id = ordered.get_vertex_id(source);
+        // An initial search sizes the arrays, so that the measured search only differs in the order of its memory accesses
+        shortest_path_tree(ordered, source_id, distances, vertex_path);
+        long long misses = 0;
+        double search_ns = time_nanoseconds([&]() {
+            misses = count_cache_misses([&]() {
+                for (unsigned int search = 0; search < search_count; search++) {
+                    shortest_path_tree(ordered, source_id, distances, vertex_path);
+                }
+            });
+        });
+        double distance = distances[ordered.get_vertex_id(destination)];
+        std::cout << label << "mean ID span " << mean_edge_span(ordered) << ", search " << search_ns / search_count / 1e6 << " ms, cache misses ";
+        if (misses < 0) {
+            std::cout << "unavailable";
+        } else {
+            std::cout << misses / search_count;
+        }
+        if (relabel_ns > 0) {
+            std::cout << ", relabelled in " << relabel_ns / 1e6 << " ms";
+        }
+        std::cout << '\n';
+        if (expected_distance == 0) {
+            expected_distance = distance;
+        } else if (distance != expected_distance) {
+            std::cerr << "ERROR: Searches of the relabelled graph found a different distance!\n";
+        }
+    };
+    measure("File order:            ", graph, 0);
+    for (auto [label, ordering] : {std::make_pair("Breadth-first order:   ", vertex_ordering::breadth_first),
+        std::make_pair("Reverse Cuthill-McKee: ", vertex_ordering::reverse_cuthill_mckee)}) {
+        indexed_graph<double> reordered;
+        double relabel_ns = time_nanoseconds([&]() {
+            compute_vertex_order(graph, ordering, order);
+            reordered = reorder_graph(graph, order, old_to_new);
+        });
+        measure(label, reordered, relabel_ns);
+    }
+    std::cout << '\n';
+}
+
+
+// ==================================================== ARC-FLAG BENCHMARK ==================================================================
+
+/**
+ * Compares point-to-point Dijkstra searches over a grid against searches following only the edges flagged for the region of
+ * the destination, along with the time taken to partition the grid and flag its edges on every hardware thread
+ */
+static void benchmark_arc_flags() {
+    const unsigned int side = 128;
+    const unsigned int vertex_count = side * side;
+    const unsigned int query_count = 500;
+    auto graph = indexed_graph<double>(vertex_count);
+    for (unsigned int cell = 0; cell < vertex_count; cell++) {
+        graph.add_vertex("R" + std::to_string(cell / side) + " C" + std::to_string(cell % side));
+    }
+    for (unsigned int cell = 0; cell < vertex_count; cell++) {
+        double weight = static_cast<double>((cell * 7) % 13 + 1);
+        if (cell % side + 1 < side) {
+            graph.add_edge(cell, cell + 1, weight);
+            graph.add_edge(cell + 1, cell, weight);
+        }
+        if (cell + side < vertex_count) {
+            graph.add_edge(cell, cell + side, weight + 3);
+            graph.add_edge(cell + side, cell, weight + 3);
+        }
+    }
+    unsigned int thread_count = std::max(1U, std::thread::hardware_concurrency());
+    auto arc_flags = arc_flag_table<double>();
+    double build_ns = time_nanoseconds([&]() { arc_flags.build(graph, arc_flag_table<double>::default_region_count, thread_count); });
+
+    std::pmr::unsynchronized_pool_resource query_pool;
+    std::pmr::vector<double> distances(&query_pool);
+    std::pmr::vector<unsigned int> vertex_path(&query_pool);
+    double dijkstra_checksum = 0;
+    double flag_checksum = 0;
+    unsigned long dijkstra_settled = 0;
+    unsigned long flag_settled = 0;
+    auto query_pair = [vertex_count](unsigned int q) {
+        return std::make_pair((q * 7919) % vertex_count, (q * 104729 + 13) % vertex_count);
+    };
+    double dijkstra_ns = time_nanoseconds([&]() {
+        for (unsigned int q = 0; q < query_count; q++) {
+            auto [source, destination] = query_pair(q);
+            auto result = forward_search(graph, source, destination, distances, vertex_path);
+            dijkstra_checksum += result.distance;
+            dijkstra_settled += result.settled_count;
+        }
+    });
+    double flag_ns = time_nanoseconds([&]() {
+        for (unsigned int q = 0; q < query_count; q++) {
+            auto [source, destination] = query_pair(q);
+            auto result = arc_flag_search(graph, source, destination, arc_flags, distances, vertex_path);
+            flag_checksum += result.distance;
+            flag_settled += result.settled_count;
+        }
+    });
+
+    std::cout << "==================================== ARC-FLAGS ====================================\n";
+    std::cout << "Verticies: " << vertex_count << " (grid of " << side << " x " << side << "), queries: " << query_count << '\n';
+    std::cout << "Flag build:      " << build_ns / 1e6 << " ms on " << thread_count << " threads (" << arc_flags.get_region_count()
+              << " regions, " << arc_flags.get_boundary_count() << " boundary verticies, " << arc_flags.get_flag_bytes() << " bytes)\n";
+    std::cout << "Dijkstra search: " << dijkstra_ns / query_count / 1e3 << " us/query (" << dijkstra_settled / query_count << " settled)\n";
+    std::cout << "Arc-flag search: " << flag_ns / query_count / 1e3 << " us/query (" << flag_settled / query_count << " settled)\n";
+    if (dijkstra_checksum != flag_checksum) {
+        std::cerr << "ERROR: Arc-flag searches returned different distances!\n";
+    }
+    std::cout << '\n';
+}
+
+
+// ==================================================== QUERY SCRATCH BENCHMARK ==================================================================
+
+/**
+ * Compares back-to-back short Dijkstra queries over a large grid that fill fresh distance and predecessor arrays for every
+ * query against queries reusing a single `query_scratch`, whose arrays are reset by a new generation instead
+ */
+static void benchmark_query_scratch() {
+    const unsigned int side = 512;
+    const unsigned int vertex_count = side * side;
+    const unsigned int query_count = 2000;
+    auto graph = indexed_graph<double>(vertex_count);
+    for (unsigned int cell = 0; cell < vertex_count; cell++) {
+        graph.add_vertex("R" + std::to_string(cell / side) + " C" + std::to_string(cell % side));
+    }
+    for (unsigned int cell = 0; cell < vertex_count; cell++) {
+        double weight = static_cast<double>((cell * 7) % 13 + 1);
+        if (cell % side + 1 < side) {
+            graph.add_edge(cell, cell + 1, weight);
+            graph.add_edge(cell + 1, cell, weight);
+        }
+        if (cell + side < vertex_count) {
+            graph.add_edge(cell, cell + side, weight + 3);
+            graph.add_edge(cell + side, cell, weight + 3);
+        }
+    }
+    // Each destination lies a few rows and columns away from its source, as for queries within a neighborhood of a road network
+    auto query_pair = [](unsigned int q) {
+        unsigned int row = (q * 7919) % (side - 8);
+        unsigned int column = (q * 104729) % (side - 8);
+        return std::make_pair(row * side + column, (row + q % 8) * side + column + 7 - q % 8);
+    };
+
+    std::pmr::unsynchronized_pool_resource query_pool;
+    std::pmr::vector<double> distances(&query_pool);
+    std::pmr::vector<unsigned int> vertex_path(&query_pool);
+    auto scratch = query_scratch<double>();
+    double array_checksum = 0;
+    double scratch_checksum = 0;
+    unsigned long settled_total = 0;
+    double array_ns = time_nanoseconds([&]() {
+        for (unsigned int q = 0; q < query_count; q++) {
+            auto [source, destination] = query_pair(q);
+            auto result = forward_search(graph, source, destination, distances, vertex_path);
+            array_checksum += result.distance;
+            settled_total += result.settled_count;
+        }
+    });
+    double scratch_ns = time_nanoseconds([&]() {
+        for (unsigned int q = 0; q < query_count; q++) {
+            auto [source, destination] = query_pair(q);
+            scratch_checksum += forward_search(graph, source, destination, scratch).distance;
+        }
+    });
+
+    std::cout << "================================== QUERY SCRATCH ==================================\n";
+    std::cout << "Verticies: " << vertex_count << " (grid of " << side << " x " << side << "), queries: " << query_count
+              << " (" << settled_total / query_count << " settled/query)\n";
+    std::cout << "Fresh arrays:    " << array_ns / query_count / 1e3 << " us/query\n";
+    std::cout << "Reused scratch:  " << scratch_ns / query_count / 1e3 << " us/query\n";
+    if (array_checksum != scratch_checksum) {
+        std::cerr << "ERROR: Searches over reused scratch returned different distances!\n";
+    }
+    std::cout << '\n';
+}
+
+
+int main(void) {
+    benchmark_hashmap_dispatch();
+    benchmark_distance_queries();
+    benchmark_distance_matrix();
+    benchmark_single_source_trees();
+    benchmark_integer_queues();
+    benchmark_k_shortest_paths();
+    benchmark_edge_updates();
+    benchmark_dynamic_mst();
+    benchmark_components();
+    benchmark_vertex_order();
+    benchmark_arc_flags();
+    benchmark_query_scratch();
+    return 0;
+}
@@ -11,20 +11,6 @@
 #include "../includes/derived_hashmap.hpp"
 
 
-unsigned int apply_hash_function(const std::string& key) {
-    unsigned int hash = 0;
-    unsigned int index = 0;
-    int string_length = static_cast<int>(key.size());
-    // Produce integer sum from ascii character codes of string characters
-    for (int i = 0; i < string_length; i++) {
-        unsigned int c = static_cast<unsigned int>(key.data()[i]);
-        // Multiply by incrementing index to introduce further variation
-        hash += (index + 1) * c;
-        index++;
-    }
-    return hash;
-}
-
 bool is_prime( unsigned int capacity_val) {
     // base case for the prime values of 2 and 3
     if (capacity_val == 2 || capacity_val == 3) {
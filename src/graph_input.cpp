@@ -12,6 +12,10 @@
 #include <filesystem>
 #include <list>
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
 
 
 #include "../includes/graph_input.hpp"
@@ -158,6 +162,13 @@ int get_graph_filename(std::string& directory_name, std::string& user_file) {
     auto file_list = std::list<std::string>{};
     if (std::filesystem::exists(directory_name)) {
         for (const auto& sample_file : std::filesystem::directory_iterator(directory_name)){
+            // Landmark tables, hierarchies, arc-flags and all-pairs tables saved alongside graph files are not graph files themselves
+            if (sample_file.path().extension() == landmark_table<double>::file_extension ||
+                sample_file.path().extension() == contraction_hierarchy<double>::file_extension ||
+                sample_file.path().extension() == arc_flag_table<double>::file_extension ||
+                sample_file.path().extension() == all_pairs_table<double>::file_extension) {
+                continue;
+            }
             std::string file_name = sample_file.path().string();
             file_name.erase(file_name.begin(), file_name.begin() + static_cast<long int>(directory_name.size()));
             file_list.emplace_back(std::move(file_name));
@@ -200,6 +211,46 @@ int get_graph_filename(std::string& directory_name, std::string& user_file) {
 
 
 
+weight_type detect_weight_type(const std::string& read_name) {
+    std::ifstream read_file(read_name);
+    if (!read_file.is_open()) {
+        return weight_type::double_precision;
+    }
+    double total_weight = 0;        // Sum of all edge weights, which no path between two verticies can exceed
+    int fraction_bits = 0;          // Largest number of binary digits after the point needed by any edge weight
+    bool whole_weights = true;
+    bool binary_fractions = true;   // Whether every edge weight is whole after at most as many doublings as `float` has binary digits
+    std::string line;
+    while (getline(read_file, line)) {
+        size_t weight_comma = line.rfind(',');
+        if (weight_comma == line.npos) {
+            return weight_type::double_precision;
+        }
+        double weight = strtod(line.c_str() + weight_comma + 1, nullptr);
+        if (!(weight > 0) || weight == std::numeric_limits<double>::infinity()) {
+            return weight_type::double_precision;
+        }
+        total_weight += weight;
+        whole_weights = whole_weights && std::trunc(weight) == weight;
+        // Doubling a weight shifts its binary point, so the number of doublings until it is whole counts its binary digits after the point
+        int bits = 0;
+        for (double scaled = weight; std::trunc(scaled) != scaled && bits <= std::numeric_limits<float>::digits; scaled *= 2) {
+            bits++;
+        }
+        binary_fractions = binary_fractions && bits <= std::numeric_limits<float>::digits;
+        fraction_bits = std::max(fraction_bits, bits);
+    }
+    if (whole_weights && total_weight < static_cast<double>(unreachable_distance<std::uint32_t>())) {
+        return weight_type::unsigned_integer;
+    }
+    // Every distance is then a whole multiple of the smallest binary fraction below the largest whole number `float` holds exactly
+    if (binary_fractions && std::ldexp(total_weight, fraction_bits) < std::ldexp(1.0, std::numeric_limits<float>::digits)) {
+        return weight_type::single_precision;
+    }
+    return weight_type::double_precision;
+}
+
+
 int get_graph_vertex_count(long int& vertex_count, std::string& read_name) {
     // Handle user input for querying whether user wishes to provide number of unqiue verticies or have program estimate the number
     std::string response;
@@ -284,22 +335,59 @@ int get_graph_vertex_count(long int& vertex_count, std::string& read_name) {
 }
 
 
-int get_shortest_path(main_hashmap<double>&& main, const std::string& graph_filename, const std::string& path_filename) {
+/**
+ * Splits the user's entry for the source vertex, `entry`, into the names of several source verticies separated by commas
+ * @tparam Type typename of the edge weights of `main`
+ * @param entry User-provided source vertex entry
+ * @param main Graph within which every listed vertex must be found
+ * @return Names of the listed source verticies, with surrounding spaces removed (empty if fewer than two names are listed or any
+ * listed name is not a vertex within `main`)
+ */
+template <class Type>
+static std::vector<std::string> split_source_verticies(const std::string& entry, const indexed_graph<Type>& main) {
+    std::vector<std::string> source_verticies;
+    size_t start_pos = 0;
+    while (start_pos <= entry.size()) {
+        size_t comma_pos = std::min(entry.find(',', start_pos), entry.size());
+        size_t first_pos = entry.find_first_not_of(' ', start_pos);
+        size_t last_pos = entry.find_last_not_of(' ', comma_pos - 1);
+        if (first_pos >= comma_pos || last_pos == entry.npos || last_pos < first_pos) {
+            return {};
+        }
+        source_verticies.push_back(entry.substr(first_pos, last_pos - first_pos + 1));
+        if (!main.contains_vertex(source_verticies.back())) {
+            return {};
+        }
+        start_pos = comma_pos + 1;
+    }
+    if (source_verticies.size() < 2) {
+        return {};
+    }
+    return source_verticies;
+}
+
+
+template <class Type>
+int get_shortest_path(indexed_graph<Type>&& main, const std::string& graph_filename, const std::string& path_filename, const std::string& saved_path,
+    bool landmark_search) {
     // Provide User with All Possible Verticies Extracted From User-Provided Graph File
     std::cout << '\n';
-    std::cout << "Shortest Path Calculation Selected" << '\n';
+    std::cout << (landmark_search ? "Landmark (ALT) Shortest Path Calculation Selected" : "Shortest Path Calculation Selected") << '\n';
     std::cout << "If you wish to exit the program, enter \"exit now\" at any time" << '\n';
     std::cout << '\n';
     std::string source_vertex;
     // Generated sorted list of verticies
-    std::list<std::string> sorted_verts = main.get_keys();
+    std::list<std::string> sorted_verts = main.get_vertex_names();
     sorted_verts.sort();
     std::cout << "Your Verticies Include: " << sorted_verts << '\n';
     
     // Get User's Requested Source Vertex
+    std::cout << "To Find The Nearest Of Several Source Verticies To Every Vertex, Enter Their Names Separated By Commas" << '\n';
     std::cout << "Please Enter The Source Vertex: ";
     std::getline(std::cin >> std::ws, source_vertex);
-    while (!main.contains_key(source_vertex) && source_vertex.compare("exit now") != 0) {
+    std::vector<std::string> source_verticies;
+    while (!main.contains_vertex(source_vertex) && source_vertex.compare("exit now") != 0 &&
+        (source_verticies = split_source_verticies(source_vertex, main)).empty()) {
         std::cout << '\n' << "Error: Entered Source Vertex of '" << source_vertex << "' not found Within Generated Graph." << '\n';
         std::cout << "Please try again or enter 'exit now' to exit." << '\n';
         std::cout << "Your Verticies Include: " << sorted_verts << '\n';
@@ -311,13 +399,26 @@ int get_shortest_path(main_hashmap<double>&& main, const std::string& graph_file
         std::cout << "Exiting Program... Goodbye!" << std::endl;
         return 0;
     }
+    // Answer every vertex with the nearest of the listed source verticies, found by a single search seeded with all of them
+    if (!main.contains_vertex(source_vertex)) {
+        auto all_destinations = std::vector<std::string>(sorted_verts.begin(), sorted_verts.end());
+        int valid_paths = 0;
+        try {
+            valid_paths = find_nearest_sources(source_verticies, all_destinations, graph_filename, path_filename, std::move(main));
+        } catch (std::exception& e) {
+            std::cerr << e.what() << '\n';
+            return -1;
+        }
+        return valid_paths < 0 ? -1 : 0;
+    }
 
     // Get User's Requested Destination Vertex
     std::string dest_vertex;
     std::cout << '\n' << "Your Verticies Include: " << sorted_verts << '\n';
+    std::cout << "To List The Shortest Paths To Every Vertex, Enter \"all\"" << '\n';
     std::cout << "Please Enter The Destination Vertex: ";
     std::getline(std::cin >> std::ws, dest_vertex);
-    while (!main.contains_key(dest_vertex) && dest_vertex.compare("exit now") != 0) {
+    while (!main.contains_vertex(dest_vertex) && dest_vertex.compare("exit now") != 0 && dest_vertex.compare("all") != 0) {
         std::cout << '\n' << "Error: Entered Destination Vertex of '" << dest_vertex << "' not found Within Generated Graph. Please try again or enter 'exit now' to exit." << '\n';
         std::cout << "Your Verticies Include: " << sorted_verts << '\n';
         std::cout << "Please Enter The Destination Vertex: ";
@@ -329,10 +430,67 @@ int get_shortest_path(main_hashmap<double>&& main, const std::string& graph_file
         std::cout << "Exiting Program... Goodbye!" << std::endl;
         return 0;
     }
+    // Answer every destination with a single shortest path tree from the source vertex (unless a vertex is named "all")
+    if (dest_vertex.compare("all") == 0 && !main.contains_vertex(dest_vertex)) {
+        auto all_destinations = std::vector<std::string>(sorted_verts.begin(), sorted_verts.end());
+        int valid_paths = 0;
+        try {
+            valid_paths = find_shortest_paths(source_vertex, all_destinations, graph_filename, path_filename, std::move(main));
+        } catch (std::exception& e) {
+            std::cerr << e.what() << '\n';
+            return -1;
+        }
+        return valid_paths < 0 ? -1 : 0;
+    }
+    // A landmark (ALT) search was requested explicitly, so its tables are loaded or else built, whatever the size of the graph.
+    // Otherwise, graphs whose edges share a single weight need no precomputation, as a breadth-first search finds their shortest paths
+    // in linear time. Other small graphs are answered from a table of every shortest path (built faster than a contraction hierarchy),
+    // and larger graphs from a contraction hierarchy. Tables and hierarchies are saved next to the graph file, so that later queries on
+    // the same graph only load them
+    std::string hierarchy_filename = saved_path + contraction_hierarchy<Type>::file_extension;
+    std::string landmark_filename = saved_path + landmark_table<Type>::file_extension;
+    std::string all_pairs_filename = saved_path + all_pairs_table<Type>::file_extension;
+    auto all_pairs = all_pairs_table<Type>(main.get_memory_resource());
+    auto hierarchy = contraction_hierarchy<Type>(main.get_memory_resource());
+    auto landmarks = landmark_table<Type>(main.get_memory_resource());
+    search_mode mode = search_mode::hierarchy;
+    try {
+        if (landmark_search) {
+            if (landmarks.load(landmark_filename, main) < 0) {
+                std::cout << "Building landmark tables for '" << landmark_filename << "'..." << '\n';
+                landmarks.build(main);
+                if (landmarks.save(landmark_filename) < 0) {
+                    std::cerr << "Landmark tables could not be saved and will be rebuilt upon the next query" << '\n';
+                }
+            }
+            mode = search_mode::landmarks;
+        } else if (suits_breadth_first(main)) {
+            mode = search_mode::breadth_first;
+        } else if (main.get_vertex_count() <= all_pairs_table<Type>::max_vertex_count) {
+            if (all_pairs.load(all_pairs_filename, main) < 0) {
+                std::cout << "Building all-pairs table for '" << all_pairs_filename << "'..." << '\n';
+                all_pairs.build(main);
+                if (all_pairs.save(all_pairs_filename) < 0) {
+                    std::cerr << "All-pairs table could not be saved and will be rebuilt upon the next query" << '\n';
+                }
+            }
+            mode = search_mode::all_pairs;
+        } else if (hierarchy.load(hierarchy_filename, main) < 0) {
+            std::cout << "Building contraction hierarchy for '" << hierarchy_filename << "'..." << '\n';
+            hierarchy.build(main);
+            if (hierarchy.save(hierarchy_filename) < 0) {
+                std::cerr << "Contraction hierarchy could not be saved and will be rebuilt upon the next query" << '\n';
+            }
+        }
+    } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
+        mode = search_mode::bidirectional;
+    }
+
     // Generate Shortest Path from user-provided graph file
     int valid_path = 0;
     try {
-        valid_path = find_shortest_path(source_vertex, dest_vertex, graph_filename, path_filename, std::move(main));
+        valid_path = find_shortest_path<Type>(source_vertex, dest_vertex, graph_filename, path_filename, std::move(main), mode, &landmarks, &hierarchy, nullptr, &all_pairs);
     } catch (std::exception& e) {
         std::cerr << e.what() << '\n';
         return -1;
@@ -345,18 +503,82 @@ int get_shortest_path(main_hashmap<double>&& main, const std::string& graph_file
 }
 
 
-int get_requested_algorithm (std::string& algorithm_type, main_hashmap<double>&& main, const std::string& graph_filename, const std::string& path_filename, const std::string& MST_filename) {
+template <class Type>
+int get_k_shortest_paths(indexed_graph<Type>&& main, const std::string& graph_filename, const std::string& path_filename) {
+    std::cout << '\n';
+    std::cout << "K Shortest Paths Calculation Selected" << '\n';
+    std::cout << "If you wish to exit the program, enter \"exit now\" at any time" << '\n';
+    std::cout << '\n';
+    std::list<std::string> sorted_verts = main.get_vertex_names();
+    sorted_verts.sort();
+    std::cout << "Your Verticies Include: " << sorted_verts << '\n';
+
+    // Get User's Requested Source and Destination Verticies
+    std::string path_verticies[2];
+    const char* vertex_roles[2] = {"Source", "Destination"};
+    for (int v = 0; v < 2; v++) {
+        std::cout << "Please Enter The " << vertex_roles[v] << " Vertex: ";
+        std::getline(std::cin >> std::ws, path_verticies[v]);
+        while (!main.contains_vertex(path_verticies[v]) && path_verticies[v].compare("exit now") != 0) {
+            std::cout << '\n' << "Error: Entered " << vertex_roles[v] << " Vertex of '" << path_verticies[v] << "' not found Within Generated Graph." << '\n';
+            std::cout << "Please try again or enter 'exit now' to exit." << '\n';
+            std::cout << "Your Verticies Include: " << sorted_verts << '\n';
+            std::cout << "Please Enter The " << vertex_roles[v] << " Vertex: ";
+            std::getline(std::cin >> std::ws, path_verticies[v]);
+        }
+        if (path_verticies[v].compare("exit now") == 0) {
+            std::cout << "Exiting Program... Goodbye!" << std::endl;
+            return 0;
+        }
+    }
+
+    // Get User's Requested Number of Paths
+    std::string path_count_entry;
+    size_t path_count = 0;
+    std::cout << "Please Enter The Number of Shortest Paths To Find: ";
+    std::getline(std::cin >> std::ws, path_count_entry);
+    while (path_count_entry.compare("exit now") != 0 &&
+        (path_count_entry.find_first_not_of("0123456789") != path_count_entry.npos || path_count_entry.size() > 9 ||
+        (path_count = std::stoul(path_count_entry)) == 0)) {
+        std::cout << '\n' << "Error: '" << path_count_entry << "' is not a positive whole number. Please try again or enter 'exit now' to exit." << '\n';
+        std::cout << "Please Enter The Number of Shortest Paths To Find: ";
+        std::getline(std::cin >> std::ws, path_count_entry);
+    }
+    std::cout << '\n';
+    if (path_count_entry.compare("exit now") == 0) {
+        std::cout << "Exiting Program... Goodbye!" << std::endl;
+        return 0;
+    }
+
+    int valid_paths = 0;
+    try {
+        valid_paths = find_k_shortest_paths(path_verticies[0], path_verticies[1], path_count, graph_filename, path_filename, std::move(main));
+    } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return -1;
+    }
+    return valid_paths < 0 ? -1 : 0;
+}
+
+
+template <class Type>
+int get_requested_algorithm (std::string& algorithm_type, indexed_graph<Type>&& main, const std::string& graph_filename, const std::string& path_filename, const std::string& MST_filename,
+    const std::string& saved_path) {
     // Generate Requested Output based on User Request
     std::cout << "For Calculating the Minimum Spanning Tree, Enter \"M\"" << '\n';
     std::cout << "For Calculating the Shortest Path Between Two Verticies, Enter \"S\"" << '\n';
+    std::cout << "For Calculating the Shortest Path Between Two Verticies with Landmark (ALT) Search, Enter \"A\"" << '\n';
+    std::cout << "For Calculating the K Shortest Paths Between Two Verticies, Enter \"K\"" << '\n';
     std::cout << "To Exit the Program, Enter \"exit now\"" << '\n';
     std::cout << '\n' << "Please Enter Desired Graph Output: ";
 
     // Handle user input for type of requested calculation
     getline(std::cin >> std::ws, algorithm_type);
-    while (algorithm_type.compare("M") != 0 && algorithm_type.compare("S") != 0 && algorithm_type.compare("exit now") != 0) {
+    while (algorithm_type.compare("M") != 0 && algorithm_type.compare("S") != 0 && algorithm_type.compare("A") != 0 &&
+        algorithm_type.compare("K") != 0 &&
+        algorithm_type.compare("exit now") != 0) {
         std::cout << "Error: '" << algorithm_type << "' is not an accepted value. Please try again or enter 'exit now' to exit." << '\n';
-        std::cout << "Please Enter Desired Graph Output ('M' for Minimum Spanning Tree OR 'S' for Shortest Distance OR 'exit now' to exit): ";
+        std::cout << "Please Enter Desired Graph Output ('M' for Minimum Spanning Tree OR 'S' for Shortest Distance OR 'A' for Shortest Distance by Landmark Search OR 'K' for K Shortest Paths OR 'exit now' to exit): ";
         std::getline(std::cin >> std::ws, algorithm_type);
     }
     // User wishes to exit program
@@ -369,7 +591,7 @@ int get_requested_algorithm (std::string& algorithm_type, main_hashmap<double>&&
     if (algorithm_type.compare("M") == 0) {
         std::cout << '\n';
         std::cout << "Minimum Spanning Tree Calculations Selected" << '\n';
-        std::string start_vertex = main.get_keys().front();
+        std::string start_vertex = std::string(main.get_vertex_name(0));
         int valid_tree = 0;
         try {
             valid_tree = find_MST(start_vertex, graph_filename, MST_filename, std::move(main));
@@ -382,11 +604,11 @@ int get_requested_algorithm (std::string& algorithm_type, main_hashmap<double>&&
         }
     }
 
-    // User wishes to have shortest path calculated using provided graph
-    if (algorithm_type.compare("S") == 0) {
+    // User wishes to have shortest path calculated using provided graph (by an A* search over landmark tables if "A" was entered)
+    if (algorithm_type.compare("S") == 0 || algorithm_type.compare("A") == 0) {
         int path_output = 0;
         try {
-            path_output = get_shortest_path(std::move(main), graph_filename, path_filename);
+            path_output = get_shortest_path(std::move(main), graph_filename, path_filename, saved_path, algorithm_type.compare("A") == 0);
         } catch (std::exception& e) {
             std::cerr << e.what() << '\n';
         }
@@ -395,5 +617,34 @@ int get_requested_algorithm (std::string& algorithm_type, main_hashmap<double>&&
             return -1;
         }
     }
+
+    // User wishes to have several alternative shortest paths calculated using provided graph
+    if (algorithm_type.compare("K") == 0) {
+        int paths_output = 0;
+        try {
+            paths_output = get_k_shortest_paths(std::move(main), graph_filename, path_filename);
+        } catch (std::exception& e) {
+            std::cerr << e.what() << '\n';
+        }
+
+        if (paths_output < 0) {
+            return -1;
+        }
+    }
     return 0;
-}
\ No newline at end of file
+}
+
+
+// Explicit instantiations for every weight type chosen by `detect_weight_type`
+template int get_shortest_path<double>(indexed_graph<double>&&, const std::string&, const std::string&, const std::string&, bool);
+template int get_shortest_path<float>(indexed_graph<float>&&, const std::string&, const std::string&, const std::string&, bool);
+template int get_shortest_path<std::uint32_t>(indexed_graph<std::uint32_t>&&, const std::string&, const std::string&, const std::string&, bool);
+template int get_k_shortest_paths<double>(indexed_graph<double>&&, const std::string&, const std::string&);
+template int get_k_shortest_paths<float>(indexed_graph<float>&&, const std::string&, const std::string&);
+template int get_k_shortest_paths<std::uint32_t>(indexed_graph<std::uint32_t>&&, const std::string&, const std::string&);
+template int get_requested_algorithm<double>(std::string&, indexed_graph<double>&&, const std::string&, const std::string&, const std::string&,
+    const std::string&);
+template int get_requested_algorithm<float>(std::string&, indexed_graph<float>&&, const std::string&, const std::string&, const std::string&,
+    const std::string&);
+template int get_requested_algorithm<std::uint32_t>(std::string&, indexed_graph<std::uint32_t>&&, const std::string&, const std::string&, const std::string&,
+    const std::string&);
@@ -8,6 +8,7 @@
 #include <cstdio>
 #include <fstream>
 #include <filesystem>
+#include <cstdint>
 #include <cstdlib>
 // sys/wait.h is only compatible Linux OS
 #ifdef __linux__
@@ -15,12 +16,85 @@
 #endif
 
 #include <memory>
+#include <memory_resource>
 
 #include "../includes/graph_input.hpp"
 #include "../includes/pair_minheap.hpp"
 #include "../includes/derived_hashmap.hpp"
+#include "../includes/indexed_graph.hpp"
 #include "../includes/graph_processing.hpp"
 #include "../includes/graph_writing.hpp"
+#include "../includes/vertex_order.hpp"
+
+
+/**
+ * Builds the graph held within `rel_path` with edge weights of type `Type` and answers the calculation requested by the user
+ * @tparam Type typename of the edge weights and distances of the graph (see `detect_weight_type`)
+ * @param rel_path Relative path to the text file selected by the user
+ * @param read_name Name of the text file selected by the user
+ * @param vertex_count Approximate number of unique verticies within the graph
+ * @param graph_filename Relative path to the file receiving the dot language format of the complete graph
+ * @param path_filename Relative path to the file receiving the dot language format of the shortest path
+ * @param MST_filename Relative path to the file receiving the dot language format of the MST
+ * @param algorithm_type Filled with the type of calculation requested by the user
+ * @return `EXIT_SUCCESS` if successful, else the value to be returned by the program
+ */
+template <class Type>
+static int process_graph(const std::string& rel_path, const std::string& read_name, long int vertex_count, const std::string& graph_filename,
+    const std::string& path_filename, const std::string& MST_filename, std::string& algorithm_type) {
+    // Build main_hashmap data struct to store a relevant graphical information extracted from user-provided graph file
+    // Write relevant extracted information in dot language format to designated .gv file for building graph visualization
+    // All graph storage is placed within a single arena (released at once upon exit instead of being freed one allocation at a time)
+    std::pmr::monotonic_buffer_resource graph_arena;
+    std::pmr::monotonic_buffer_resource reordered_arena;    // Arena of the relabelled graph, which replaces the graph read from the file if it is large
+    auto main = std::make_unique<indexed_graph<Type>>(static_cast<unsigned int>(vertex_count), &graph_arena);
+    std::cout << "Building graph from '" << read_name << "' file contents..." << '\n';
+    std::cout << "Writing graph information to file '" << graph_filename << "' for image processing..." << '\n';
+    
+    int output = 0;
+    unsigned int file_vertex_count = static_cast<unsigned int>(vertex_count);
+    try {
+        output = build_adjacency_list(rel_path, graph_filename, file_vertex_count, std::move(*main));
+    } catch(std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return -1;
+    }
+
+    if (output < 0) {
+        return EXIT_FAILURE;
+    }
+
+    // Verticies are numbered in the order their names appear within the file, so large graphs are relabelled to place neighboring verticies
+    // within nearby entries of every array indexed by vertex ID (names carry over to the new IDs, so requests are answered alike)
+    if (main -> get_vertex_count() >= vertex_reorder_threshold) {
+        std::pmr::vector<unsigned int> order(&reordered_arena);
+        std::pmr::vector<unsigned int> old_to_new(&reordered_arena);
+        compute_vertex_order(*main, vertex_ordering::reverse_cuthill_mckee, order);
+#ifndef NDEBUG
+        double file_span = mean_edge_span(*main);
+#endif
+        main = std::make_unique<indexed_graph<Type>>(reorder_graph(*main, order, old_to_new, &reordered_arena));
+        graph_arena.release();
+#ifndef NDEBUG
+        gprintf("Relabelled %u verticies in reverse Cuthill-McKee order, reducing the mean ID distance between neighbors from %.1lf to %.1lf",
+            main -> get_vertex_count(), file_span, mean_edge_span(*main));
+#endif
+    }
+
+    // Handle User Input for Preferred Calculation to Apply using Extracted Information
+    std::cout << "Graph Successfully Built!" << '\n' << '\n';
+    int request_output = 0;
+    try {
+        request_output = get_requested_algorithm (algorithm_type, std::move(*main), graph_filename, path_filename, MST_filename, rel_path);
+    } catch (std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return -1;
+    }
+    if (request_output < 0) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
 
 
 int main(void) {
@@ -63,45 +137,34 @@ int main(void) {
         return EXIT_SUCCESS;
     }
     
-    // Build main_hashmap data struct to store a relevant graphical information extracted from user-provided graph file
-    // Write relevant extracted information in dot language format to designated .gv file for building graph visualization
-    auto main = std::make_unique<main_hashmap<double>>(static_cast<unsigned int>(vertex_count)); 
-    std::cout << "Building graph from '" << read_name << "' file contents..." << '\n';
-    std::cout << "Writing graph information to file '" << graph_filename << "' for image processing..." << '\n';
-    
-    int output = 0;
-    unsigned int file_vertex_count = static_cast<unsigned int>(vertex_count);
-    try {
-        output = build_adjacency_list(rel_path, graph_filename, file_vertex_count, std::move(*main));
-    } catch(std::exception& e) {
-        std::cerr << e.what() << std::endl;
-        return -1;
-    }
-
-    if (output < 0) {
-        return EXIT_FAILURE;
-    }
-
-    // Handle User Input for Preferred Calculation to Apply using Extracted Information
-    std::cout << "Graph Successfully Built!" << '\n' << '\n';
+    // Store edge weights and distances in the narrowest type holding the length of every path of the graph exactly
     std::string algorithm_type;
-    int request_output = 0;
-    try {
-        request_output = get_requested_algorithm (algorithm_type, std::move(*main), graph_filename, path_filename, MST_filename);
-    } catch (std::exception& e) {
-        std::cerr << e.what() << std::endl;
-        return -1;
+    int process_output = EXIT_SUCCESS;
+    switch (detect_weight_type(rel_path)) {
+        case weight_type::unsigned_integer:
+            gprintf("Storing edge weights as 32-bit unsigned integers");
+            process_output = process_graph<std::uint32_t>(rel_path, read_name, vertex_count, graph_filename, path_filename, MST_filename, algorithm_type);
+            break;
+        case weight_type::single_precision:
+            gprintf("Storing edge weights as single-precision floating point values");
+            process_output = process_graph<float>(rel_path, read_name, vertex_count, graph_filename, path_filename, MST_filename, algorithm_type);
+            break;
+        default:
+            process_output = process_graph<double>(rel_path, read_name, vertex_count, graph_filename, path_filename, MST_filename, algorithm_type);
+            break;
     }
-    if (request_output < 0) {
-        return EXIT_FAILURE;
+    if (process_output != EXIT_SUCCESS) {
+        return process_output;
     }
 // Initialize Path Variables that will be Employed Based on Detected Platform's OS
+    // K shortest paths are written to the same overlay file as a single shortest path, so both are visualized alike
+    bool path_requested = algorithm_type.compare("S") == 0 || algorithm_type.compare("A") == 0 || algorithm_type.compare("K") == 0;
     std::string script_path = "";
     std::string request_type = "";
     std::string destination_file = "";
     std::string command_val = "";
     // Set Universal Printed Output and Graph Image Locations based on type of Information Requested By User
-    if (algorithm_type.compare("S") == 0) {
+    if (path_requested) {
         request_type = "SHORTEST PATH";
         destination_file = "../../graph_images/shortest_path_overlay.png";
     } else {
@@ -114,7 +177,7 @@ int main(void) {
 #ifdef __linux__
     // Preset Script Path and Graph Image Locations based on User Requested Information for Linux Users
     command_val = "/bin/bash";
-    if (algorithm_type.compare("S") == 0) {
+    if (path_requested) {
         script_path = "../../scripts/Linux/visualize_graph_SP.sh";
     } else {
         script_path = "../../scripts/Linux/visualize_graph_MST.sh";
@@ -137,7 +200,7 @@ int main(void) {
     // std::string dot_path = "./Graphviz/bin/dot.exe";
 
     // Preset Script Path and Graph Image Locations based on User Requested Information for MacOS Users
-    if (algorithm_type.compare("S") == 0) {
+    if (path_requested) {
         // Set Output Image File Path Designated for Shortest Path and Specify Output Format to Graphviz's Dot using Appropriate .gv files for Input
         script_path = "chmod +x ";
         script_path..append(dot_path).append(" -Tpng:cairo ").append(graph_filename).append(" -o ").append(graph_path);
@@ -175,7 +238,7 @@ int main(void) {
 #ifdef _WIN32
     // If Preprocessor Conditional Detects Windows OS, Directly Execute Multiple Powershell Commands to Graphviz's Dot Executable through A Pipeline
     command_val = "powershell -Command \"";
-    if (algorithm_type.compare("S") == 0) {
+    if (path_requested) {
         // Set Output Image File Path Designated for Shortest Path and Specify Output Format to Graphviz's Dot using Appropriate .gv files for Input
         script_path = graphviz_path;
         script_path.append("dot -Tpng:cairo ").append(graph_filename).append(" -o ").append(graph_path);
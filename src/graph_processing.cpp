@@ -9,6 +9,7 @@
 #include <tuple>
 #include <string>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <cstdio>
 #include <fstream>
@@ -16,9 +17,18 @@
 #include <cstdlib>
 #include <utility>
 #include <memory>
+#include <memory_resource>
 
 #include "../includes/pair_minheap.hpp"
 #include "../includes/derived_hashmap.hpp"
+#include "../includes/indexed_graph.hpp"
+#include "../includes/path_search.hpp"
+#include "../includes/query_scratch.hpp"
+#include "../includes/landmarks.hpp"
+#include "../includes/contraction_hierarchy.hpp"
+#include "../includes/all_pairs.hpp"
+#include "../includes/k_shortest_paths.hpp"
+#include "../includes/arc_flags.hpp"
 #include "../includes/graph_input.hpp"
 #include "../includes/gprintf.hpp"
 #include "../includes/graph_writing.hpp"
@@ -41,12 +51,59 @@ static void print_shortest_path(const std::vector<std::string>& path_list) {
     return;
 }
 
+#ifndef NDEBUG
+/**
+ * Local function for printing the current distance from the source vertex to each vertex in the same format used for
+ * printing `soa_hashmap` objects to standard error (debug configuration only)
+ * @param adj_list Graph whose vertex names are printed
+ * @param distances Array of distances indexed by vertex ID
+ */
+template <class Type>
+static void print_vertex_distances(const indexed_graph<Type>& adj_list, const std::pmr::vector<Type>& distances) {
+    std::cerr << "{ ";
+    for (unsigned int id = 0; id < distances.size(); id++) {
+        std::cerr << adj_list.get_vertex_name(id) << " : " << distances[id];
+        if (id + 1 != distances.size()) {
+            std::cerr << ", ";
+        }
+    }
+    std::cerr << " }" << '\n';
+}
+
 
+/**
+ * Local function for printing the last vertex visited in the shortest path to each reached vertex in the same format used for
+ * printing `soa_hashmap` objects to standard error (debug configuration only)
+ * @param adj_list Graph whose vertex names are printed
+ * @param vertex_path Array of previous vertex IDs indexed by vertex ID (`name_arena::invalid_id` for verticies not yet reached)
+ */
+template <class Type>
+static void print_vertex_predecessors(const indexed_graph<Type>& adj_list, const std::pmr::vector<unsigned int>& vertex_path) {
+    std::cerr << "{ ";
+    bool first_entry = true;
+    for (unsigned int id = 0; id < vertex_path.size(); id++) {
+        if (vertex_path[id] == name_arena::invalid_id) {
+            continue;
+        }
+        if (!first_entry) {
+            std::cerr << ", ";
+        }
+        std::cerr << adj_list.get_vertex_name(id) << " : " << adj_list.get_vertex_name(vertex_path[id]);
+        first_entry = false;
+    }
+    std::cerr << " }" << '\n';
+}
+#endif
+
+
+template <class Type>
 int build_adjacency_list(const std::string &filename,
                          const std::string &write_name,
                          unsigned int vertex_count,
-                         main_hashmap<double> &&adj_list)
+                         indexed_graph<Type> &&adj_list)
 {
+    // Storage for `vertex_count` verticies has already been reserved upon construction of `adj_list`
+    static_cast<void>(vertex_count);
     std::fstream read_file;
     // Open write.gv file with name of `write_file`, creating it if it doesn't exist or replacing its contents if it does
     std::fstream write_file{write_name, write_file.trunc | write_file.out};
@@ -188,14 +245,10 @@ int build_adjacency_list(const std::string &filename,
             std::string vertex1_name = underscore_spaces(vertex);
             std::string vertex2_name = underscore_spaces(vertex_2);
             /*
-            If main hashmap does not contain any hashmaps associated with `vertex` key, add this new hashmap (now containing its first edge)
-            with its associated key, `vertex`, to main hashmap
+            If graph does not contain a vertex named `vertex`, store its name (once) within the graph's name arena, assigning it the next vertex ID
             */
-            if (!adj_list.contains_key(vertex)) {
-                auto hash_tab1 = std::make_unique<soa_hashmap<double>>(
-                    static_cast<unsigned int>(vertex_count));
-                hash_tab1->add(vertex_2, weight);
-                adj_list.add(vertex, std::move(*hash_tab1));
+            if (!adj_list.contains_vertex(vertex)) {
+                adj_list.add_vertex(vertex);
 
                 // Write new vertex in dot language format to `write_name` file
                 int write_vertex = write_vertex_node(write_file, vertex1_name);
@@ -205,28 +258,12 @@ int build_adjacency_list(const std::string &filename,
                               << "' to file '" << write_name << "' !" << '\n';
                     return -1;
                 }
-            } else {
-                /*
-                If hashmap associated with `vertex` key already exists in main hashmap but does not yet contain edge
-                with `vertex_2` key, add edge with `vertex_2` to hashmap associated with `vertex` key
-                */
-                try {
-                    if (!adj_list.get_hash_key(vertex).contains_key(vertex_2)) {
-                        adj_list.get_hash_key(vertex).add(vertex_2, weight);
-                    }
-                } catch (std::exception &e) {
-                    std::cerr << e.what() << '\n';
-                }
             }
             /*
-            If main hashmap does not contain any hashmaps associated with `vertex_2` key, add this new hashmap (now containing its first edge)
-            with its associated key, `vertex_2`, to main hashmap
+            If graph does not contain a vertex named `vertex_2`, store its name (once) within the graph's name arena, assigning it the next vertex ID
             */
-            if (!adj_list.contains_key(vertex_2)) {
-                auto hash_tab2 = std::make_unique<soa_hashmap<double>>(
-                    static_cast<unsigned int>(vertex_count));
-                hash_tab2->add(vertex, weight);
-                adj_list.add(vertex_2, std::move(*hash_tab2));
+            if (!adj_list.contains_vertex(vertex_2)) {
+                adj_list.add_vertex(vertex_2);
                 // Write new vertex in dot language format to `write_name` file
                 int write_vertex2 = write_vertex_node(write_file, vertex2_name);
                 if (write_vertex2 < 0) {
@@ -235,19 +272,17 @@ int build_adjacency_list(const std::string &filename,
                               << "' to file '" << write_name << "' !" << '\n';
                     return -1;
                 }
-
-            } else {
-                /*
-                If hashmap associated with `vertex_2` key already exists in main hashmap but does not yet contain edge
-                with `vertex` key, add edge with `vertex` to hashmap associated with `vertex_2` key
-                */
-                try {
-                    if (!adj_list.get_hash_key(vertex_2).contains_key(vertex)) {
-                        adj_list.get_hash_key(vertex_2).add(vertex, weight);
-                    }
-                } catch (std::exception &e) {
-                    std::cerr << e.what() << '\n';
-                }
+            }
+            /*
+            Add the undirected edge in both directions by vertex ID (an existing edge between the same verticies keeps its original weight)
+            */
+            try {
+                unsigned int vertex_id = adj_list.get_vertex_id(vertex);
+                unsigned int vertex2_id = adj_list.get_vertex_id(vertex_2);
+                adj_list.add_edge(vertex_id, vertex2_id, static_cast<Type>(weight));
+                adj_list.add_edge(vertex2_id, vertex_id, static_cast<Type>(weight));
+            } catch (std::exception &e) {
+                std::cerr << e.what() << '\n';
             }
             // Write new edge in dot language format to `write_name` file
             int write_new_edge = write_edge(write_file,
@@ -274,7 +309,9 @@ int build_adjacency_list(const std::string &filename,
 }
 
 
-int find_shortest_path(const std::string& s_vertex, const std::string& des_vertex, const std::string& graph_filename, const std::string& path_filename, main_hashmap<double>&& adj_list) {
+template <class Type>
+int find_shortest_path(const std::string& s_vertex, const std::string& des_vertex, const std::string& graph_filename, const std::string& path_filename, indexed_graph<Type>&& adj_list, search_mode mode, const landmark_table<Type>* landmarks,
+    const contraction_hierarchy<Type>* hierarchy, path_tree_cache<Type>* tree_cache, const all_pairs_table<Type>* all_pairs, const arc_flag_table<Type>* arc_flags) {
 #ifdef NDEBUG
 #else
     std::cerr << "ENTIRE LIST OF ALL GRAPH VERTICIES AND THEIR CORRESPONDING ADJACENT VERTICIES:" << '\n';
@@ -290,178 +327,372 @@ int find_shortest_path(const std::string& s_vertex, const std::string& des_verte
         std::cerr << "\nTOTAL COST/DISTANCE: " << 0 << '\n';
         return 0;
     }
+    // Translate source and destination vertex names into the vertex IDs used by all data structures below
+    unsigned int source_id = 0;
+    unsigned int destination_id = 0;
+    try {
+        source_id = adj_list.get_vertex_id(s_vertex);
+        destination_id = adj_list.get_vertex_id(des_vertex);
+    } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return -1;
+    }
+    // Verticies in separate components (joined while the graph was built) are never connected, so no search is needed
+    if (!adj_list.same_component(source_id, destination_id)) {
+        std::cerr << "ERROR: No path exists between '" << s_vertex << "' and '" << des_vertex << "'!" << '\n';
+        std::cerr << "Please ensure your submitted graph file is a connected graph(a path exists between all nodes)!" << '\n';
+        return -1;
+    }
     // Initialize data structures for more efficient processing of graph information using Djkstra's Algorithm
-    auto vertex_list = adj_list.get_keys();    // List of all verticies within graph
-    auto vertex_count = static_cast<unsigned int>(vertex_list.size());      // User Provided number of unique verticies within graph
-    auto visited_vertices = soa_hashmap<double>(vertex_count);      // Hashmap holding key:value pairs corresponding current minimum distance from source vertex to specified vertex key
-    auto  mhp = std::make_unique<paired_min_heap<double>>(vertex_count);    // Customized Binary Minimum Heap for holding Minimum Distances
-    auto vertex_path = soa_hashmap<std::string>(vertex_count / 2);      // Hashmap of key:value pairs corresponding to last vertex visited in shortest path to each vertex key
+    auto vertex_count = adj_list.get_vertex_count();      // Number of unique verticies within graph
+    const path_tree<Type>* cached_tree = nullptr;     // Shortest path tree of the source vertex, if answered by `tree_cache`
+    // Dijkstra searches of each thread keep their arrays and heaps between queries, so a query only writes the verticies it reaches
+    static thread_local query_scratch<Type> forward_scratch;
+    static thread_local query_scratch<Type> backward_scratch;
+    const query_scratch<Type>* searched_scratch = nullptr;     // Arrays filled by the search, if answered by `forward_scratch`
+    // Searches over precomputed structures fill an entry for every vertex, within arrays each thread keeps between queries
+    static thread_local std::pmr::vector<Type> visited_vertices;      // Current minimum distance from source vertex to each vertex, indexed by vertex ID (sized by the search)
+    static thread_local std::pmr::vector<unsigned int> vertex_path;      // ID of last vertex visited in shortest path to each vertex, indexed by vertex ID (sized by the search)
+
+    // Search from the source vertex (and from the destination vertex if bidirectional) until the shortest path to the destination vertex is established
+    path_search_result<Type> search_result{};
+    try {
+        if (tree_cache != nullptr) {
+            unsigned long previous_misses = tree_cache -> get_miss_count();
+            cached_tree = &tree_cache -> get_tree(adj_list, source_id);
+            search_result.distance = cached_tree -> get_distance(destination_id);
+            search_result.settled_count = tree_cache -> get_miss_count() != previous_misses ? cached_tree -> get_settled_count() : 0;
+        } else if (mode == search_mode::all_pairs) {
+            if (all_pairs == nullptr || all_pairs -> get_vertex_count() != vertex_count) {
+                std::cerr << "ERROR: All-pairs search requires an all-pairs table built from the current graph!" << '\n';
+                return -1;
+            }
+            search_result = all_pairs_search(*all_pairs, source_id, destination_id, visited_vertices, vertex_path);
+        } else if (mode == search_mode::hierarchy) {
+            if (hierarchy == nullptr || hierarchy -> get_vertex_count() != vertex_count) {
+                std::cerr << "ERROR: Hierarchy search requires a contraction hierarchy built from the current graph!" << '\n';
+                return -1;
+            }
+            search_result = hierarchy_search(*hierarchy, source_id, destination_id, visited_vertices, vertex_path);
+        } else if (mode == search_mode::landmarks) {
+            if (landmarks == nullptr || landmarks -> get_vertex_count() != vertex_count) {
+                std::cerr << "ERROR: Landmark search requires landmark tables built from the current graph!" << '\n';
+                return -1;
+            }
+            search_result = landmark_search(adj_list, source_id, destination_id, *landmarks, visited_vertices, vertex_path);
+        } else if (mode == search_mode::arc_flags) {
+            if (arc_flags == nullptr || arc_flags -> get_vertex_count() != vertex_count) {
+                std::cerr << "ERROR: Arc-flag search requires arc-flags built from the current graph!" << '\n';
+                return -1;
+            }
+            search_result = arc_flag_search(adj_list, source_id, destination_id, *arc_flags, visited_vertices, vertex_path);
+        } else if (mode == search_mode::breadth_first) {
+            if (!suits_breadth_first(adj_list)) {
+                std::cerr << "ERROR: Breadth-first search requires a graph whose edges all share the same weight!" << '\n';
+                return -1;
+            }
+            search_result = breadth_first_search(adj_list, source_id, destination_id, visited_vertices, vertex_path);
+        } else if (mode == search_mode::bidirectional) {
+            search_result = bidirectional_search(adj_list, source_id, destination_id, forward_scratch, backward_scratch);
+            searched_scratch = &forward_scratch;
+        } else {
+            search_result = forward_search(adj_list, source_id, destination_id, forward_scratch);
+            searched_scratch = &forward_scratch;
+        }
+    } catch (std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return -1;
+    }
+    gprintf("Search settled %u of %u verticies", search_result.settled_count, vertex_count);
+    // Trace the path through the cached tree if one was used, else through the scratch or arrays filled by the search
+    const std::pmr::vector<Type>& distances = cached_tree != nullptr ? cached_tree -> get_distances() : visited_vertices;
+    const std::pmr::vector<unsigned int>& predecessors = cached_tree != nullptr ? cached_tree -> get_predecessors() : vertex_path;
+    auto predecessor_of = [&](unsigned int vertex) {
+        return searched_scratch != nullptr ? searched_scratch -> get_predecessor(vertex) : predecessors[vertex];
+    };
+    Type path_distance = searched_scratch != nullptr ? searched_scratch -> get_distance(destination_id) : distances[destination_id];
+
+    // If search has completed and destination vertex has not been reached, no path exists between user-provided source and destination vertex
+    if (path_distance == unreachable_distance<Type>()) {
+        std::cerr << "ERROR: No path exists between '" << s_vertex << "' and '" << des_vertex << "'!" << '\n';
+        std::cerr << "Please ensure your submitted graph file is a connected graph(a path exists between all nodes)!" << '\n';
+        return -1;
+    }
+    gprintf("LIST OF SHORTEST DISTANCES FROM %s to EACH LABELED VERTEX", s_vertex.c_str());
+#ifdef NDEBUG
+#else
+    // Only debug builds list every vertex, for which the verticies reached through the scratch are copied into full arrays
+    if (searched_scratch != nullptr) {
+        searched_scratch -> copy_to(visited_vertices, vertex_path);
+    }
+    print_vertex_distances(adj_list, distances);
+#endif
+    gprintf("LIST OF LAST VERTEX TO VISIT EACH LABELED VERTEX");
+#ifdef NDEBUG
+#else
+    print_vertex_predecessors(adj_list, predecessors);
+#endif
 
+    // Else, at least one path exists between source and destination vertex, with shortest path value being found
+    std::cerr << "============================= SHORTEST PATH RESULTS ====================================\n";
+    std::cerr << "The Shortest Path from " << s_vertex << " TO " << des_vertex << " : " << '\n';
+    // The starting capacity must be prime, as quadratic probing of any other capacity can cycle without reaching an empty bucket
+    std::unique_ptr<soa_hashmap<Type>> path_map = std::make_unique<soa_hashmap<Type>>(17);     // Hashmap holding directed edges as keys and their corresponding weight values (grown with the path)
+    // Trace backward from destination vertex, visiting each subsequent last vertex visited until source vertex is reached
+    unsigned int new_vertex = destination_id;
+    unsigned int prev_vertex = predecessor_of(destination_id);
+    auto shortest_path = std::vector<std::string>{};
+    try {
+        // Fill separate hashmap with edge directionality between verticies in shortest path for shortest path visualization
+        std::string edge_name = "";
+        edge_name.append(underscore_spaces(std::string(adj_list.get_vertex_name(prev_vertex))));
+        edge_name.append(" -> ");
+        edge_name.append(underscore_spaces(des_vertex));
+        path_map -> add(edge_name, adj_list.get_edge_weight(new_vertex, prev_vertex));
+
+        shortest_path.emplace( shortest_path.begin(), des_vertex);
+        // When trace backward to source vertex is complete, all verticies traveled from source to destination in order will be held in shortest_path
+        while (prev_vertex != source_id) {
+            new_vertex = prev_vertex;
+            shortest_path.emplace(shortest_path.begin(), adj_list.get_vertex_name(prev_vertex));
+            prev_vertex = predecessor_of(new_vertex);
+            // Add new directed edge in shortest path to hashmap for holding all directed edges for subsequent writing of shortest path image
+            std::string next_edge = "";
+            next_edge.append(underscore_spaces(std::string(adj_list.get_vertex_name(prev_vertex))));
+            next_edge.append(" -> ");
+            next_edge.append(underscore_spaces(shortest_path.front()));
+            path_map -> add(next_edge, adj_list.get_edge_weight(new_vertex, prev_vertex));
+        }
+    } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return -1;
+    }
+    shortest_path.emplace(shortest_path.begin(), s_vertex);
 
-    // Prefill visited verticies hashmap key-value pairs of each vertex with a floating infinity distance value
-    for (const auto& vertex : vertex_list) {
-        visited_vertices.add(vertex, std::numeric_limits<double>::infinity());
+    // Print simplified shortest path and its total cost/length to terminal output for user
+    print_shortest_path(shortest_path);
+    std::cerr << '\n' << "TOTAL COST / DISTANCE: " << path_distance << "\n\n";
+    // Pass hashmap containing directed edges of shortest path to function for writing graph file for visualizing shortest path overlaying entire graph
+    int path_output  = 0;
+    try {
+        path_output = write_shortest_path_overlay(graph_filename, path_filename, shortest_path, std::move(*path_map));
+    } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return -1;
     }
 
-    // Set source vertex's distance to 0
-    visited_vertices.add(s_vertex, 0.0);
-    // Add source vertex to minimum heap
-    mhp -> add_node(s_vertex, 0.0);
-    std::string popped_vertex;
-    double popped_vertex_distance = 0;
-    double min_distance_edge = 0;
+    if (path_output < 0) {
+        std::cerr << "ERROR: An error was encountered while overlaying the full graph with the shortest path" << '\n';
+        return -1;
+    }
+    return 0;
+}
 
-    // Initiate while loop until all verticies have been visited (minheap will be empty)
-    while (!mhp -> is_empty()) {
-        // Remove next vertex with smallest distance from minimum heap
-        try {
-            std::tie(popped_vertex, popped_vertex_distance) = mhp -> remove_min();
-        } catch (std::exception& e) {
-            std::cerr << e.what() << std::endl;
-            return -1;
-        }
-        // Retrieve current distance from source vertex to extracted vertex held in visited verticies
+
+template <class Type>
+int find_shortest_paths(const std::string& s_vertex, const std::vector<std::string>& des_vertices, const std::string& graph_filename,
+    const std::string& path_filename, indexed_graph<Type>&& adj_list) {
+    unsigned int source_id = 0;
+    try {
+        source_id = adj_list.get_vertex_id(s_vertex);
+    } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return -1;
+    }
+    // Settle every vertex reachable from the source vertex once (relaxing each bucket of distances in parallel), then extract each requested path from the completed tree
+    std::pmr::unsynchronized_pool_resource query_pool;
+    auto tree = path_tree<Type>(&query_pool);
+    tree.build_parallel(adj_list, source_id);
+    gprintf("Shortest path tree from %s settled %u of %u verticies", s_vertex.c_str(), tree.get_settled_count(), adj_list.get_vertex_count());
+
+    std::pmr::vector<unsigned int> path_ids(&query_pool);
+    auto shortest_path = std::vector<std::string>{};
+    auto tree_verticies = std::vector<std::string>{s_vertex};     // Every vertex on a printed path, starting with the source vertex
+    std::unique_ptr<soa_hashmap<Type>> path_map = std::make_unique<soa_hashmap<Type>>(adj_list.get_vertex_count(), &query_pool);     // Directed edges of all printed paths
+    std::cerr << "============================= SHORTEST PATH RESULTS ====================================\n";
+    for (const auto& des_vertex : des_vertices) {
+        unsigned int destination_id = 0;
         try {
-            min_distance_edge = visited_vertices.get_val(popped_vertex);
+            destination_id = adj_list.get_vertex_id(des_vertex);
         } catch (std::exception& e) {
             std::cerr << e.what() << '\n';
             return -1;
         }
-        // If distance value of extracted value is greater than stored value, extract next vertex from minheap
-        if (popped_vertex_distance > min_distance_edge) {
+        if (!tree.extract_path(destination_id, path_ids)) {
+            std::cerr << "ERROR: No path exists between '" << s_vertex << "' and '" << des_vertex << "'!" << '\n' << '\n';
             continue;
         }
-        // If extracted vertex is destination vertex, shortest path has been found to destination vertex
-        if (popped_vertex.compare(des_vertex) == 0) {
-            break;
-        }
-
-        double weight = 0;
-        double di = 0;
-        // Iterate through list of all verticies present in graph to identify and access edge weights for each adjacent vertex
-        for (auto& vertex : vertex_list) {
-            // If vertex is found in list of verticies adjacent to extracted vertex, retrieve its weight
-            if (adj_list.get_hash_key(popped_vertex).contains_key(vertex)) {
-                gprintf("VISITING VERTEX OF %s with ADJACENT VERTEX %s", popped_vertex.c_str(), vertex.c_str());
-                try {
-                    weight = adj_list.get_hash_key(popped_vertex).get_val(vertex);
-                } catch (std::exception& e) {
-                    std::cerr << e.what() << '\n';
-                    return -1;
-                }
-                /**
-                 * Check if sum of current distance and edge formed with adjacent vertex is less than current distance associated with vertex in shortest distance list
-                 *      distance = distance from source to extracted vertex
-                 *      weight = distance between extracted vertex and adjacent vertex
-                 *      di = total distance from source vertex to adjacent vertex
-                 */
-                di = weight + popped_vertex_distance;
-                try {
-                    // If new edge creates a shorter path to adjacent vertex, update distance associated with adjacent vertex to shortest distance list
-                    if (di < visited_vertices.get_val(vertex)) {
-                        // If new edge to be updated is the destination vertex, determine whether to update the vertices forming shortest path
-                        if (des_vertex.compare(vertex) == 0) {
-                            gprintf("CURRENT VERTEX: ");
-#ifdef NDEBUG
-#else
-                            std::cerr << visited_vertices << '\n';
-#endif
-                            gprintf("UPDATING MINIMUM DISTANCE/PATH FROM SOURCE VERTEX TO DESTINATION VERTEX");
-                            gprintf("Current vertex is %s", popped_vertex.c_str());
-                            gprintf("Weight of edge between %s and %s is %.2lf", popped_vertex.c_str(), vertex.c_str(), weight);
-                            gprintf("Current Distance from Source (%s) is %.2lf", s_vertex.c_str(), popped_vertex_distance);
-                            gprintf("Previous minimum distance to destination vertex is %.2lf", visited_vertices.get_val(des_vertex));
-                            gprintf("Updated minimum distance from to destination vertex is %.2lf\n", di);
-                        }
-                        visited_vertices.add(vertex, di);
-                        vertex_path.add(vertex, popped_vertex);
-                        mhp -> add_node(vertex, di);
-                    }
-                } catch (std::exception& e) {
-                    std::cerr << e.what() << '\n';
-                    return -1;
-                }
+        shortest_path.clear();
+        for (size_t i = 0; i < path_ids.size(); i++) {
+            shortest_path.emplace_back(adj_list.get_vertex_name(path_ids[i]));
+            if (i == 0) {
+                continue;
+            }
+            // Paths sharing a prefix share its edges, so each tree edge is only added once
+            std::string edge_name = underscore_spaces(std::string(adj_list.get_vertex_name(path_ids[i - 1])));
+            edge_name.append(" -> ").append(underscore_spaces(shortest_path.back()));
+            if (!path_map -> contains_key(edge_name)) {
+                path_map -> add(edge_name, adj_list.get_edge_weight(path_ids[i], path_ids[i - 1]));
+                tree_verticies.push_back(shortest_path.back());
             }
         }
+        std::cerr << "The Shortest Path from " << s_vertex << " TO " << des_vertex << " : " << '\n';
+        // A path from the source vertex to itself is printed in the same form as by `find_shortest_path`
+        if (path_ids.size() == 1) {
+            std::cerr << s_vertex << " -> " << des_vertex << '\n';
+        } else {
+            print_shortest_path(shortest_path);
+        }
+        std::cerr << '\n' << "TOTAL COST / DISTANCE: " << tree.get_distance(destination_id) << "\n\n";
     }
-
-    // If loop is exited and destination vertex has not been visited, no path exists between user-provided source and destination vertex
+    // The last entry only names the destination within the title of the overlay image
+    tree_verticies.emplace_back("ALL VERTICIES");
+    int path_output = 0;
     try {
-        if (visited_vertices.get_val(des_vertex) == std::numeric_limits<double>::infinity()) {
-            std::cerr << "ERROR: No path exists between '" << s_vertex << "' and '" << des_vertex << "'!" << '\n';
-            std::cerr << "Please ensure your submitted graph file is a connected graph(a path exists between all nodes)!" << '\n';
-            return -1;
-        }
-        gprintf("LIST OF SHORTEST DISTANCES FROM %s to EACH LABELED VERTEX", s_vertex.c_str());
-#ifdef NDEBUG
-#else
-        std::cerr << visited_vertices << '\n';
-#endif
-        gprintf("LIST OF LAST VERTEX TO VISIT EACH LABELED VERTEX");
-#ifdef NDEBUG
-#else
-        std::cerr << vertex_path << '\n';
-#endif
-
+        path_output = write_shortest_path_overlay(graph_filename, path_filename, tree_verticies, std::move(*path_map));
     } catch (std::exception& e) {
         std::cerr << e.what() << '\n';
         return -1;
     }
-    // Else, at least one path exists between source and destination vertex, with shortest path value being found
-    std::cerr << "============================= SHORTEST PATH RESULTS ====================================\n";
-    std::cerr << "The Shortest Path from " << s_vertex << " TO " << des_vertex << " : " << '\n';
-    std::unique_ptr<soa_hashmap<double>> path_map = std::make_unique<soa_hashmap<double>>(static_cast<unsigned int>(vertex_count / 2));     // Hashmap holding directed edges as keys and their corresponding weight values
-    // Trace backward from destination vertex, visiting each subsequent last vertex visited until source vertex is reached
-    std::string new_vertex = des_vertex;
-    std::string prev_vertex;
+    if (path_output < 0) {
+        std::cerr << "ERROR: An error was encountered while overlaying the full graph with the shortest path tree" << '\n';
+        return -1;
+    }
+    return 0;
+}
+
+
+template <class Type>
+int find_nearest_sources(const std::vector<std::string>& s_vertices, const std::vector<std::string>& des_vertices, const std::string& graph_filename,
+    const std::string& path_filename, indexed_graph<Type>&& adj_list) {
+    std::pmr::unsynchronized_pool_resource query_pool;
+    std::pmr::vector<unsigned int> source_ids(&query_pool);
     try {
-        prev_vertex = vertex_path.get_val(des_vertex);
+        for (const auto& s_vertex : s_vertices) {
+            source_ids.push_back(adj_list.get_vertex_id(s_vertex));
+        }
     } catch (std::exception& e) {
         std::cerr << e.what() << '\n';
         return -1;
     }
-    // Fill separate hashmap with edge directionality between verticies in shortest path for shortest path visualization
-    std::string edge_name = "";
-    edge_name.append(underscore_spaces(prev_vertex));
-    edge_name.append(" -> ");
-    edge_name.append(underscore_spaces(new_vertex));
-    path_map -> add(edge_name, std::move(adj_list.get_val(new_vertex, prev_vertex)));
+    // Settle every vertex reachable from any source vertex once, by a single search seeded with all source verticies at distance 0
+    auto forest = nearest_source_forest<Type>(&query_pool);
+    forest.build(adj_list, source_ids);
+    gprintf("Nearest source search from %zu verticies settled %u of %u verticies", s_vertices.size(), forest.get_settled_count(), adj_list.get_vertex_count());
 
+    std::pmr::vector<unsigned int> path_ids(&query_pool);
     auto shortest_path = std::vector<std::string>{};
-    shortest_path.emplace( shortest_path.begin(), des_vertex);
-    // When trace backward to source vertex is complete, all verticies traveled from source to destination in order will be held in shortest_path
-    while (prev_vertex.compare(s_vertex) != 0) {
-        new_vertex = prev_vertex;
-        shortest_path.emplace(shortest_path.begin(), prev_vertex);
+    // The first entry only names the sources within the title of the overlay image, followed by every vertex on a printed path
+    auto forest_verticies = std::vector<std::string>{"NEAREST SOURCE"};
+    forest_verticies.insert(forest_verticies.end(), s_vertices.begin(), s_vertices.end());
+    std::unique_ptr<soa_hashmap<Type>> path_map = std::make_unique<soa_hashmap<Type>>(adj_list.get_vertex_count(), &query_pool);     // Directed edges of all printed paths
+    std::cerr << "============================= NEAREST SOURCE RESULTS ===================================\n";
+    for (const auto& des_vertex : des_vertices) {
+        unsigned int destination_id = 0;
         try {
-            prev_vertex = vertex_path.get_val(shortest_path.front());
+            destination_id = adj_list.get_vertex_id(des_vertex);
         } catch (std::exception& e) {
             std::cerr << e.what() << '\n';
             return -1;
         }
-        // Add new directed edge in shortest path to hashmap for holding all directed edges for subsequent writing of shortest path image
-        std::string next_edge = "";
-        next_edge.append(underscore_spaces(prev_vertex));
-        next_edge.append(" -> ");
-        next_edge.append(underscore_spaces(new_vertex));
-        path_map -> add(next_edge, std::move(adj_list.get_val(new_vertex, prev_vertex)));
+        if (!forest.extract_path(destination_id, path_ids)) {
+            std::cerr << "ERROR: No path exists between any source vertex and '" << des_vertex << "'!" << '\n' << '\n';
+            continue;
+        }
+        shortest_path.clear();
+        for (size_t i = 0; i < path_ids.size(); i++) {
+            shortest_path.emplace_back(adj_list.get_vertex_name(path_ids[i]));
+            if (i == 0) {
+                continue;
+            }
+            // Paths sharing a prefix share its edges, so each forest edge is only added once
+            std::string edge_name = underscore_spaces(std::string(adj_list.get_vertex_name(path_ids[i - 1])));
+            edge_name.append(" -> ").append(underscore_spaces(shortest_path.back()));
+            if (!path_map -> contains_key(edge_name)) {
+                path_map -> add(edge_name, adj_list.get_edge_weight(path_ids[i], path_ids[i - 1]));
+                forest_verticies.push_back(shortest_path.back());
+            }
+        }
+        std::cerr << "The Nearest Source to " << des_vertex << " : " << shortest_path.front() << '\n';
+        // A source vertex is its own nearest source, printed in the same form as by `find_shortest_path`
+        if (path_ids.size() == 1) {
+            std::cerr << des_vertex << " -> " << des_vertex << '\n';
+        } else {
+            print_shortest_path(shortest_path);
+        }
+        std::cerr << '\n' << "TOTAL COST / DISTANCE: " << forest.get_distance(destination_id) << "\n\n";
     }
-    shortest_path.emplace(shortest_path.begin(), s_vertex);
+    forest_verticies.emplace_back("ALL VERTICIES");
+    int path_output = 0;
+    try {
+        path_output = write_shortest_path_overlay(graph_filename, path_filename, forest_verticies, std::move(*path_map));
+    } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return -1;
+    }
+    if (path_output < 0) {
+        std::cerr << "ERROR: An error was encountered while overlaying the full graph with the nearest source paths" << '\n';
+        return -1;
+    }
+    return 0;
+}
 
-    // Print simplified shortest path and its total cost/length to terminal output for user
-    print_shortest_path(shortest_path);
-    std::cerr << '\n' << "TOTAL COST / DISTANCE: " << visited_vertices.get_val(des_vertex) << "\n\n";
-    // Pass hashmap containing directed edges of shortest path to function for writing graph file for visualizing shortest path overlaying entire graph
-    int path_output  = 0;
+
+template <class Type>
+int find_k_shortest_paths(const std::string& s_vertex, const std::string& des_vertex, size_t k, const std::string& graph_filename,
+    const std::string& path_filename, indexed_graph<Type>&& adj_list) {
+    unsigned int source_id = 0;
+    unsigned int destination_id = 0;
     try {
-        path_output = write_shortest_path_overlay(graph_filename, path_filename, shortest_path, std::move(*path_map));
+        source_id = adj_list.get_vertex_id(s_vertex);
+        destination_id = adj_list.get_vertex_id(des_vertex);
     } catch (std::exception& e) {
         std::cerr << e.what() << '\n';
         return -1;
     }
+    if (!adj_list.same_component(source_id, destination_id)) {
+        std::cerr << "ERROR: No path exists between '" << s_vertex << "' and '" << des_vertex << "'!" << '\n';
+        return -1;
+    }
+    // Spur searches of each accepted path run in parallel, directed by a single shortest path tree rooted at the destination vertex
+    std::pmr::unsynchronized_pool_resource query_pool;
+    auto paths = k_shortest_paths<Type>(&query_pool);
+    size_t path_count = paths.build(adj_list, source_id, destination_id, k);
+    gprintf("Found %zu of %zu paths with %lu spur searches (%lu spur paths reused from the reverse tree, %lu verticies settled)", path_count, k,
+        paths.get_spur_search_count(), paths.get_reused_count(), paths.get_settled_count());
+    if (path_count == 0) {
+        std::cerr << "ERROR: No path exists between '" << s_vertex << "' and '" << des_vertex << "'!" << '\n';
+        return -1;
+    }
 
+    auto ranked_paths = std::vector<std::vector<std::string>>{};
+    std::cerr << "============================= K SHORTEST PATHS RESULTS =================================\n";
+    for (size_t rank = 0; rank < path_count; rank++) {
+        const auto& path = paths.get_path(rank);
+        ranked_paths.emplace_back();
+        for (unsigned int vertex : path.verticies) {
+            ranked_paths.back().emplace_back(adj_list.get_vertex_name(vertex));
+        }
+        std::cerr << "Shortest Path #" << rank + 1 << " from " << s_vertex << " TO " << des_vertex << " : " << '\n';
+        if (path.verticies.size() == 1) {
+            std::cerr << s_vertex << " -> " << des_vertex << '\n';
+        } else {
+            print_shortest_path(ranked_paths.back());
+        }
+        std::cerr << '\n' << "TOTAL COST / DISTANCE: " << path.distance << "\n\n";
+    }
+    if (path_count < k) {
+        std::cerr << "Only " << path_count << " loopless paths exist between '" << s_vertex << "' and '" << des_vertex << "'" << "\n\n";
+    }
+    int path_output = 0;
+    try {
+        path_output = write_ranked_paths_overlay(graph_filename, path_filename, ranked_paths);
+    } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return -1;
+    }
     if (path_output < 0) {
-        std::cerr << "ERROR: An error was encountered while overlaying the full graph with the shortest path" << '\n';
+        std::cerr << "ERROR: An error was encountered while overlaying the full graph with the shortest paths" << '\n';
         return -1;
     }
     return 0;
@@ -469,25 +700,41 @@ int find_shortest_path(const std::string& s_vertex, const std::string& des_verte
 
 
 
-int find_MST(std::string& source_vertex, const std::string& graph_filename, const std::string& MST_filename, main_hashmap<double>&& adj_list) {
+template <class Type>
+int find_MST(std::string& source_vertex, const std::string& graph_filename, const std::string& MST_filename, indexed_graph<Type>&& adj_list) {
     // Initialize data structures for more efficient processing of graph information using Prim's Algorithm
     auto MST_edges = std::vector<std::pair<std::string, std::string>>{};    // Hashmap holding all edges comprising of MST and their corresponding weight values
-    auto MST_traversal = std::vector<std::string>{};    // Array to be filled with all verticies that have already been visited before in traversal of graph
-    double MST_sum = 0;     // Total accumulated cost/length of all edges that comprise MST
+    auto vertex_count = adj_list.get_vertex_count();        // Number of unique verticies found within entire graph
+    auto MST_traversal = std::vector<bool>(vertex_count, false);    // Array indicating (by vertex ID) whether each vertex has already been visited before in traversal of graph
+    unsigned int visited_count = 0;     // Number of verticies that have already been visited
+    Type MST_sum = 0;     // Total accumulated cost/length of all edges that comprise MST
 
-    auto vertex_list = adj_list.get_keys();        // List of all unique verticies found within entire graph
-    auto vertex_count = static_cast<unsigned int>(vertex_list.size());      // User-provided number of unique verticies in entire graph
-    std::unique_ptr<paired_min_heap<double>>  mhp = std::make_unique<paired_min_heap<double>>(vertex_count);    // Customized Binary Minimum Heap for holding Minimum Distances
+    unsigned int source_id = 0;
+    try {
+        source_id = adj_list.get_vertex_id(source_vertex);
+    } catch (std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return -1;
+    }
+    // Components were counted while the graph was built, so a disconnected graph is rejected before any traversal
+    if (adj_list.get_component_count() > 1) {
+        gprintf("Graph consists of %u separate components", adj_list.get_component_count());
+        std::cerr << "ERROR: Provided Graph is not a connected graph, so no valid Minimum Spanning tree exists!" << '\n';
+        std::cerr << "Please ensure the graph is connected (a path exists between all verticies) to generate a valid MST" << '\n';
+        return -1;
+    }
+    std::unique_ptr<paired_min_heap<Type, unsigned int>>  mhp = std::make_unique<paired_min_heap<Type, unsigned int>>(vertex_count);    // Customized Binary Minimum Heap for holding Minimum Distances of vertex IDs
 
     // Prefill traversal tracking structures with source vertex
-    MST_traversal.emplace_back(source_vertex);
-    mhp -> add_node(source_vertex, 0);
+    MST_traversal[source_id] = true;
+    visited_count++;
+    mhp -> add_node(source_id, 0);
 
-    std::string vertex;
-    double distance = 0;
-    std::string min_distance_edge;
+    unsigned int vertex = 0;
+    Type distance = 0;
+    unsigned int min_distance_edge = source_id;
     // Traversal continues until all verticies have been visited, at which point the MST will have been established
-    while (vertex_list.size() > MST_traversal.size()) {
+    while (vertex_count > visited_count) {
         // If user-provided graphical information represents an unconnected graph, no MST is possible and minimum heap will be emptied instead
         if (mhp -> is_empty()) {
             std::cerr << "ERROR: Provided Graph is not a connected graph, so no valid Minimum Spanning tree exists!" << '\n';
@@ -504,66 +751,48 @@ int find_MST(std::string& source_vertex, const std::string& graph_filename, cons
 
 #ifdef NDEBUG
 #else
-        gprintf("\nExtracted VERTEX is: %s with a DISTANCE of %.2lf", vertex.c_str(), distance);
+        gprintf("\nExtracted VERTEX is: %s with a DISTANCE of %.2lf", adj_list.get_vertex_name(vertex).data(), static_cast<double>(distance));
         gprintf("\nThe Minimum HEAP currently contains: ");
         std::cerr << *mhp << '\n';
-#endif \
+#endif
         // Find vertex that forms edge with the currently smallest cost/distance with extracted vertex
-        if (vertex.compare(source_vertex) == 0) {
-            min_distance_edge = source_vertex;
+        if (vertex == source_id) {
+            min_distance_edge = source_id;
         } else {
-            try {
-                min_distance_edge = adj_list.get_key_by_value(vertex, distance);
-            } catch (std::exception& e) {
-                std::cerr << e.what() << '\n';
+            // Select the first adjacent vertex (in order of insertion) whose edge with the extracted vertex has the extracted cost/distance
+            bool found_val = false;
+            for (const auto& adjacent_edge : adj_list.get_adjacent(vertex)) {
+                if (adjacent_edge.weight == distance) {
+                    min_distance_edge = adjacent_edge.target;
+                    found_val = true;
+                    break;
+                }
+            }
+            if (!found_val) {
+                std::cerr << "ERROR: The Existing Vertex '" << adj_list.get_vertex_name(vertex) << "' does not contain any edges with the entered value!" << '\n';
                 return -1;
             }
         }
 
-        bool is_visited = false;
-        // Determine whether extracted vertex has already been visited before
-        for ( size_t i = 0; i < MST_traversal.size(); i++) {
-            if (MST_traversal[i].compare(vertex) == 0) {
-                is_visited = true;
-                break;
-            }
-
-        }
         // If extracted vertex has not been visited before, register as visited, add the edge to MST
-        if (!is_visited) {
-            MST_traversal.emplace_back(vertex);
-            auto new_path = std::pair<std::string, std::string>(min_distance_edge, vertex);
+        if (!MST_traversal[vertex]) {
+            MST_traversal[vertex] = true;
+            visited_count++;
+            auto new_path = std::pair<std::string, std::string>(adj_list.get_vertex_name(min_distance_edge), adj_list.get_vertex_name(vertex));
             MST_edges.emplace_back(new_path);
             MST_sum += distance;
         }
 
-        // Gather list of all verticies adjacent to extracted vertex
-        std::list<std::string> adjacent_verticies = adj_list.get_hash_key(vertex).get_keys();
         gprintf("\nChecking list of verticies for those not visited yet");
-
         // Check for any adjacent verticies of extracted vertex that have not been visited yet
-        for (auto& next_vertex : adjacent_verticies) {
-            bool contains_adjacent = false;
-            for (size_t k = 0; k < MST_traversal.size(); k++) {
-                if (MST_traversal[k].compare(next_vertex) == 0) {
-                    contains_adjacent = true;
-                    break;
-                }
-            }
-            double weight;
+        for (const auto& adjacent_edge : adj_list.get_adjacent(vertex)) {
             /*
             * If any adjacent verticies of extracted vertex have not been visited yet, add them to minimum heap for subsequent traversal
             * and associate their edge weight with the extracted vertex in passing to minimum heap
             */
-            if(!contains_adjacent) {
-                try {
-                    weight = adj_list.get_hash_key(vertex).get_val(next_vertex);
-                } catch (std::exception& e) {
-                    std::cerr << e.what() << '\n';
-                    return -1;
-                }
-                mhp -> add_node(next_vertex, weight);
-                gprintf("\nAdding vertex %s to Minimum HEAP", next_vertex.c_str());
+            if (!MST_traversal[adjacent_edge.target]) {
+                mhp -> add_node(adjacent_edge.target, adjacent_edge.weight);
+                gprintf("\nAdding vertex %s to Minimum HEAP", adj_list.get_vertex_name(adjacent_edge.target).data());
 #ifdef NDEBUG
 #else
                 std::cerr << "HEAP is now: " << *mhp << '\n';
@@ -601,4 +830,24 @@ int find_MST(std::string& source_vertex, const std::string& graph_filename, cons
     }
 
     return 0;
-}
\ No newline at end of file
+}
+
+
+// Explicit instantiations for every weight type chosen by `detect_weight_type` (no other instantiation is compiled)
+#define INSTANTIATE_GRAPH_PROCESSING(Type) \
+    template int build_adjacency_list<Type>(const std::string&, const std::string&, unsigned int, indexed_graph<Type>&&); \
+    template int find_shortest_path<Type>(const std::string&, const std::string&, const std::string&, const std::string&, \
+        indexed_graph<Type>&&, search_mode, const landmark_table<Type>*, const contraction_hierarchy<Type>*, path_tree_cache<Type>*, \
+        const all_pairs_table<Type>*, const arc_flag_table<Type>*); \
+    template int find_shortest_paths<Type>(const std::string&, const std::vector<std::string>&, const std::string&, const std::string&, \
+        indexed_graph<Type>&&); \
+    template int find_nearest_sources<Type>(const std::vector<std::string>&, const std::vector<std::string>&, const std::string&, \
+        const std::string&, indexed_graph<Type>&&); \
+    template int find_k_shortest_paths<Type>(const std::string&, const std::string&, size_t, const std::string&, const std::string&, \
+        indexed_graph<Type>&&); \
+    template int find_MST<Type>(std::string&, const std::string&, const std::string&, indexed_graph<Type>&&);
+
+INSTANTIATE_GRAPH_PROCESSING(double)
+INSTANTIATE_GRAPH_PROCESSING(float)
+INSTANTIATE_GRAPH_PROCESSING(std::uint32_t)
+#undef INSTANTIATE_GRAPH_PROCESSING
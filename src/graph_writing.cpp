@@ -4,6 +4,7 @@
 #endif
 
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
@@ -12,6 +13,8 @@
 #include <string>
 #include <vector>
 #include <list>
+#include <map>
+#include <algorithm>
 
 #include "../includes/derived_hashmap.hpp"
 #include "../includes/graph_writing.hpp"
@@ -22,13 +25,15 @@
  * extracted from `path_list`
  * @param path_list Vector-type container holding all verticies within shortest path in order of traversal
  * @param line Line matching dot language format for holding the graph title information
+ * @param title_start Leading words of the title, followed by the first and last entries of `path_list`
  */
-static void write_path_title(std::vector<std::string> &path_list, std::string &line)
+static void write_path_title(const std::vector<std::string> &path_list, std::string &line,
+                             const std::string &title_start = "Shortest Path FROM ")
 {
     size_t start_title_pos = line.find("label=") + static_cast<size_t>(7);
     size_t end_title_pos = line.find('"', start_title_pos);
 
-    std::string path_title = "Shortest Path FROM "; // Graph title for overlayed image of shortest path
+    std::string path_title = title_start; // Graph title for overlayed image of shortest path
 
     path_title.append(path_list.front()).append(" TO ").append(path_list.back());
     size_t p = 0;
@@ -187,6 +192,78 @@ static void write_path_edge(size_t &first_space,
     return;
 }
 
+/**
+ * Modifies line containing edge information in dot language format, `line`, to distinguish edges found within any of several
+ * ranked paths, drawing one parallel line in the color of each path that uses the edge (see `ranked_path_colors`)
+ * @param first_space Index position within `line` at which the end of the first vertex name within edge depicted by `line` is located
+ * @param edge_ranks Ranks of the paths using each directed edge, keyed by the edge in dot language format
+ * @param line Line matching dot language format for holding a single edge's information and features
+ */
+static void write_ranked_path_edge(size_t &first_space,
+                                   const std::map<std::string, std::vector<size_t>> &edge_ranks,
+                                   std::string &line)
+{
+    // Colors of the paths of each rank, reused in order beyond the last color
+    static const std::vector<std::string> ranked_path_colors
+        = {"darkcyan", "crimson", "forestgreen", "darkorchid", "royalblue",
+           "darkorange3", "deeppink3", "saddlebrown", "olivedrab", "slateblue"};
+
+    // Update Actual Line used for Extracting Node Information To Directed Edge Format
+    line[line.find("--") + 1] = '>';
+    size_t second_space = line.find(" ", first_space);
+    size_t third_space = line.find('[', second_space);
+    std::string vertex1 = line.substr(0, first_space);
+    std::string vertex2 = line.substr(first_space + static_cast<size_t>(4),
+                                      third_space - static_cast<size_t>(5) - second_space);
+    std::string straight_edge = vertex1;
+    straight_edge.append(" -> ").append(vertex2);
+    std::string reverse_edge = vertex2;
+    reverse_edge.append(" -> ").append(vertex1);
+    auto straight_ranks = edge_ranks.find(straight_edge);
+    auto reverse_ranks = edge_ranks.find(reverse_edge);
+    bool straight_match = straight_ranks != edge_ranks.end();
+    bool reverse_match = reverse_ranks != edge_ranks.end();
+
+    // If line defines an edge that is not part of any path, remove arrow head feature and retain preset color
+    if (!straight_match && !reverse_match) {
+        line.insert(line.find('[') + 1, "arrowsize=0 ");
+        return;
+    }
+    std::vector<size_t> ranks;
+    if (straight_match) {
+        ranks = straight_ranks->second;
+    }
+    if (reverse_match) {
+        ranks.insert(ranks.end(), reverse_ranks->second.begin(), reverse_ranks->second.end());
+        std::sort(ranks.begin(), ranks.end());
+        // The edge points in the direction taken by the shortest path using it
+        if (!straight_match || reverse_ranks->second.front() < straight_ranks->second.front()) {
+            for (size_t m = 0; m < reverse_edge.size(); m++) {
+                line[m] = reverse_edge[m];
+            }
+        }
+    }
+    std::string color_label;
+    for (size_t rank : ranks) {
+        if (!color_label.empty()) {
+            color_label.append(":");
+        }
+        color_label.append(ranked_path_colors[rank % ranked_path_colors.size()]);
+    }
+    size_t start_color_pos = line.find(" color=") + static_cast<size_t>(8);
+    size_t end_color_pos = line.find('"', start_color_pos);
+    line.replace(start_color_pos, end_color_pos - start_color_pos, color_label);
+
+    size_t find_right_bracket = line.rfind(']');
+    std::string text_label = " fontcolor=\"darkmagenta\" ";
+    // Edges travelled in both directions by different paths are drawn with arrow heads at both ends
+    if (straight_match && reverse_match) {
+        text_label.append("dir=both ");
+    }
+    line.insert(find_right_bracket, text_label);
+    return;
+}
+
 /**
  * Modifies the line containing the graph title information in dot language format, `line`,
  * to identify the graph visualization as depicting the Minimum Spanning Tree
@@ -496,12 +573,13 @@ int write_edge(std::fstream &graph_file,
     return 0;
 }
 
+template <class Type>
 int write_shortest_path_overlay(const std::string &graph_filename,
                                 const std::string &path_filename,
                                 std::vector<std::string> &path_list,
-                                soa_hashmap<double> &&path_map)
+                                soa_hashmap<Type> &&path_map)
 {
-    std::list<std::string> path_edges = path_map.get_keys();
+    std::list<std::string> path_edges(path_map.get_keys().begin(), path_map.get_keys().end());
     // Create shortest_path_overlay .gv file if does not exist or remove contents if it does
     std::fstream write_file{path_filename, write_file.trunc | write_file.out};
     std::fstream read_file{graph_filename, read_file.in};
@@ -588,6 +666,82 @@ int write_shortest_path_overlay(const std::string &graph_filename,
     return 0;
 }
 
+int write_ranked_paths_overlay(const std::string &graph_filename,
+                               const std::string &path_filename,
+                               const std::vector<std::vector<std::string>> &ranked_paths)
+{
+    // Collect the ranks of the paths using each directed edge, and every vertex found within any path
+    std::map<std::string, std::vector<size_t>> edge_ranks;
+    std::vector<std::string> path_verticies;
+    for (size_t rank = 0; rank < ranked_paths.size(); rank++) {
+        const auto &path = ranked_paths[rank];
+        for (size_t i = 0; i < path.size(); i++) {
+            if (std::find(path_verticies.begin(), path_verticies.end(), path[i]) == path_verticies.end()) {
+                path_verticies.push_back(path[i]);
+            }
+            if (i == 0) {
+                continue;
+            }
+            std::string edge_name = underscore_spaces(path[i - 1]);
+            edge_name.append(" -> ").append(underscore_spaces(path[i]));
+            edge_ranks[edge_name].push_back(rank);
+        }
+    }
+    std::vector<std::string> title_verticies;
+    if (!ranked_paths.empty()) {
+        title_verticies = {ranked_paths.front().front(), ranked_paths.front().back()};
+    }
+    std::string title_start = std::to_string(ranked_paths.size()).append(" Shortest Paths FROM ");
+
+    // Create shortest_path_overlay .gv file if does not exist or remove contents if it does
+    std::fstream write_file{path_filename, write_file.trunc | write_file.out};
+    std::fstream read_file{graph_filename, read_file.in};
+    if (!read_file.is_open()) {
+        std::cerr << "\nFailed to open file '" << graph_filename << "' for reading!" << '\n';
+        return -1;
+    }
+    std::string line;
+    // Locate the leading 'g' of expected "graph" word in first line to edit for denoting a directed graph
+    getline(read_file, line);
+    size_t get_first_g = line.find('g');
+    if (get_first_g == line.npos) {
+        std::cerr << "\nERROR: expected at least once occurence in 'g' in first line of '" << graph_filename << "' file\n";
+        return -1;
+    }
+    line.insert(get_first_g, "di").append("\n");
+    write_file.write(line.c_str(), static_cast<long int>(line.size()));
+
+    while (getline(read_file, line)) {
+        size_t find_left_bracket = line.find('[');
+        size_t find_first_space = line.find(" ");
+        size_t find_right_bracket = line.find("]");
+        if (line.find('{') != line.npos && !title_verticies.empty()) {
+            write_path_title(title_verticies, line, title_start);
+        }
+        if (find_left_bracket != line.npos && line.find("--") != line.npos) {
+            write_ranked_path_edge(find_first_space, edge_ranks, line);
+        } else {
+            std::string node_slice = line.substr(0, find_first_space);
+            remove_underscores(node_slice);
+            if (std::find(path_verticies.begin(), path_verticies.end(), node_slice) != path_verticies.end()) {
+                write_path_node(line, find_right_bracket);
+            }
+        }
+        line.append("\n");
+        write_file.write(line.c_str(), static_cast<long int>(line.size()));
+    }
+    // Since file pointers will be out of sync due to insertions into write file, a failbit set at the end of the file is ignored
+    if (read_file.fail() && !read_file.eof()) {
+        std::cerr << "\nERROR: Failbit indicates an error occurred while reading\n";
+        return -1;
+    }
+    if (write_file.fail()) {
+        std::cerr << "\nERROR: Failbit indicates an error occurrred while writing!\n";
+        return -1;
+    }
+    return 0;
+}
+
 int write_MST_overlay(const std::string &graph_filename,
                       const std::string &MST_filename,
                       std::vector<std::pair<std::string, std::string>> &MST_edges)
@@ -703,4 +857,10 @@ int write_MST_overlay(const std::string &graph_filename,
         return EXIT_FAILURE;
     }
     return 0;
-}
\ No newline at end of file
+}
+
+
+// Explicit instantiations for every weight type chosen by `detect_weight_type`
+template int write_shortest_path_overlay<double>(const std::string&, const std::string&, std::vector<std::string>&, soa_hashmap<double>&&);
+template int write_shortest_path_overlay<float>(const std::string&, const std::string&, std::vector<std::string>&, soa_hashmap<float>&&);
+template int write_shortest_path_overlay<std::uint32_t>(const std::string&, const std::string&, std::vector<std::string>&, soa_hashmap<std::uint32_t>&&);
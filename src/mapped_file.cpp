@@ -0,0 +1,111 @@
+// Suppress non-critical compiler warnings if using Microsoft Visual Studio compiler
+#ifdef VS_PRESENT
+#pragma warning(disable : 4265 4625 4626 4688 4710 4711 4866 4820 5045 )
+#endif
+
+#include <fstream>
+#include <utility>
+// Memory mapping is only used on Linux OS, all other platforms read the file into a buffer
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "../includes/mapped_file.hpp"
+
+
+mapped_file::~mapped_file() {
+    close();
+}
+
+
+mapped_file::mapped_file(mapped_file&& old_file) noexcept: bytes{std::exchange(old_file.bytes, nullptr)},
+    byte_count{std::exchange(old_file.byte_count, 0)},
+    mapped{std::exchange(old_file.mapped, false)},
+    buffer{std::move(old_file.buffer)} {}
+
+
+mapped_file& mapped_file::operator=(mapped_file&& old_file) noexcept {
+    if (this != &old_file) {
+        close();
+        bytes = std::exchange(old_file.bytes, nullptr);
+        byte_count = std::exchange(old_file.byte_count, 0);
+        mapped = std::exchange(old_file.mapped, false);
+        buffer = std::move(old_file.buffer);
+    }
+    return *this;
+}
+
+
+int mapped_file::open(const std::string& filename) {
+    close();
+#ifdef __linux__
+    int descriptor = ::open(filename.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return -1;
+    }
+    struct stat file_status{};
+    if (fstat(descriptor, &file_status) < 0 || file_status.st_size <= 0) {
+        ::close(descriptor);
+        return -1;
+    }
+    auto mapped_size = static_cast<size_t>(file_status.st_size);
+    void* mapping = mmap(nullptr, mapped_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    // The mapping remains valid after its file descriptor is closed
+    ::close(descriptor);
+    if (mapping != MAP_FAILED) {
+        bytes = static_cast<const char*>(mapping);
+        byte_count = mapped_size;
+        mapped = true;
+        return 0;
+    }
+#endif
+    std::ifstream read_file(filename, std::ios::binary | std::ios::ate);
+    if (!read_file.is_open()) {
+        return -1;
+    }
+    std::streamsize file_size = read_file.tellg();
+    if (file_size <= 0) {
+        return -1;
+    }
+    read_file.seekg(0);
+    buffer = std::make_unique<char[]>(static_cast<size_t>(file_size));
+    read_file.read(buffer.get(), file_size);
+    if (!read_file.good()) {
+        buffer.reset();
+        return -1;
+    }
+    bytes = buffer.get();
+    byte_count = static_cast<size_t>(file_size);
+    return 0;
+}
+
+
+void mapped_file::close() {
+#ifdef __linux__
+    if (mapped) {
+        munmap(const_cast<char*>(bytes), byte_count);
+    }
+#endif
+    buffer.reset();
+    bytes = nullptr;
+    byte_count = 0;
+    mapped = false;
+}
+
+
+const char* mapped_file::data() const {
+    return bytes;
+}
+
+
+size_t mapped_file::size() const {
+    return byte_count;
+}
+
+
+bool mapped_file::is_mapped() const {
+    return mapped;
+}
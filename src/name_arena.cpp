@@ -0,0 +1,156 @@
+// Suppress non-critical compiler warnings if using Microsoft Visual Studio compiler
+#ifdef VS_PRESENT
+#pragma warning(disable : 4265 4625 4626 4688 4710 4711 4866 4820 5045 )
+#endif
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../includes/name_arena.hpp"
+#include "../includes/derived_hashmap.hpp"
+
+// Expected average length of a vertex name, used for sizing the first character block
+static constexpr size_t AVERAGE_NAME_LENGTH = 16;
+
+
+name_arena::name_arena(unsigned int c, std::pmr::memory_resource* resource): names{resource}, id_table{resource},
+    char_blocks{std::make_unique<std::pmr::monotonic_buffer_resource>(static_cast<size_t>(c < 5 ? 5 : c) * AVERAGE_NAME_LENGTH, resource)},
+    name_bytes(0) {
+    // Handle potentially negative values being entered in initialization
+    if (c < 5 || c == UINT32_MAX) {
+        c = 5;
+    }
+    names.reserve(c);
+    // Keep table load below 0.5 so quadratic probing is guaranteed to locate an empty position
+    id_table.assign(get_next_prime(c * 2), invalid_id);
+}
+
+
+name_arena::name_arena(name_arena&& old_arena) noexcept: names{std::move(old_arena.names)},
+    id_table{std::move(old_arena.id_table)},
+    char_blocks{std::move(old_arena.char_blocks)},
+    name_bytes{std::exchange(old_arena.name_bytes, 0)} {}
+
+
+name_arena& name_arena::operator=(name_arena&& old_arena) noexcept {
+    names = std::move(old_arena.names);
+    id_table = std::move(old_arena.id_table);
+    char_blocks = std::move(old_arena.char_blocks);
+    name_bytes = std::exchange(old_arena.name_bytes, 0);
+    old_arena.names.clear();
+    old_arena.id_table.clear();
+    return *this;
+}
+
+
+size_t name_arena::probe(std::string_view name) const {
+    size_t capacity = id_table.size();
+    size_t hash_index = apply_hash_function(name) % capacity;
+    // Apply quadratic probing to minimize chance of collisions
+    size_t j = 0;
+    size_t next_index = hash_index;
+    while (id_table[next_index] != invalid_id && names[id_table[next_index]] != name) {
+        j++;
+        next_index = (hash_index + (j * j)) % capacity;
+    }
+    return next_index;
+}
+
+
+void name_arena::resize_table(unsigned int new_capacity) {
+    if (!is_prime(new_capacity)) {
+        new_capacity = get_next_prime(new_capacity);
+    }
+    id_table.assign(new_capacity, invalid_id);
+    // Rehash the IDs of all interned names according to the increased capacity
+    for (unsigned int id = 0; id < static_cast<unsigned int>(names.size()); id++) {
+        id_table[probe(names[id])] = id;
+    }
+}
+
+
+unsigned int name_arena::intern(std::string_view name) {
+    // Rebuild storage of a moved-from `name_arena` before reuse
+    if (id_table.empty()) {
+        id_table.assign(get_next_prime(10), invalid_id);
+    }
+    if (!char_blocks) {
+        char_blocks = std::make_unique<std::pmr::monotonic_buffer_resource>(names.get_allocator().resource());
+    }
+
+    size_t table_index = probe(name);
+    if (id_table[table_index] != invalid_id) {
+        return id_table[table_index];
+    }
+    if (names.size() >= static_cast<size_t>(invalid_id) - 1) {
+        throw(std::runtime_error("ERROR: Cannot intern any further names, the maximum number of name IDs has been reached!"));
+    }
+
+    // Copy characters of `name` (followed by a null terminator) to the end of the current character block
+    auto stored_chars = static_cast<char*>(char_blocks->allocate(name.size() + 1, alignof(char)));
+    std::memcpy(stored_chars, name.data(), name.size());
+    stored_chars[name.size()] = '\0';
+    auto new_id = static_cast<unsigned int>(names.size());
+    names.emplace_back(stored_chars, name.size());
+    name_bytes += name.size() + 1;
+
+    // Check current table load and readjust storage capacity if necessary
+    if (names.size() * 2 >= id_table.size()) {
+        resize_table(static_cast<unsigned int>(id_table.size() * 2));
+    } else {
+        id_table[table_index] = new_id;
+    }
+    return new_id;
+}
+
+
+unsigned int name_arena::find_id(std::string_view name) const {
+    if (names.empty()) {
+        return invalid_id;
+    }
+    return id_table[probe(name)];
+}
+
+
+unsigned int name_arena::get_id(std::string_view name) const {
+    unsigned int id = find_id(name);
+    // Throw exception and notify user that no name matching `name` has been interned
+    if (id == invalid_id) {
+        std::string explain = "ERROR: The name '";
+        explain.append(name).append("' has not been stored within the calling name_arena object!");
+        throw(std::runtime_error(explain.c_str()));
+    }
+    return id;
+}
+
+
+bool name_arena::contains_name(std::string_view name) const {
+    return find_id(name) != invalid_id;
+}
+
+
+std::string_view name_arena::get_name(unsigned int id) const {
+    if (id >= names.size()) {
+        std::string explain = "ERROR: No name with an ID of '";
+        explain.append(std::to_string(id)).append("' exists within the calling name_arena object!");
+        throw(std::runtime_error(explain.c_str()));
+    }
+    return names[id];
+}
+
+
+unsigned int name_arena::get_size() const {
+    return static_cast<unsigned int>(names.size());
+}
+
+
+size_t name_arena::get_name_bytes() const {
+    return name_bytes;
+}
+
+
+std::pmr::memory_resource* name_arena::get_memory_resource() const {
+    return names.get_allocator().resource();
+}
@@ -1,10 +1,31 @@
 #include <gtest/gtest.h>
+#include <cstring>
+#include <fstream>
+#include <sstream>
 #include <stdexcept>
 #include <tuple>
+#include <memory_resource>
+#include <map>
 
 #include "../includes/pair_minheap.hpp"
+#include "../includes/indexed_graph.hpp"
+#include "../includes/path_search.hpp"
+#include "../includes/landmarks.hpp"
+#include "../includes/contraction_hierarchy.hpp"
+#include "../includes/hub_labels.hpp"
+#include "../includes/distance_matrix.hpp"
+#include "../includes/all_pairs.hpp"
+#include "../includes/integer_queues.hpp"
+#include "../includes/k_shortest_paths.hpp"
+#include "../includes/dynamic_mst.hpp"
+#include "../includes/spanning_forest.hpp"
+#include "../includes/vertex_order.hpp"
+#include "../includes/arc_flags.hpp"
+#include "../includes/query_scratch.hpp"
 #include "../src/gprintf.cpp"
 #include "../src/derived_hashmap.cpp"
+#include "../src/name_arena.cpp"
+#include "../src/mapped_file.cpp"
 
 
 // ==================================================== PAIRED_MIN_HEAP CLASS TESTING ==================================================================
@@ -17,6 +38,9 @@
 // Test 3: Test min_percolate/evaluate_children
 // Test 4: Test remove_min
 // Test 5: Test paired_min_heap constructor(s)
+// Test 6: Test paired_min_heap allocation from a provided memory resource
+// Test 7: Test paired_min_heap with integer (vertex ID) keys
+// Test 8: Test dial_queue and radix_heap extraction order against paired_min_heap for monotone priorities
 
 
 // Test function responsible for reporting the current number of key:value pairs currently stored in heap
@@ -470,6 +494,87 @@ TEST(test_PRMNHP, test_heap_move_constructor) {
 }
 
 
+// Test that all nodes (and their keys) are allocated from the memory resource provided on construction
+TEST(test_PRMNHP, test_heap_memory_resource) {
+    std::pmr::monotonic_buffer_resource arena;
+    // Any allocation made from the default resource will throw while the null resource is installed
+    std::pmr::memory_resource* previous_resource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+    EXPECT_NO_THROW({
+        auto min_heap = paired_min_heap<double>(2, &arena);
+        min_heap.add_node("A vertex name long enough to require allocation", 25.0);
+        min_heap.add_node("Another vertex name long enough to require allocation", 2.0);
+        for (int i = 0; i < 64; i++) {
+            min_heap.add_node("Vertex", static_cast<double>(64 - i));
+        }
+        EXPECT_EQ(min_heap.get_heap_size(), 66);
+        EXPECT_EQ(min_heap.remove_min().second, 1.0);
+        EXPECT_EQ(min_heap.remove_min().second, 2.0);
+    });
+    std::pmr::set_default_resource(previous_resource);
+}
+
+
+// Test that the minimum heap orders nodes identified by integer keys (such as vertex IDs) without storing any strings
+TEST(test_PRMNHP, test_heap_integer_keys) {
+    auto test_heap = paired_min_heap<double, unsigned int>(5);
+    test_heap.add_node(4, 12.5);
+    test_heap.add_node(0, 3.0);
+    test_heap.add_node(7, 8.25);
+    test_heap.add_node(2, 0.5);
+    ASSERT_EQ(test_heap.get_heap_size(), 4);
+    unsigned int key;
+    double value;
+    std::tie(key, value) = test_heap.get_min();
+    EXPECT_EQ(key, static_cast<unsigned int>(2));
+    EXPECT_EQ(value, 0.5);
+    std::tie(key, value) = test_heap.remove_min();
+    EXPECT_EQ(key, static_cast<unsigned int>(2));
+    std::tie(key, value) = test_heap.remove_min();
+    EXPECT_EQ(key, static_cast<unsigned int>(0));
+    EXPECT_EQ(value, 3.0);
+    std::tie(key, value) = test_heap.remove_min();
+    EXPECT_EQ(key, static_cast<unsigned int>(7));
+    std::tie(key, value) = test_heap.remove_min();
+    EXPECT_EQ(key, static_cast<unsigned int>(4));
+    EXPECT_EQ(value, 12.5);
+    EXPECT_TRUE(test_heap.is_empty());
+}
+
+
+// Test that the monotone integer queues extract the same priorities as the binary heap when fed as by a Dijkstra search
+TEST(test_PRMNHP, test_monotone_queues) {
+    const std::uint64_t max_step = 37;
+    auto binary_heap = paired_min_heap<double, unsigned int>(16);
+    auto dial = dial_queue<double>(max_step);
+    auto radix = radix_heap<double>();
+    EXPECT_THROW(dial.get_min(), std::runtime_error);
+    EXPECT_THROW(radix.remove_min(), std::runtime_error);
+    for (unsigned int key = 0; key < 8; key++) {
+        binary_heap.add_node(key, key * 3 % 8);
+        dial.add_node(key, key * 3 % 8);
+        radix.add_node(key, key * 3 % 8);
+    }
+    // Each extracted node adds nodes no lower than its own priority and no more than `max_step` above it
+    unsigned int next_key = 8;
+    while (!binary_heap.is_empty()) {
+        double expected = binary_heap.remove_min().second;
+        ASSERT_FALSE(dial.is_empty());
+        ASSERT_FALSE(radix.is_empty());
+        EXPECT_EQ(dial.get_min().second, expected);
+        EXPECT_EQ(dial.remove_min().second, expected);
+        EXPECT_EQ(radix.remove_min().second, expected);
+        for (unsigned int i = 0; i < 2 && next_key < 2000; i++, next_key++) {
+            double priority = expected + static_cast<double>((next_key * 7919) % (max_step + 1));
+            binary_heap.add_node(next_key, priority);
+            dial.add_node(next_key, priority);
+            radix.add_node(next_key, priority);
+        }
+    }
+    EXPECT_TRUE(dial.is_empty());
+    EXPECT_TRUE(radix.is_empty());
+}
+
+
 // ==================================================== SOA_HASHMAP CLASS TESTING ==================================================================
 
 // Test Suite test_SOAHSMP: OPEN-ADDRESSING HASHMAP Functions
@@ -489,6 +594,7 @@ TEST(test_PRMNHP, test_heap_move_constructor) {
 // Test 13: Test remove
 // Test 14: Test get_keys
 // Test 15: soa_hashmap constructors
+// Test 16: soa_hashmap/main_hashmap are final and non-polymorphic
 
 
 // Test function responsible for generating hash indexes from string keys for hashmap classes
@@ -1197,6 +1303,15 @@ TEST(test_SOAHSMP, test_shashmap_move_constructor) {
 
 
 
+// Test that both hashmap classes are final and carry no vtable, allowing their lookups to be inlined
+TEST(test_SOAHSMP, test_hashmaps_are_final) {
+    EXPECT_TRUE(std::is_final_v<soa_hashmap<double>>);
+    EXPECT_TRUE(std::is_final_v<main_hashmap<double>>);
+    EXPECT_FALSE(std::is_polymorphic_v<soa_hashmap<double>>);
+    EXPECT_FALSE(std::is_polymorphic_v<main_hashmap<std::string>>);
+}
+
+
 // ==================================================== MAIN_HASHMAP CLASS TESTING ==================================================================
 
 // Test Suite test_MHSMP: HASHMAP CONTAINING OPEN-ADDRESSING HASHMAP(S) Functions
@@ -1216,6 +1331,7 @@ TEST(test_SOAHSMP, test_shashmap_move_constructor) {
 // Test 10: Test get_hash_key
 // Test 11: Test get_key_by_val
 // Test 12: Test main_hashmap constructors
+// Test 13: Test main_hashmap/soa_hashmap allocation from a provided memory resource
 
 // Test function responsible for reporting the current number of key : value pairs stored in main_hashmap
 TEST(test_MHSMP, test_mhashmap_get_size) {
@@ -2243,3 +2359,1709 @@ TEST(test_MHSMP, test_mhashmap_move_constructor) {
     EXPECT_EQ(dtransfer_hashmap.get_val("Orlando", "Denver"), 96.2);
 }
 
+
+// Test that all buckets, keys and nested soa_hashmap objects are allocated from the memory resource provided on construction
+TEST(test_MHSMP, test_mhashmap_memory_resource) {
+    std::pmr::monotonic_buffer_resource arena;
+    auto dtest_hashmap = main_hashmap<double>(5, &arena);
+    EXPECT_EQ(dtest_hashmap.get_memory_resource(), &arena);
+    // Any allocation made from the default resource will throw while the null resource is installed
+    std::pmr::memory_resource* previous_resource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+    EXPECT_NO_THROW({
+        for (int i = 0; i < 40; i++) {
+            std::string vertex = "Vertex name long enough to require allocation " + std::to_string(i);
+            auto adjacent = soa_hashmap<double>(5, dtest_hashmap.get_memory_resource());
+            for (int j = 0; j < 10; j++) {
+                adjacent.add("Adjacent vertex name long enough to require allocation " + std::to_string(j), static_cast<double>(i + j));
+            }
+            dtest_hashmap.add(vertex, std::move(adjacent));
+        }
+        EXPECT_EQ(dtest_hashmap.get_size(), static_cast<unsigned int>(40));
+        EXPECT_EQ(dtest_hashmap.get_val("Vertex name long enough to require allocation 39",
+            "Adjacent vertex name long enough to require allocation 9"), 48.0);
+        EXPECT_EQ(dtest_hashmap.get_hash_key("Vertex name long enough to require allocation 7").get_memory_resource(), &arena);
+        dtest_hashmap.remove("Vertex name long enough to require allocation 7");
+        EXPECT_FALSE(dtest_hashmap.contains_key("Vertex name long enough to require allocation 7"));
+    });
+    std::pmr::set_default_resource(previous_resource);
+}
+
+
+// ==================================================== NAME_ARENA CLASS TESTING ==================================================================
+
+// Test Suite test_NMARNA: INTERNED VERTEX NAME STORAGE Functions
+// Test name_arena
+
+// Test 1: Test intern/get_id/find_id/contains_name
+// Test 2: Test get_name and stability of returned views
+// Test 3: Test name_arena move constructor
+
+
+// Test function responsible for storing each distinct name once and assigning IDs in order of first appearance
+TEST(test_NMARNA, test_intern) {
+    auto test_arena = name_arena(5);
+    EXPECT_EQ(test_arena.get_size(), static_cast<unsigned int>(0));
+    EXPECT_EQ(test_arena.find_id("Seattle"), name_arena::invalid_id);
+    EXPECT_EQ(test_arena.intern("Seattle"), static_cast<unsigned int>(0));
+    EXPECT_EQ(test_arena.intern("Tampa"), static_cast<unsigned int>(1));
+    EXPECT_EQ(test_arena.intern("Seattle"), static_cast<unsigned int>(0));
+    EXPECT_EQ(test_arena.get_size(), static_cast<unsigned int>(2));
+    EXPECT_EQ(test_arena.get_name_bytes(), static_cast<size_t>(14));
+    EXPECT_TRUE(test_arena.contains_name("Tampa"));
+    EXPECT_FALSE(test_arena.contains_name("Tamp"));
+    EXPECT_EQ(test_arena.get_id("Tampa"), static_cast<unsigned int>(1));
+    EXPECT_THROW({
+        try {
+            test_arena.get_id("Houston");
+        } catch (const std::exception& e) {
+            EXPECT_STREQ("ERROR: The name 'Houston' has not been stored within the calling name_arena object!", e.what());
+            throw;
+        }
+    }, std::exception);
+}
+
+
+// Test that views of interned names remain valid as the arena grows past its initial capacity
+TEST(test_NMARNA, test_get_name) {
+    auto test_arena = name_arena(5);
+    std::string_view first_name = test_arena.get_name(test_arena.intern("San Francisco"));
+    for (int i = 0; i < 500; i++) {
+        test_arena.intern("Vertex " + std::to_string(i));
+    }
+    EXPECT_EQ(test_arena.get_size(), static_cast<unsigned int>(501));
+    EXPECT_EQ(first_name, "San Francisco");
+    EXPECT_EQ(test_arena.get_name(0).data(), first_name.data());
+    EXPECT_STREQ(test_arena.get_name(251).data(), "Vertex 250");
+    for (unsigned int id = 0; id < test_arena.get_size(); id++) {
+        EXPECT_EQ(test_arena.find_id(test_arena.get_name(id)), id);
+    }
+    EXPECT_THROW(test_arena.get_name(501), std::runtime_error);
+}
+
+
+// Test function responsible for transferring interned names to a new name_arena without invalidating existing views
+TEST(test_NMARNA, test_name_arena_move_constructor) {
+    std::pmr::monotonic_buffer_resource arena;
+    auto old_arena = name_arena(5, &arena);
+    old_arena.intern("Portland");
+    old_arena.intern("Boise");
+    std::string_view stored_name = old_arena.get_name(1);
+    auto new_arena = name_arena(std::move(old_arena));
+    EXPECT_EQ(new_arena.get_memory_resource(), &arena);
+    EXPECT_EQ(new_arena.get_size(), static_cast<unsigned int>(2));
+    EXPECT_EQ(new_arena.get_name(1).data(), stored_name.data());
+    EXPECT_EQ(new_arena.get_id("Portland"), static_cast<unsigned int>(0));
+    EXPECT_EQ(new_arena.intern("Medford"), static_cast<unsigned int>(2));
+}
+
+
+// ==================================================== INDEXED_GRAPH CLASS TESTING ==================================================================
+
+// Test Suite test_IDXGRPH: ADJACENCY LIST OF VERTEX IDS Functions
+// Test indexed_graph
+
+// Test 1: Test add_vertex/add_edge/get_adjacent
+// Test 2: Test get_edge_weight/contains_edge
+// Test 3: Test indexed_graph allocation from a provided memory resource
+// Test 4: Test inline, spilled and hashed adjacency storage
+// Test 5: Test set_edge_weight replacement and insertion of edges and pairing of reverse edges
+// Test 6: Test get_component/same_component/get_component_count/label_components as edges join components
+
+
+// Test function responsible for adding verticies and directed edges identified by vertex IDs
+TEST(test_IDXGRPH, test_add_edge) {
+    auto test_graph = indexed_graph<double>(5);
+    EXPECT_EQ(test_graph.add_vertex("San Diego"), static_cast<unsigned int>(0));
+    EXPECT_EQ(test_graph.add_vertex("Las Vegas"), static_cast<unsigned int>(1));
+    EXPECT_EQ(test_graph.add_vertex("San Diego"), static_cast<unsigned int>(0));
+    EXPECT_TRUE(test_graph.add_edge(0, 1, 336));
+    EXPECT_TRUE(test_graph.add_edge(1, 0, 336));
+    // Duplicate edges are ignored and keep their original weight
+    EXPECT_FALSE(test_graph.add_edge(0, 1, 12));
+    EXPECT_TRUE(test_graph.add_edge("San Diego", "Cupertino", 487));
+    EXPECT_EQ(test_graph.get_vertex_count(), static_cast<unsigned int>(3));
+    EXPECT_EQ(test_graph.get_edge_count(), static_cast<unsigned long>(3));
+    const auto& adjacent = test_graph.get_adjacent(0);
+    ASSERT_EQ(adjacent.size(), static_cast<size_t>(2));
+    EXPECT_EQ(test_graph.get_vertex_name(adjacent[0].target), "Las Vegas");
+    EXPECT_EQ(adjacent[0].weight, 336);
+    EXPECT_EQ(test_graph.get_vertex_name(adjacent[1].target), "Cupertino");
+    EXPECT_EQ(test_graph.get_vertex_names(), std::list<std::string>({"San Diego", "Las Vegas", "Cupertino"}));
+    EXPECT_THROW(test_graph.add_edge(0, 3, 1.0), std::runtime_error);
+    EXPECT_THROW(test_graph.get_adjacent(3), std::runtime_error);
+}
+
+
+// Test function responsible for retrieving the weight of an existing directed edge
+TEST(test_IDXGRPH, test_get_edge_weight) {
+    auto test_graph = indexed_graph<double>();
+    test_graph.add_edge("Cupertino", "Sacramento", 128);
+    test_graph.add_edge("Sacramento", "Cupertino", 128);
+    test_graph.add_edge("San Francisco", "Cupertino", 46);
+    unsigned int cupertino = test_graph.get_vertex_id("Cupertino");
+    unsigned int san_francisco = test_graph.get_vertex_id("San Francisco");
+    EXPECT_TRUE(test_graph.contains_edge(san_francisco, cupertino));
+    EXPECT_FALSE(test_graph.contains_edge(cupertino, san_francisco));
+    EXPECT_EQ(test_graph.get_edge_weight(san_francisco, cupertino), 46);
+    EXPECT_EQ(test_graph.get_edge_weight(cupertino, test_graph.get_vertex_id("Sacramento")), 128);
+    EXPECT_THROW({
+        try {
+            test_graph.get_edge_weight(cupertino, san_francisco);
+        } catch (const std::exception& e) {
+            EXPECT_STREQ("ERROR: No edge exists from vertex 'Cupertino' to vertex with ID '2'!", e.what());
+            throw;
+        }
+    }, std::exception);
+    EXPECT_THROW(test_graph.get_vertex_id("Fresno"), std::runtime_error);
+}
+
+
+// Test that vertex names and adjacency arrays are allocated from the memory resource provided on construction
+TEST(test_IDXGRPH, test_indexed_graph_memory_resource) {
+    std::pmr::monotonic_buffer_resource arena;
+    auto test_graph = indexed_graph<double>(5, &arena);
+    EXPECT_EQ(test_graph.get_memory_resource(), &arena);
+    EXPECT_EQ(test_graph.get_names().get_memory_resource(), &arena);
+    // Any allocation made from the default resource will throw while the null resource is installed
+    std::pmr::memory_resource* previous_resource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+    EXPECT_NO_THROW({
+        for (int i = 0; i < 200; i++) {
+            std::string vertex = "Vertex name long enough to require allocation " + std::to_string(i);
+            std::string next = "Vertex name long enough to require allocation " + std::to_string((i + 1) % 200);
+            test_graph.add_edge(vertex, next, static_cast<double>(i));
+            test_graph.add_edge(next, vertex, static_cast<double>(i));
+        }
+        EXPECT_EQ(test_graph.get_vertex_count(), static_cast<unsigned int>(200));
+        EXPECT_EQ(test_graph.get_edge_count(), static_cast<unsigned long>(400));
+    });
+    std::pmr::set_default_resource(previous_resource);
+}
+
+
+// Test that edges keep their insertion order and remain retrievable as a vertex moves from inline to spilled and hashed storage
+TEST(test_IDXGRPH, test_inline_and_spilled_adjacency) {
+    using graph_type = indexed_graph<double>;
+    ASSERT_GE(graph_type::inline_capacity, static_cast<unsigned int>(1));
+    auto test_graph = graph_type(5);
+    unsigned int hub = test_graph.add_vertex("Hub");
+    unsigned int leaf = test_graph.add_vertex("Leaf");
+    test_graph.add_edge(leaf, hub, 1.0);
+    unsigned int degree = graph_type::hash_threshold * 3;
+    for (unsigned int i = 0; i < degree; i++) {
+        unsigned int spoke = test_graph.add_vertex("Spoke " + std::to_string(i));
+        EXPECT_TRUE(test_graph.add_edge(hub, spoke, static_cast<double>(i)));
+        if (i + 1 == graph_type::inline_capacity) {
+            EXPECT_EQ(test_graph.get_spilled_count(), static_cast<unsigned int>(0));
+        }
+    }
+    // Only the high-degree vertex leaves its record
+    EXPECT_EQ(test_graph.get_spilled_count(), static_cast<unsigned int>(1));
+    EXPECT_EQ(test_graph.get_adjacent(leaf).size(), static_cast<size_t>(1));
+    auto adjacent = test_graph.get_adjacent(hub);
+    ASSERT_EQ(adjacent.size(), static_cast<size_t>(degree));
+    for (unsigned int i = 0; i < degree; i++) {
+        EXPECT_EQ(test_graph.get_vertex_name(adjacent[i].target), "Spoke " + std::to_string(i));
+        EXPECT_EQ(test_graph.get_edge_weight(hub, adjacent[i].target), static_cast<double>(i));
+    }
+    EXPECT_FALSE(test_graph.add_edge(hub, test_graph.get_vertex_id("Spoke 20"), 99.0));
+    EXPECT_FALSE(test_graph.contains_edge(hub, leaf));
+    EXPECT_TRUE(test_graph.add_edge(hub, leaf, 2.5));
+    EXPECT_EQ(test_graph.get_edge_weight(hub, leaf), 2.5);
+    EXPECT_EQ(test_graph.get_edge_count(), static_cast<unsigned long>(degree + 2));
+}
+
+
+// Test that setting a weight replaces the weight of an existing edge in place, adds missing edges and tracks reverse edge pairs
+TEST(test_IDXGRPH, test_set_edge_weight) {
+    auto test_graph = indexed_graph<double>();
+    test_graph.add_edge("Cupertino", "Sacramento", 128);
+    test_graph.add_edge("Sacramento", "Cupertino", 128);
+    unsigned int cupertino = test_graph.get_vertex_id("Cupertino");
+    unsigned int sacramento = test_graph.get_vertex_id("Sacramento");
+    EXPECT_TRUE(test_graph.is_symmetric());
+    auto revision = test_graph.get_revision();
+    EXPECT_FALSE(test_graph.set_edge_weight(cupertino, sacramento, 96.5));
+    EXPECT_NE(test_graph.get_revision(), revision);
+    EXPECT_EQ(test_graph.get_edge_weight(cupertino, sacramento), 96.5);
+    EXPECT_EQ(test_graph.get_edge_count(), static_cast<unsigned long>(2));
+    EXPECT_FALSE(test_graph.is_symmetric());
+    EXPECT_FALSE(test_graph.has_integral_weights());
+    EXPECT_FALSE(test_graph.set_edge_weight("Sacramento", "Cupertino", 96.5));
+    EXPECT_TRUE(test_graph.is_symmetric());
+    // Missing verticies and edges are added
+    EXPECT_TRUE(test_graph.set_edge_weight("Cupertino", "Fresno", 150));
+    EXPECT_EQ(test_graph.get_vertex_count(), static_cast<unsigned int>(3));
+    EXPECT_EQ(test_graph.get_edge_count(), static_cast<unsigned long>(3));
+    EXPECT_EQ(test_graph.get_edge_weight(cupertino, test_graph.get_vertex_id("Fresno")), 150);
+    // Recorded weight bounds are only widened by replaced weights
+    EXPECT_EQ(test_graph.get_min_weight(), 96.5);
+    EXPECT_EQ(test_graph.get_max_weight(), 150);
+    EXPECT_THROW(test_graph.set_edge_weight(cupertino, 7, 1.0), std::runtime_error);
+}
+
+
+// Test that components are joined as edges are added, in either direction, and labelled in order of their lowest vertex ID
+TEST(test_IDXGRPH, test_components) {
+    auto test_graph = indexed_graph<double>();
+    EXPECT_EQ(test_graph.get_component_count(), static_cast<unsigned int>(0));
+    for (const char* name : {"Fresno", "San Diego", "Santa Domingo", "Chicago", "Boston"}) {
+        test_graph.add_vertex(name);
+    }
+    EXPECT_EQ(test_graph.get_component_count(), static_cast<unsigned int>(5));
+    EXPECT_FALSE(test_graph.same_component(0, 3));
+    test_graph.add_edge("Fresno", "San Diego", 3);
+    test_graph.add_edge("San Diego", "Fresno", 3);
+    // A single direction joins components as well, and adding a known edge again changes nothing
+    test_graph.add_edge("Chicago", "Santa Domingo", 5);
+    test_graph.add_edge("Chicago", "Santa Domingo", 5);
+    EXPECT_EQ(test_graph.get_component_count(), static_cast<unsigned int>(3));
+    EXPECT_TRUE(test_graph.same_component(test_graph.get_vertex_id("Santa Domingo"), test_graph.get_vertex_id("Chicago")));
+    EXPECT_FALSE(test_graph.same_component(test_graph.get_vertex_id("Fresno"), test_graph.get_vertex_id("Chicago")));
+    EXPECT_EQ(test_graph.get_component(0), test_graph.get_component(1));
+
+    std::pmr::vector<unsigned int> labels;
+    EXPECT_EQ(test_graph.label_components(labels), static_cast<unsigned int>(3));
+    EXPECT_EQ(labels, (std::pmr::vector<unsigned int>{0, 0, 1, 1, 2}));
+    // Edges added to verticies created by `set_edge_weight` join their components too
+    test_graph.set_edge_weight("Boston", "Fresno", 9);
+    test_graph.set_edge_weight("Denver", "Boston", 2);
+    EXPECT_EQ(test_graph.get_component_count(), static_cast<unsigned int>(2));
+    EXPECT_EQ(test_graph.label_components(labels), static_cast<unsigned int>(2));
+    EXPECT_EQ(labels, (std::pmr::vector<unsigned int>{0, 0, 1, 1, 0, 0}));
+    EXPECT_THROW(test_graph.get_component(6), std::runtime_error);
+}
+
+
+
+// ==================================================== PATH SEARCH TESTING ==================================================================
+
+// Test Suite test_PTHSRCH: POINT-TO-POINT SHORTEST PATH SEARCH Functions
+// Test forward_search and bidirectional_search
+
+// Test 1: Test bidirectional_search against forward_search for all pairs of verticies
+// Test 2: Test searches between unconnected verticies
+// Test 3: Test landmark_search against forward_search for all pairs of verticies
+// Test 4: Test landmark_table save/load and rejection of tables built from a different graph
+// Test 5: Test hierarchy_search against forward_search for all pairs of verticies
+// Test 6: Test contraction_hierarchy save/load and rejection of hierarchies built from a different graph
+// Test 7: Test hub_labels distances against forward_search for all pairs of verticies
+// Test 8: Test hub_labels save/load through a mapped file and rejection of labels built from a different graph
+// Test 9: Test path_tree distances and extracted paths against forward_search for every destination
+// Test 10: Test path_tree_cache hits, least recently used evictions and invalidation upon modification of the graph
+// Test 11: Test delta_stepping_tree distances and predecessors against shortest_path_tree for several bucket widths and thread counts
+// Test 12: Test all_pairs_table distances and next hop paths against forward_search for all pairs of verticies
+// Test 13: Test detection of uniform, integral and symmetric edge weights and breadth_first_tree against shortest_path_tree
+// Test 14: Test queue selection from edge weights and shortest_path_tree/forward_search with every kind of queue (also over a reused query_scratch)
+// Test 15: Test searches, all-pairs tables and hierarchies with float and std::uint32_t weights against double weights
+// Test 16: Test multi_source_tree and nearest_source_forest against shortest_path_tree from each source vertex
+// Test 17: Test k_shortest_paths against every loopless path ordered by length, for several thread counts and a directed graph
+// Test 18: Test path_tree::repair and path_tree_cache::update_edge against trees built again after each weight change
+// Test 19: Test partition_graph region balance and cut against regions of consecutive vertex IDs
+// Test 20: Test arc_flag_search against forward_search for all pairs of verticies and flags built by several thread counts
+// Test 21: Test arc_flag_table save/load and rejection of flags built from a different graph
+// Test 22: Test query_scratch generations, which hide the entries of earlier searches until they are written again
+// Test 23: Test forward_search and bidirectional_search over reused query_scratch against searches over fresh arrays
+// Test 24: Test all_pairs_table save/load and rejection of a table built from a different graph
+
+
+/**
+ * Builds an undirected graph of `vertex_count` verticies, where each vertex is joined to the next vertex and to the vertex
+ * `stride` positions ahead of it, with varying (and frequently equal) edge weights
+ */
+static indexed_graph<double> build_test_ring(unsigned int vertex_count, unsigned int stride) {
+    auto graph = indexed_graph<double>(vertex_count);
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        std::string vertex = "V" + std::to_string(i);
+        std::string next = "V" + std::to_string((i + 1) % vertex_count);
+        std::string skip = "V" + std::to_string((i + stride) % vertex_count);
+        double next_weight = static_cast<double>((i * 7) % 5 + 1);
+        double skip_weight = static_cast<double>((i * 11) % 13 + 2);
+        graph.add_edge(vertex, next, next_weight);
+        graph.add_edge(next, vertex, next_weight);
+        graph.add_edge(vertex, skip, skip_weight);
+        graph.add_edge(skip, vertex, skip_weight);
+    }
+    return graph;
+}
+
+
+/**
+ * Sums the edge weights along the path recorded in `vertex_path` from `source_id` to `destination_id`
+ */
+static double trace_path_length(const indexed_graph<double>& graph, const std::pmr::vector<unsigned int>& vertex_path,
+    unsigned int source_id, unsigned int destination_id) {
+    double length = 0;
+    unsigned int vertex = destination_id;
+    while (vertex != source_id) {
+        unsigned int previous = vertex_path[vertex];
+        length += graph.get_edge_weight(previous, vertex);
+        vertex = previous;
+    }
+    return length;
+}
+
+
+// Test that both searches agree on the shortest distance of every pair and record a valid path of that length
+TEST(test_PTHSRCH, test_bidirectional_search) {
+    auto graph = build_test_ring(60, 7);
+    std::pmr::vector<double> forward_distances;
+    std::pmr::vector<unsigned int> forward_path;
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    unsigned long forward_settled = 0;
+    unsigned long bidirectional_settled = 0;
+    for (unsigned int source = 0; source < graph.get_vertex_count(); source++) {
+        for (unsigned int destination = 0; destination < graph.get_vertex_count(); destination++) {
+            auto expected = forward_search(graph, source, destination, forward_distances, forward_path);
+            auto result = bidirectional_search(graph, source, destination, distances, vertex_path);
+            ASSERT_DOUBLE_EQ(result.distance, expected.distance);
+            EXPECT_DOUBLE_EQ(distances[destination], expected.distance);
+            EXPECT_DOUBLE_EQ(trace_path_length(graph, vertex_path, source, destination), expected.distance);
+            EXPECT_DOUBLE_EQ(trace_path_length(graph, forward_path, source, destination), expected.distance);
+            forward_settled += expected.settled_count;
+            bidirectional_settled += result.settled_count;
+        }
+    }
+    EXPECT_LT(bidirectional_settled, forward_settled);
+}
+
+
+// Test that searches between verticies of separate components report an infinite distance
+TEST(test_PTHSRCH, test_search_unconnected) {
+    auto graph = indexed_graph<double>(5);
+    graph.add_edge("Seattle", "Portland", 174);
+    graph.add_edge("Portland", "Seattle", 174);
+    graph.add_edge("Dallas", "Houston", 239);
+    graph.add_edge("Houston", "Dallas", 239);
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    auto result = bidirectional_search(graph, graph.get_vertex_id("Seattle"), graph.get_vertex_id("Houston"), distances, vertex_path);
+    EXPECT_EQ(result.distance, std::numeric_limits<double>::infinity());
+    result = forward_search(graph, graph.get_vertex_id("Seattle"), graph.get_vertex_id("Houston"), distances, vertex_path);
+    EXPECT_EQ(result.distance, std::numeric_limits<double>::infinity());
+    EXPECT_EQ(vertex_path[graph.get_vertex_id("Houston")], name_arena::invalid_id);
+    result = bidirectional_search(graph, graph.get_vertex_id("Houston"), graph.get_vertex_id("Dallas"), distances, vertex_path);
+    EXPECT_EQ(result.distance, 239);
+    EXPECT_EQ(vertex_path[graph.get_vertex_id("Dallas")], graph.get_vertex_id("Houston"));
+}
+
+
+// Test that A* search with landmark lower bounds finds shortest paths while settling fewer verticies than Dijkstra's algorithm
+TEST(test_PTHSRCH, test_landmark_search) {
+    auto graph = build_test_ring(60, 7);
+    auto landmarks = landmark_table<double>();
+    landmarks.build(graph, 4);
+    ASSERT_EQ(landmarks.get_landmarks().size(), static_cast<size_t>(4));
+    std::pmr::vector<double> forward_distances;
+    std::pmr::vector<unsigned int> forward_path;
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    unsigned long forward_settled = 0;
+    unsigned long landmark_settled = 0;
+    for (unsigned int source = 0; source < graph.get_vertex_count(); source++) {
+        for (unsigned int destination = 0; destination < graph.get_vertex_count(); destination++) {
+            auto expected = forward_search(graph, source, destination, forward_distances, forward_path);
+            EXPECT_LE(landmarks.lower_bound(source, destination), expected.distance);
+            auto result = landmark_search(graph, source, destination, landmarks, distances, vertex_path);
+            ASSERT_DOUBLE_EQ(result.distance, expected.distance);
+            EXPECT_DOUBLE_EQ(trace_path_length(graph, vertex_path, source, destination), expected.distance);
+            forward_settled += expected.settled_count;
+            landmark_settled += result.settled_count;
+        }
+    }
+    EXPECT_LT(landmark_settled, forward_settled);
+}
+
+
+// Test that saved landmark tables are restored for the same graph and rejected for any other graph
+TEST(test_PTHSRCH, test_landmark_table_persistence) {
+    const std::string table_file = "test_landmark_table.alt";
+    auto graph = build_test_ring(40, 5);
+    auto landmarks = landmark_table<double>();
+    landmarks.build(graph);
+    ASSERT_EQ(landmarks.save(table_file), 0);
+
+    auto loaded = landmark_table<double>();
+    EXPECT_EQ(loaded.load("missing_landmark_table.alt", graph), -1);
+    ASSERT_EQ(loaded.load(table_file, graph), 0);
+    EXPECT_TRUE(loaded.matches(graph));
+    EXPECT_EQ(loaded.get_landmarks(), landmarks.get_landmarks());
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        EXPECT_EQ(loaded.lower_bound(vertex, 17), landmarks.lower_bound(vertex, 17));
+    }
+
+    // Changing a single edge weight invalidates the saved tables
+    auto changed_graph = build_test_ring(40, 5);
+    changed_graph.add_edge("V0", "V20", 1.0);
+    auto rejected = landmark_table<double>();
+    EXPECT_FALSE(landmarks.matches(changed_graph));
+    EXPECT_EQ(rejected.load(table_file, changed_graph), -1);
+    EXPECT_TRUE(rejected.get_landmarks().empty());
+    std::remove(table_file.c_str());
+}
+
+
+// Test that upward-only hierarchy searches find shortest paths whose unpacked verticies are joined by original edges
+TEST(test_PTHSRCH, test_hierarchy_search) {
+    auto graph = build_test_ring(60, 7);
+    graph.add_edge("Seattle", "Portland", 174);
+    graph.add_edge("Portland", "Seattle", 174);
+    auto hierarchy = contraction_hierarchy<double>();
+    hierarchy.build(graph, 4);
+    EXPECT_GT(hierarchy.get_shortcut_count(), 0U);
+    // The contraction order does not depend on the number of threads computing the initial priorities
+    auto serial_hierarchy = contraction_hierarchy<double>();
+    serial_hierarchy.build(graph, 1);
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        EXPECT_EQ(serial_hierarchy.get_rank(vertex), hierarchy.get_rank(vertex));
+    }
+
+    std::pmr::vector<double> forward_distances;
+    std::pmr::vector<unsigned int> forward_path;
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    unsigned long forward_settled = 0;
+    unsigned long hierarchy_settled = 0;
+    for (unsigned int source = 0; source < graph.get_vertex_count(); source++) {
+        for (unsigned int destination = 0; destination < graph.get_vertex_count(); destination++) {
+            auto expected = forward_search(graph, source, destination, forward_distances, forward_path);
+            auto result = hierarchy_search(hierarchy, source, destination, distances, vertex_path);
+            ASSERT_DOUBLE_EQ(result.distance, expected.distance);
+            if (expected.distance != std::numeric_limits<double>::infinity()) {
+                EXPECT_DOUBLE_EQ(trace_path_length(graph, vertex_path, source, destination), expected.distance);
+            }
+            forward_settled += expected.settled_count;
+            hierarchy_settled += result.settled_count;
+        }
+    }
+    EXPECT_LT(hierarchy_settled, forward_settled);
+}
+
+
+// Test that a saved hierarchy is restored for the same graph and rejected for any other graph
+TEST(test_PTHSRCH, test_hierarchy_persistence) {
+    const std::string hierarchy_file = "test_hierarchy.ch";
+    auto graph = build_test_ring(40, 5);
+    auto hierarchy = contraction_hierarchy<double>();
+    hierarchy.build(graph);
+    ASSERT_EQ(hierarchy.save(hierarchy_file), 0);
+
+    auto loaded = contraction_hierarchy<double>();
+    EXPECT_EQ(loaded.load("missing_hierarchy.ch", graph), -1);
+    ASSERT_EQ(loaded.load(hierarchy_file, graph), 0);
+    EXPECT_TRUE(loaded.matches(graph));
+    EXPECT_EQ(loaded.get_arc_count(), hierarchy.get_arc_count());
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    std::pmr::vector<double> loaded_distances;
+    std::pmr::vector<unsigned int> loaded_path;
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        EXPECT_EQ(loaded.get_rank(vertex), hierarchy.get_rank(vertex));
+        auto result = hierarchy_search(hierarchy, vertex, 17, distances, vertex_path);
+        auto loaded_result = hierarchy_search(loaded, vertex, 17, loaded_distances, loaded_path);
+        EXPECT_DOUBLE_EQ(loaded_result.distance, result.distance);
+        EXPECT_EQ(loaded_path, vertex_path);
+    }
+
+    // Changing a single edge weight invalidates the saved hierarchy
+    auto changed_graph = build_test_ring(40, 5);
+    changed_graph.add_edge("V0", "V20", 1.0);
+    auto rejected = contraction_hierarchy<double>();
+    EXPECT_FALSE(hierarchy.matches(changed_graph));
+    EXPECT_EQ(rejected.load(hierarchy_file, changed_graph), -1);
+    EXPECT_EQ(rejected.get_vertex_count(), 0U);
+    std::remove(hierarchy_file.c_str());
+}
+
+
+// Test that merging the labels of two verticies yields their shortest distance, or infinity if they are not connected
+TEST(test_PTHSRCH, test_hub_label_distance) {
+    auto graph = build_test_ring(60, 7);
+    graph.add_edge("Seattle", "Portland", 174);
+    graph.add_edge("Portland", "Seattle", 174);
+    auto hierarchy = contraction_hierarchy<double>();
+    hierarchy.build(graph);
+    auto labels = hub_labels<double>();
+    labels.build(hierarchy);
+    ASSERT_EQ(labels.get_vertex_count(), graph.get_vertex_count());
+    EXPECT_LT(labels.get_entry_count(), static_cast<size_t>(graph.get_vertex_count()) * graph.get_vertex_count());
+
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    for (unsigned int source = 0; source < graph.get_vertex_count(); source++) {
+        EXPECT_GE(labels.get_label_size(source), static_cast<size_t>(1));
+        for (unsigned int destination = 0; destination < graph.get_vertex_count(); destination++) {
+            auto expected = forward_search(graph, source, destination, distances, vertex_path);
+            ASSERT_DOUBLE_EQ(labels.distance(source, destination), expected.distance);
+        }
+    }
+}
+
+
+// Test that saved labels are queried in place from the loaded file and rejected for any other graph
+TEST(test_PTHSRCH, test_hub_label_persistence) {
+    const std::string label_file = "test_hub_labels.hl";
+    auto graph = build_test_ring(40, 5);
+    auto hierarchy = contraction_hierarchy<double>();
+    hierarchy.build(graph);
+    auto labels = hub_labels<double>();
+    labels.build(hierarchy);
+    EXPECT_TRUE(labels.matches(graph));
+    ASSERT_EQ(labels.save(label_file), 0);
+
+    auto loaded = hub_labels<double>();
+    EXPECT_EQ(loaded.load("missing_hub_labels.hl", graph), -1);
+    ASSERT_EQ(loaded.load(label_file, graph), 0);
+#ifdef __linux__
+    EXPECT_TRUE(loaded.is_mapped());
+#endif
+    // Moving the loaded labels keeps them pointing into the same view of the file
+    auto moved = std::move(loaded);
+    EXPECT_EQ(loaded.get_vertex_count(), 0U);
+    ASSERT_EQ(moved.get_entry_count(), labels.get_entry_count());
+    for (unsigned int source = 0; source < graph.get_vertex_count(); source++) {
+        for (unsigned int destination = 0; destination < graph.get_vertex_count(); destination++) {
+            EXPECT_EQ(moved.distance(source, destination), labels.distance(source, destination));
+        }
+    }
+
+    // Changing a single edge weight invalidates the saved labels
+    auto changed_graph = build_test_ring(40, 5);
+    changed_graph.add_edge("V0", "V20", 1.0);
+    auto rejected = hub_labels<double>();
+    EXPECT_FALSE(labels.matches(changed_graph));
+    EXPECT_EQ(rejected.load(label_file, changed_graph), -1);
+    EXPECT_EQ(rejected.get_vertex_count(), 0U);
+    std::remove(label_file.c_str());
+}
+
+
+// Test that a single shortest path tree answers every destination, reporting unreachable verticies without a path
+TEST(test_PTHSRCH, test_path_tree_extraction) {
+    auto graph = build_test_ring(60, 7);
+    graph.add_edge("Seattle", "Portland", 174);
+    graph.add_edge("Portland", "Seattle", 174);
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    std::pmr::vector<unsigned int> path;
+    auto tree = path_tree<double>();
+    unsigned int source = graph.get_vertex_id("V3");
+    tree.build(graph, source);
+    EXPECT_EQ(tree.get_source(), source);
+    EXPECT_EQ(tree.get_settled_count(), 60U);
+    for (unsigned int destination = 0; destination < 60; destination++) {
+        auto expected = forward_search(graph, source, destination, distances, vertex_path);
+        ASSERT_TRUE(tree.reaches(destination));
+        EXPECT_DOUBLE_EQ(tree.get_distance(destination), expected.distance);
+        ASSERT_TRUE(tree.extract_path(destination, path));
+        EXPECT_EQ(path.front(), source);
+        EXPECT_EQ(path.back(), destination);
+        double length = 0;
+        for (size_t i = 1; i < path.size(); i++) {
+            length += graph.get_edge_weight(path[i - 1], path[i]);
+        }
+        EXPECT_DOUBLE_EQ(length, expected.distance);
+    }
+
+    // Verticies of another component are never reached
+    unsigned int unreachable = graph.get_vertex_id("Portland");
+    EXPECT_FALSE(tree.reaches(unreachable));
+    EXPECT_EQ(tree.get_distance(unreachable), std::numeric_limits<double>::infinity());
+    EXPECT_FALSE(tree.extract_path(unreachable, path));
+    EXPECT_TRUE(path.empty());
+}
+
+
+// Test that cached trees are reused until evicted by the memory budget or discarded once the graph changes
+TEST(test_PTHSRCH, test_path_tree_cache) {
+    auto graph = build_test_ring(60, 7);
+    // Budget fits exactly two trees of 60 verticies
+    auto cache = path_tree_cache<double>(2 * 60 * (sizeof(double) + sizeof(unsigned int)));
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    unsigned int source = graph.get_vertex_id("V4");
+    unsigned int destination = graph.get_vertex_id("V31");
+    auto expected = forward_search(graph, source, destination, distances, vertex_path);
+    EXPECT_DOUBLE_EQ(cache.get_tree(graph, source).get_distance(destination), expected.distance);
+    EXPECT_DOUBLE_EQ(cache.get_tree(graph, source).get_distance(destination), expected.distance);
+    EXPECT_EQ(cache.get_miss_count(), 1UL);
+    EXPECT_EQ(cache.get_hit_count(), 1UL);
+
+    // Requesting V4 again makes the tree of V9 the least recently used tree, which is evicted by the tree of V17
+    cache.get_tree(graph, graph.get_vertex_id("V9"));
+    cache.get_tree(graph, source);
+    cache.get_tree(graph, graph.get_vertex_id("V17"));
+    EXPECT_EQ(cache.get_eviction_count(), 1UL);
+    EXPECT_EQ(cache.get_tree_count(), 2U);
+    EXPECT_TRUE(cache.contains(source));
+    EXPECT_FALSE(cache.contains(graph.get_vertex_id("V9")));
+    EXPECT_TRUE(cache.contains(graph.get_vertex_id("V17")));
+    EXPECT_LE(cache.get_byte_count(), 2 * 60 * (sizeof(double) + sizeof(unsigned int)));
+
+    // A new edge changes the revision of the graph, so the stale trees are discarded and the shorter path is found
+    auto revision = graph.get_revision();
+    graph.add_edge("V4", "V31", 0.5);
+    EXPECT_NE(graph.get_revision(), revision);
+    EXPECT_DOUBLE_EQ(cache.get_tree(graph, source).get_distance(destination), 0.5);
+    EXPECT_EQ(cache.get_invalidation_count(), 1UL);
+    EXPECT_EQ(cache.get_tree_count(), 1U);
+    EXPECT_EQ(cache.get_miss_count(), 4UL);
+
+    // An identical but separately built graph never shares a revision with the cached one
+    auto rebuilt = build_test_ring(60, 7);
+    EXPECT_NE(rebuilt.get_revision(), graph.get_revision());
+    EXPECT_DOUBLE_EQ(cache.get_tree(rebuilt, source).get_distance(destination), expected.distance);
+    EXPECT_EQ(cache.get_invalidation_count(), 2UL);
+}
+
+
+// Test that parallel bucketed relaxation yields exactly the sequential tree, including the choice between equally short paths
+TEST(test_PTHSRCH, test_delta_stepping) {
+    auto ring = build_test_ring(60, 7);
+    ring.add_edge("Seattle", "Portland", 174);
+    ring.add_edge("Portland", "Seattle", 174);
+    // Verticies joined to distant verticies, so the frontier of a wide bucket grows large enough to be split across threads
+    const unsigned int vertex_count = 6000;
+    auto expander = indexed_graph<double>(vertex_count);
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        expander.add_vertex("G" + std::to_string(i));
+    }
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        for (unsigned int other : {(i + 1) % vertex_count, (i * 31 + 7) % vertex_count, (i * 97 + 13) % vertex_count}) {
+            double weight = static_cast<double>((i * 7 + other * 3) % 4 + 1);
+            expander.add_edge(i, other, weight);
+            expander.add_edge(other, i, weight);
+        }
+    }
+    EXPECT_GE(suggest_delta(ring), ring.get_min_weight());
+    EXPECT_LE(suggest_delta(expander), expander.get_max_weight());
+
+    std::pmr::vector<double> expected_distances;
+    std::pmr::vector<unsigned int> expected_path;
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    for (const auto* graph : {&ring, &expander}) {
+        for (unsigned int source : {0U, graph -> get_vertex_count() / 2}) {
+            unsigned int settled = shortest_path_tree(*graph, source, expected_distances, expected_path);
+            for (double delta : {0.0, 1.0, 2.5, 1000.0}) {
+                for (unsigned int thread_count : {1U, 4U}) {
+                    EXPECT_EQ(delta_stepping_tree(*graph, source, distances, vertex_path, delta, thread_count), settled);
+                    EXPECT_EQ(distances, expected_distances);
+                    EXPECT_EQ(vertex_path, expected_path);
+                }
+            }
+        }
+    }
+    auto tree = path_tree<double>();
+    tree.build_parallel(ring, ring.get_vertex_id("Seattle"), 2);
+    EXPECT_EQ(tree.get_settled_count(), 2U);
+    EXPECT_DOUBLE_EQ(tree.get_distance(ring.get_vertex_id("Portland")), 174);
+    EXPECT_FALSE(tree.reaches(0));
+}
+
+
+// Test that the blocked Floyd-Warshall table spanning several tiles holds every shortest distance and a path of that length
+TEST(test_PTHSRCH, test_all_pairs_table) {
+    auto graph = build_test_ring(150, 11);
+    graph.add_edge("Seattle", "Portland", 174);
+    graph.add_edge("Portland", "Seattle", 174);
+    auto single_thread = all_pairs_table<double>();
+    auto multi_thread = all_pairs_table<double>();
+    single_thread.build(graph, 1);
+    multi_thread.build(graph, 4);
+    ASSERT_EQ(multi_thread.get_vertex_count(), graph.get_vertex_count());
+    std::pmr::vector<double> expected_distances;
+    std::pmr::vector<unsigned int> expected_path;
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    std::pmr::vector<unsigned int> path;
+    for (unsigned int source = 0; source < graph.get_vertex_count(); source++) {
+        shortest_path_tree(graph, source, expected_distances, expected_path);
+        for (unsigned int destination = 0; destination < graph.get_vertex_count(); destination++) {
+            ASSERT_DOUBLE_EQ(single_thread.get_distance(source, destination), expected_distances[destination]);
+            ASSERT_DOUBLE_EQ(multi_thread.get_distance(source, destination), expected_distances[destination]);
+            if (expected_distances[destination] == std::numeric_limits<double>::infinity()) {
+                EXPECT_FALSE(multi_thread.extract_path(source, destination, path));
+                EXPECT_TRUE(path.empty());
+                continue;
+            }
+            ASSERT_TRUE(multi_thread.extract_path(source, destination, path));
+            double length = 0;
+            for (size_t i = 1; i < path.size(); i++) {
+                length += graph.get_edge_weight(path[i - 1], path[i]);
+            }
+            EXPECT_DOUBLE_EQ(length, expected_distances[destination]);
+        }
+    }
+    auto result = all_pairs_search(multi_thread, 3, 140, distances, vertex_path);
+    EXPECT_DOUBLE_EQ(result.distance, trace_path_length(graph, vertex_path, 3, 140));
+    EXPECT_DOUBLE_EQ(distances[140], result.distance);
+    EXPECT_THROW(multi_thread.build(build_test_ring(all_pairs_table<double>::max_vertex_count + 1, 3)), std::runtime_error);
+}
+
+
+// Test that a breadth-first search of a graph with a single edge weight finds the tree of a Dijkstra search
+TEST(test_PTHSRCH, test_breadth_first_tree) {
+    auto ring = build_test_ring(60, 7);
+    EXPECT_FALSE(ring.has_uniform_weights());
+    EXPECT_TRUE(ring.has_integral_weights());
+    EXPECT_TRUE(ring.is_symmetric());
+    EXPECT_FALSE(suits_breadth_first(ring));
+    // Verticies joined to distant verticies, so the frontier grows large enough for bottom-up steps
+    const unsigned int vertex_count = 6000;
+    auto expander = indexed_graph<double>(vertex_count);
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        expander.add_vertex("G" + std::to_string(i));
+    }
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        for (unsigned int other : {(i + 1) % vertex_count, (i * 31 + 7) % vertex_count, (i * 97 + 13) % vertex_count}) {
+            expander.add_edge(i, other, 0.1);
+            expander.add_edge(other, i, 0.1);
+        }
+    }
+    EXPECT_TRUE(expander.has_uniform_weights());
+    EXPECT_FALSE(expander.has_integral_weights());
+    ASSERT_TRUE(suits_breadth_first(expander));
+
+    std::pmr::vector<double> expected_distances;
+    std::pmr::vector<unsigned int> expected_path;
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    for (unsigned int source : {0U, 2999U, 5999U}) {
+        unsigned int settled = shortest_path_tree(expander, source, expected_distances, expected_path);
+        EXPECT_EQ(breadth_first_tree(expander, source, distances, vertex_path), settled);
+        EXPECT_EQ(distances, expected_distances);
+        EXPECT_EQ(vertex_path, expected_path);
+        auto result = breadth_first_search(expander, source, 1234U, distances, vertex_path);
+        EXPECT_EQ(result.distance, expected_distances[1234]);
+        EXPECT_LE(result.settled_count, settled);
+        EXPECT_DOUBLE_EQ(trace_path_length(expander, vertex_path, source, 1234), result.distance);
+    }
+    auto tree = path_tree<double>();
+    tree.build(expander, 17);
+    shortest_path_tree(expander, 17, expected_distances, expected_path);
+    EXPECT_EQ(tree.get_predecessors(), expected_path);
+
+    // An edge without a reverse edge would be missed by bottom-up steps, so the graph is no longer searched breadth-first
+    expander.add_edge("G0", "Unpaired", 0.1);
+    EXPECT_FALSE(expander.is_symmetric());
+    EXPECT_FALSE(suits_breadth_first(expander));
+}
+
+
+// Test that every kind of queue yields the same tree, and that the queue is chosen from the range of the edge weights
+TEST(test_PTHSRCH, test_priority_queue_kinds) {
+    auto small_weights = build_test_ring(300, 17);
+    auto large_weights = indexed_graph<double>(300);
+    auto fractional_weights = build_test_ring(300, 17);
+    for (unsigned int i = 0; i < 300; i++) {
+        large_weights.add_vertex("V" + std::to_string(i));
+    }
+    for (unsigned int i = 0; i < 300; i++) {
+        for (unsigned int other : {(i + 1) % 300, (i * 17 + 5) % 300}) {
+            double weight = static_cast<double>((i * 7919 + other * 104729) % 100000 + 1);
+            large_weights.add_edge(i, other, weight);
+            large_weights.add_edge(other, i, weight);
+        }
+    }
+    fractional_weights.add_edge("V0", "V150", 2.5);
+    EXPECT_EQ(choose_queue(small_weights), queue_kind::dial_buckets);
+    EXPECT_EQ(choose_queue(large_weights), queue_kind::radix_heap);
+    EXPECT_EQ(choose_queue(fractional_weights), queue_kind::binary_heap);
+    EXPECT_EQ(choose_queue(indexed_graph<double>()), queue_kind::binary_heap);
+
+    std::pmr::vector<double> expected_distances;
+    std::pmr::vector<unsigned int> expected_path;
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    for (const auto* graph : {&small_weights, &large_weights}) {
+        for (unsigned int source : {0U, 123U}) {
+            unsigned int settled = shortest_path_tree(*graph, source, expected_distances, expected_path, queue_kind::binary_heap);
+            for (queue_kind queue : {queue_kind::automatic, queue_kind::dial_buckets, queue_kind::radix_heap}) {
+                EXPECT_EQ(shortest_path_tree(*graph, source, distances, vertex_path, queue), settled);
+                EXPECT_EQ(distances, expected_distances);
+                EXPECT_EQ(vertex_path, expected_path);
+                auto result = forward_search(*graph, source, 299U, distances, vertex_path, queue);
+                EXPECT_EQ(result.distance, expected_distances[299]);
+                EXPECT_DOUBLE_EQ(trace_path_length(*graph, vertex_path, source, 299), result.distance);
+            }
+        }
+    }
+
+    // A single query_scratch searches with the queue chosen for each graph, switching between them from one search to the next
+    auto scratch = query_scratch<double>();
+    for (const auto* graph : {&small_weights, &large_weights, &fractional_weights, &small_weights, &large_weights}) {
+        for (unsigned int source : {0U, 123U}) {
+            auto expected = forward_search(*graph, source, 299U, distances, vertex_path);
+            auto result = forward_search(*graph, source, 299U, scratch);
+            EXPECT_EQ(result.distance, expected.distance);
+            EXPECT_EQ(result.settled_count, expected.settled_count);
+            scratch.copy_to(expected_distances, expected_path);
+            EXPECT_EQ(expected_path, vertex_path);
+        }
+    }
+}
+
+
+/**
+ * Copies every vertex and edge of `graph` into a graph whose edge weights are converted to `Type`
+ */
+template <class Type>
+static indexed_graph<Type> convert_weights(const indexed_graph<double>& graph) {
+    auto converted = indexed_graph<Type>(graph.get_vertex_count());
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        converted.add_vertex(graph.get_vertex_name(vertex));
+    }
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+            converted.add_edge(vertex, adjacent_edge.target, static_cast<Type>(adjacent_edge.weight));
+        }
+    }
+    return converted;
+}
+
+
+/**
+ * Checks that the searches of a graph with `Type` edge weights find the same distances as those of `reference`
+ */
+template <class Type>
+static void expect_same_distances(const indexed_graph<double>& reference) {
+    auto graph = convert_weights<Type>(reference);
+    auto hierarchy = contraction_hierarchy<Type>();
+    auto table = all_pairs_table<Type>();
+    hierarchy.build(graph);
+    table.build(graph);
+    std::pmr::vector<double> expected_distances;
+    std::pmr::vector<unsigned int> expected_path;
+    std::pmr::vector<Type> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    for (unsigned int source : {0U, 42U}) {
+        shortest_path_tree(reference, source, expected_distances, expected_path);
+        shortest_path_tree(graph, source, distances, vertex_path);
+        EXPECT_EQ(vertex_path, expected_path);
+        delta_stepping_tree(graph, source, distances, vertex_path);
+        EXPECT_EQ(vertex_path, expected_path);
+        for (unsigned int destination = 0; destination < graph.get_vertex_count(); destination++) {
+            Type expected = expected_distances[destination] == std::numeric_limits<double>::infinity() ? unreachable_distance<Type>() :
+                static_cast<Type>(expected_distances[destination]);
+            ASSERT_EQ(table.get_distance(source, destination), expected);
+            ASSERT_EQ(hierarchy_search(hierarchy, source, destination, distances, vertex_path).distance, expected);
+            ASSERT_EQ(bidirectional_search(graph, source, destination, distances, vertex_path).distance, expected);
+        }
+    }
+}
+
+
+// Test that narrower weight types find the same distances, with unreachable verticies marked by `unreachable_distance`
+TEST(test_PTHSRCH, test_weight_types) {
+    auto graph = build_test_ring(90, 13);
+    graph.add_edge("Seattle", "Portland", 174);
+    graph.add_edge("Portland", "Seattle", 174);
+    EXPECT_EQ(unreachable_distance<double>(), std::numeric_limits<double>::infinity());
+    EXPECT_EQ(unreachable_distance<std::uint32_t>(), std::numeric_limits<std::uint32_t>::max() / 2);
+    // Two unreachable distances add up without overflowing, so min-plus updates never wrap around
+    EXPECT_GT(unreachable_distance<std::uint32_t>() + unreachable_distance<std::uint32_t>(), unreachable_distance<std::uint32_t>());
+    expect_same_distances<float>(graph);
+    expect_same_distances<std::uint32_t>(graph);
+}
+
+
+// Test that a single search seeded with every source vertex finds the nearest source, distance and path of each vertex
+TEST(test_PTHSRCH, test_nearest_source_forest) {
+    auto graph = build_test_ring(120, 17);
+    graph.add_edge("Seattle", "Portland", 174);
+    graph.add_edge("Portland", "Seattle", 174);
+    std::pmr::vector<unsigned int> sources{graph.get_vertex_id("V5"), graph.get_vertex_id("V47"), graph.get_vertex_id("V90"),
+        graph.get_vertex_id("V47")};
+    std::vector<std::pmr::vector<double>> source_distances(sources.size());
+    std::pmr::vector<unsigned int> vertex_path;
+    for (size_t i = 0; i < sources.size(); i++) {
+        shortest_path_tree(graph, sources[i], source_distances[i], vertex_path);
+    }
+
+    auto forest = nearest_source_forest<double>();
+    forest.build(graph, sources);
+    EXPECT_EQ(forest.get_settled_count(), 120U);
+    std::pmr::vector<unsigned int> path;
+    for (unsigned int vertex = 0; vertex < 120; vertex++) {
+        double expected = std::numeric_limits<double>::infinity();
+        for (const auto& distances : source_distances) {
+            expected = std::min(expected, distances[vertex]);
+        }
+        ASSERT_TRUE(forest.reaches(vertex));
+        ASSERT_DOUBLE_EQ(forest.get_distance(vertex), expected);
+        unsigned int nearest = forest.get_nearest_source(vertex);
+        ASSERT_NE(std::find(sources.begin(), sources.end(), nearest), sources.end());
+        ASSERT_TRUE(forest.extract_path(vertex, path));
+        EXPECT_EQ(path.front(), nearest);
+        EXPECT_EQ(path.back(), vertex);
+        double length = 0;
+        for (size_t i = 1; i < path.size(); i++) {
+            length += graph.get_edge_weight(path[i - 1], path[i]);
+        }
+        EXPECT_DOUBLE_EQ(length, expected);
+    }
+    EXPECT_EQ(forest.get_nearest_source(sources[1]), sources[1]);
+
+    // Verticies equally distant from several source verticies are assigned the same source by every kind of queue
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> nearest_sources;
+    std::pmr::vector<unsigned int> heap_nearest_sources;
+    multi_source_tree(graph, sources, distances, vertex_path, heap_nearest_sources, queue_kind::binary_heap);
+    multi_source_tree(graph, sources, distances, vertex_path, nearest_sources, queue_kind::dial_buckets);
+    EXPECT_EQ(nearest_sources, heap_nearest_sources);
+
+    // Verticies of another component are never reached
+    unsigned int unreachable = graph.get_vertex_id("Portland");
+    EXPECT_FALSE(forest.reaches(unreachable));
+    EXPECT_EQ(forest.get_nearest_source(unreachable), name_arena::invalid_id);
+    EXPECT_FALSE(forest.extract_path(unreachable, path));
+}
+
+/**
+ * Adds every loopless path of `graph` from `vertex` to `destination_id` that extends `path` (of length `distance`) to `found`
+ */
+static void list_loopless_paths(const indexed_graph<double>& graph, unsigned int vertex, unsigned int destination_id, std::vector<unsigned int>& path,
+    double distance, std::vector<std::pair<double, std::vector<unsigned int>>>& found) {
+    path.push_back(vertex);
+    if (vertex == destination_id) {
+        found.emplace_back(distance, path);
+    } else {
+        for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+            if (std::find(path.begin(), path.end(), adjacent_edge.target) == path.end()) {
+                list_loopless_paths(graph, adjacent_edge.target, destination_id, path, adjacent_edge.weight + distance, found);
+            }
+        }
+    }
+    path.pop_back();
+}
+
+
+// Test that Yen's algorithm yields distinct loopless paths of the shortest lengths in order, regardless of the thread count
+TEST(test_PTHSRCH, test_k_shortest_paths) {
+    auto graph = build_test_ring(11, 4);
+    auto directed = indexed_graph<double>(11);
+    for (unsigned int i = 0; i < 11; i++) {
+        directed.add_edge("V" + std::to_string(i), "V" + std::to_string((i + 1) % 11), static_cast<double>(i % 3 + 1));
+        directed.add_edge("V" + std::to_string(i), "V" + std::to_string((i + 3) % 11), static_cast<double>(i % 4 + 2));
+    }
+    auto paths = k_shortest_paths<double>();
+    for (const auto* searched : {&graph, &directed}) {
+        for (auto [source, destination] : {std::pair<unsigned int, unsigned int>{0, 6}, {3, 9}, {5, 5}}) {
+            std::vector<std::pair<double, std::vector<unsigned int>>> expected;
+            std::vector<unsigned int> path;
+            list_loopless_paths(*searched, source, destination, path, 0, expected);
+            std::sort(expected.begin(), expected.end());
+            std::vector<std::vector<unsigned int>> single_thread_paths;
+            for (unsigned int thread_count : {1U, 4U}) {
+                size_t found = paths.build(*searched, source, destination, 40, thread_count);
+                ASSERT_EQ(found, std::min<size_t>(40, expected.size()));
+                std::vector<std::vector<unsigned int>> found_paths;
+                for (size_t rank = 0; rank < found; rank++) {
+                    const auto& ranked = paths.get_path(rank);
+                    found_paths.emplace_back(ranked.verticies.begin(), ranked.verticies.end());
+                    // Equally long paths may be found in any order, but each must be one of the loopless paths of that length
+                    EXPECT_DOUBLE_EQ(ranked.distance, expected[rank].first);
+                    auto listed = std::find_if(expected.begin(), expected.end(), [&](const auto& entry) { return entry.second == found_paths.back(); });
+                    ASSERT_NE(listed, expected.end());
+                    EXPECT_DOUBLE_EQ(listed -> first, ranked.distance);
+                }
+                std::vector<std::vector<unsigned int>> distinct_paths = found_paths;
+                std::sort(distinct_paths.begin(), distinct_paths.end());
+                EXPECT_EQ(std::unique(distinct_paths.begin(), distinct_paths.end()), distinct_paths.end());
+                if (thread_count == 1) {
+                    single_thread_paths = found_paths;
+                } else {
+                    EXPECT_EQ(found_paths, single_thread_paths);
+                }
+            }
+        }
+    }
+    // Spur searches of a symmetric graph finish along the reverse tree, while those of a directed graph search to the destination
+    paths.build(graph, 0, 6, 10);
+    EXPECT_GT(paths.get_reused_count(), 0UL);
+    paths.build(directed, 0, 6, 10);
+    EXPECT_EQ(paths.get_reused_count(), 0UL);
+    EXPECT_EQ(paths.build(graph, 0, 6, 0), 0U);
+}
+
+// Test that repairing a tree after each shortened, lengthened or added edge yields exactly the tree built again from scratch
+TEST(test_PTHSRCH, test_path_tree_repair) {
+    auto graph = build_test_ring(80, 9);
+    std::vector<unsigned int> sources = {0, 23, 57};
+    std::vector<path_tree<double>> trees(sources.size());
+    for (size_t i = 0; i < sources.size(); i++) {
+        trees[i].build(graph, sources[i]);
+    }
+    path_tree<double> expected;
+    unsigned int changed_total = 0;
+    for (unsigned int step = 0; step < 150; step++) {
+        unsigned int first = (step * 37) % 80;
+        unsigned int second = step % 4 == 3 ? (first + 11 + step % 7) % 80 : (first + (step % 2 == 0 ? 1 : 9)) % 80;
+        // Weights cycle through shorter, longer and equal (tied) lengths, including shortcuts between unjoined verticies
+        double weight = static_cast<double>((step * 13) % 17 + 1) / 2;
+        graph.set_edge_weight(first, second, weight);
+        graph.set_edge_weight(second, first, weight);
+        for (size_t i = 0; i < sources.size(); i++) {
+            changed_total += trees[i].repair(graph, first, second);
+            expected.build(graph, sources[i]);
+            ASSERT_EQ(trees[i].get_distances(), expected.get_distances()) << "step " << step << " source " << sources[i];
+            ASSERT_EQ(trees[i].get_predecessors(), expected.get_predecessors()) << "step " << step << " source " << sources[i];
+            EXPECT_EQ(trees[i].get_settled_count(), expected.get_settled_count());
+        }
+    }
+    EXPECT_GT(changed_total, 0U);
+
+    // Cached trees are repaired in place rather than discarded, including after an edge to a new vertex is added
+    auto cache = path_tree_cache<double>(1 << 20);
+    unsigned int source = graph.get_vertex_id("V4");
+    cache.get_tree(graph, source);
+    cache.get_tree(graph, graph.get_vertex_id("V40"));
+    EXPECT_FALSE(cache.update_edge(graph, "V4", "V5", 1000.0));
+    EXPECT_TRUE(cache.update_edge(graph, "V41", "Leaf", 0.5));
+    EXPECT_EQ(cache.get_repair_count(), 4UL);
+    EXPECT_EQ(cache.get_invalidation_count(), 0UL);
+    const auto& repaired = cache.get_tree(graph, source);
+    EXPECT_EQ(cache.get_miss_count(), 2UL);
+    expected.build(graph, source);
+    EXPECT_EQ(repaired.get_distances(), expected.get_distances());
+    EXPECT_EQ(repaired.get_predecessors(), expected.get_predecessors());
+    EXPECT_EQ(repaired.get_settled_count(), graph.get_vertex_count());
+    EXPECT_THROW(cache.update_edge(graph, "V4", "V5", 0.0), std::runtime_error);
+
+    // A directed graph cannot be repaired through outgoing edges, so its trees are built again
+    auto directed = indexed_graph<double>();
+    directed.add_edge("A", "B", 1.0);
+    directed.add_edge("B", "C", 1.0);
+    directed.add_edge("A", "C", 5.0);
+    path_tree<double> directed_tree;
+    directed_tree.build(directed, 0);
+    directed.set_edge_weight(0, 2, 1.5);
+    directed_tree.repair(directed, 0, 2);
+    EXPECT_DOUBLE_EQ(directed_tree.get_distance(2), 1.5);
+    EXPECT_EQ(directed_tree.get_predecessors()[2], 0U);
+}
+
+
+
+// Test that every region receives a balanced share of the verticies, with fewer cut edges than cutting the vertex IDs into runs
+TEST(test_PTHSRCH, test_partition_graph) {
+    // Verticies are numbered in a scattered order, so runs of consecutive IDs are joined by many edges
+    const unsigned int side = 24;
+    auto graph = indexed_graph<double>(side * side);
+    for (unsigned int i = 0; i < side * side; i++) {
+        unsigned int cell = (i * 97) % (side * side);
+        graph.add_vertex("R" + std::to_string(cell / side) + " C" + std::to_string(cell % side));
+    }
+    for (unsigned int row = 0; row < side; row++) {
+        for (unsigned int column = 0; column < side; column++) {
+            std::string cell = "R" + std::to_string(row) + " C" + std::to_string(column);
+            if (column + 1 < side) {
+                graph.add_edge(cell, "R" + std::to_string(row) + " C" + std::to_string(column + 1), 1.0);
+                graph.add_edge("R" + std::to_string(row) + " C" + std::to_string(column + 1), cell, 1.0);
+            }
+            if (row + 1 < side) {
+                graph.add_edge(cell, "R" + std::to_string(row + 1) + " C" + std::to_string(column), 2.0);
+                graph.add_edge("R" + std::to_string(row + 1) + " C" + std::to_string(column), cell, 2.0);
+            }
+        }
+    }
+    const unsigned int region_count = 8;
+    std::pmr::vector<unsigned int> regions;
+    size_t cut_count = partition_graph(graph, region_count, regions);
+    ASSERT_EQ(regions.size(), static_cast<size_t>(graph.get_vertex_count()));
+    std::vector<unsigned int> region_sizes(region_count, 0);
+    for (unsigned int region : regions) {
+        ASSERT_LT(region, region_count);
+        region_sizes[region]++;
+    }
+    for (unsigned int size : region_sizes) {
+        EXPECT_GT(size, 0U);
+        EXPECT_LE(size, static_cast<unsigned int>(graph.get_vertex_count() / region_count * (1 + partition_imbalance)) + 1);
+    }
+    size_t run_cut_count = 0;
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+            if (vertex * region_count / graph.get_vertex_count() != adjacent_edge.target * region_count / graph.get_vertex_count()) {
+                run_cut_count++;
+            }
+        }
+    }
+    EXPECT_LT(cut_count * 4, run_cut_count);
+
+    // Requests for more regions than verticies place every vertex within its own region
+    auto small_graph = build_test_ring(6, 2);
+    EXPECT_EQ(partition_graph(small_graph, 10, regions), small_graph.get_edge_count());
+    std::sort(regions.begin(), regions.end());
+    EXPECT_EQ(regions, (std::pmr::vector<unsigned int>{0, 1, 2, 3, 4, 5}));
+    EXPECT_THROW(partition_graph(small_graph, 0, regions), std::runtime_error);
+}
+
+
+// Test that searches over flagged edges find shortest paths while settling fewer verticies than Dijkstra's algorithm
+TEST(test_PTHSRCH, test_arc_flag_search) {
+    auto graph = build_test_ring(60, 7);
+    // A separate edge leaves the graph disconnected
+    graph.add_edge("Fresno", "San Diego", 3.0);
+    graph.add_edge("San Diego", "Fresno", 3.0);
+    auto arc_flags = arc_flag_table<double>();
+    arc_flags.build(graph, 6, 1);
+    EXPECT_EQ(arc_flags.get_region_count(), 6U);
+    EXPECT_GT(arc_flags.get_boundary_count(), 0U);
+    std::pmr::vector<double> forward_distances;
+    std::pmr::vector<unsigned int> forward_path;
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    unsigned long forward_settled = 0;
+    unsigned long flag_settled = 0;
+    for (unsigned int source = 0; source < graph.get_vertex_count(); source++) {
+        for (unsigned int destination = 0; destination < graph.get_vertex_count(); destination++) {
+            auto expected = forward_search(graph, source, destination, forward_distances, forward_path);
+            auto result = arc_flag_search(graph, source, destination, arc_flags, distances, vertex_path);
+            ASSERT_EQ(result.distance, expected.distance) << source << " to " << destination;
+            if (expected.distance != unreachable_distance<double>()) {
+                EXPECT_DOUBLE_EQ(trace_path_length(graph, vertex_path, source, destination), expected.distance);
+            }
+            forward_settled += expected.settled_count;
+            flag_settled += result.settled_count;
+        }
+    }
+    EXPECT_LT(flag_settled, forward_settled);
+
+    // Flags do not depend on the number of threads searching from boundary verticies
+    auto threaded = arc_flag_table<double>();
+    threaded.build(graph, 6, 3);
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        EXPECT_EQ(threaded.get_region(vertex), arc_flags.get_region(vertex));
+        for (size_t position = 0; position < graph.get_adjacent(vertex).size(); position++) {
+            for (unsigned int region = 0; region < arc_flags.get_region_count(); region++) {
+                EXPECT_EQ(threaded.is_flagged(vertex, position, region), arc_flags.is_flagged(vertex, position, region));
+            }
+        }
+    }
+    auto directed = indexed_graph<double>();
+    directed.add_edge("Fresno", "San Diego", 3.0);
+    EXPECT_THROW(threaded.build(directed), std::runtime_error);
+}
+
+
+// Test that saved arc-flags are restored for the same graph and rejected for any other graph
+TEST(test_PTHSRCH, test_arc_flag_persistence) {
+    const std::string flag_file = "test_arc_flags.arc";
+    auto graph = build_test_ring(40, 5);
+    auto arc_flags = arc_flag_table<double>();
+    arc_flags.build(graph, 4);
+    ASSERT_EQ(arc_flags.save(flag_file), 0);
+
+    auto loaded = arc_flag_table<double>();
+    EXPECT_EQ(loaded.load("missing_arc_flags.arc", graph), -1);
+    ASSERT_EQ(loaded.load(flag_file, graph), 0);
+    EXPECT_TRUE(loaded.matches(graph));
+    EXPECT_EQ(loaded.get_region_count(), arc_flags.get_region_count());
+    EXPECT_EQ(loaded.get_flag_bytes(), arc_flags.get_flag_bytes());
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        EXPECT_EQ(loaded.get_region(vertex), arc_flags.get_region(vertex));
+        for (size_t position = 0; position < graph.get_adjacent(vertex).size(); position++) {
+            for (unsigned int region = 0; region < arc_flags.get_region_count(); region++) {
+                EXPECT_EQ(loaded.is_flagged(vertex, position, region), arc_flags.is_flagged(vertex, position, region));
+            }
+        }
+    }
+
+    // Adding a single edge invalidates the saved flags
+    auto changed_graph = build_test_ring(40, 5);
+    changed_graph.add_edge("V0", "V20", 1.0);
+    auto rejected = arc_flag_table<double>();
+    EXPECT_FALSE(arc_flags.matches(changed_graph));
+    EXPECT_EQ(rejected.load(flag_file, changed_graph), -1);
+    EXPECT_EQ(rejected.get_region_count(), 0U);
+    std::remove(flag_file.c_str());
+}
+
+
+// Test that each search begun on a query_scratch reads every vertex as unreached until written by that search
+TEST(test_PTHSRCH, test_query_scratch) {
+    auto scratch = query_scratch<double>();
+    scratch.begin(5);
+    EXPECT_EQ(scratch.get_vertex_count(), 5U);
+    EXPECT_EQ(scratch.get_generation(), 1U);
+    scratch.reach(2, 4.5, 1);
+    scratch.settle(2);
+    scratch.get_heap().add_node(3, 1.0);
+    EXPECT_DOUBLE_EQ(scratch.get_distance(2), 4.5);
+    EXPECT_EQ(scratch.get_predecessor(2), 1U);
+    EXPECT_TRUE(scratch.is_settled(2));
+    EXPECT_EQ(scratch.get_distance(3), unreachable_distance<double>());
+
+    // A new search hides the previous entries and empties the heap
+    scratch.begin(5);
+    EXPECT_EQ(scratch.get_generation(), 2U);
+    EXPECT_TRUE(scratch.get_heap().is_empty());
+    EXPECT_EQ(scratch.get_distance(2), unreachable_distance<double>());
+    EXPECT_EQ(scratch.get_predecessor(2), name_arena::invalid_id);
+    EXPECT_FALSE(scratch.is_settled(2));
+    scratch.reach(4, 1.0, name_arena::invalid_id);
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    scratch.copy_to(distances, vertex_path);
+    EXPECT_EQ(distances, (std::pmr::vector<double>{unreachable_distance<double>(), unreachable_distance<double>(),
+        unreachable_distance<double>(), unreachable_distance<double>(), 1.0}));
+    EXPECT_EQ(vertex_path, (std::pmr::vector<unsigned int>(5, name_arena::invalid_id)));
+
+    // Searching a graph with a different number of verticies clears the arrays and restarts the generations
+    scratch.begin(3);
+    EXPECT_EQ(scratch.get_vertex_count(), 3U);
+    EXPECT_EQ(scratch.get_generation(), 1U);
+    for (unsigned int vertex = 0; vertex < 3; vertex++) {
+        EXPECT_EQ(scratch.get_distance(vertex), unreachable_distance<double>());
+    }
+}
+
+
+// Test that searches reusing the same scratch across every pair of verticies match searches over arrays filled for each query
+TEST(test_PTHSRCH, test_query_scratch_searches) {
+    auto graph = build_test_ring(50, 7);
+    // A separate edge leaves the graph disconnected
+    graph.add_edge("Fresno", "San Diego", 3.0);
+    graph.add_edge("San Diego", "Fresno", 3.0);
+    auto forward_scratch = query_scratch<double>();
+    auto backward_scratch = query_scratch<double>();
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    for (unsigned int source = 0; source < graph.get_vertex_count(); source++) {
+        for (unsigned int destination = 0; destination < graph.get_vertex_count(); destination++) {
+            auto expected = forward_search(graph, source, destination, distances, vertex_path);
+            auto result = forward_search(graph, source, destination, forward_scratch);
+            ASSERT_EQ(result.distance, expected.distance) << source << " to " << destination;
+            EXPECT_EQ(result.settled_count, expected.settled_count);
+            for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+                EXPECT_EQ(forward_scratch.get_distance(vertex), distances[vertex]);
+            }
+
+            expected = bidirectional_search(graph, source, destination, distances, vertex_path);
+            result = bidirectional_search(graph, source, destination, forward_scratch, backward_scratch);
+            ASSERT_EQ(result.distance, expected.distance) << source << " to " << destination;
+            EXPECT_EQ(result.settled_count, expected.settled_count);
+            if (expected.distance == unreachable_distance<double>()) {
+                continue;
+            }
+            // Following the predecessors back from the destination vertex traces a path of the found length
+            forward_scratch.copy_to(distances, vertex_path);
+            EXPECT_DOUBLE_EQ(trace_path_length(graph, vertex_path, source, destination), expected.distance);
+        }
+    }
+    EXPECT_EQ(forward_scratch.get_generation(), 2 * graph.get_vertex_count() * graph.get_vertex_count());
+}
+
+
+// Test that a saved all-pairs table is loaded for the same graph, and rejected for a changed one
+TEST(test_PTHSRCH, test_all_pairs_persistence) {
+    const std::string table_file = "test_all_pairs.apsp";
+    auto graph = build_test_ring(70, 9);
+    auto table = all_pairs_table<double>();
+    table.build(graph, 2);
+    ASSERT_EQ(table.save(table_file), 0);
+
+    auto loaded = all_pairs_table<double>();
+    EXPECT_EQ(loaded.load("missing_all_pairs.apsp", graph), -1);
+    ASSERT_EQ(loaded.load(table_file, graph), 0);
+    EXPECT_TRUE(loaded.matches(graph));
+    ASSERT_EQ(loaded.get_vertex_count(), graph.get_vertex_count());
+    std::pmr::vector<unsigned int> expected_path;
+    std::pmr::vector<unsigned int> path;
+    for (unsigned int source = 0; source < graph.get_vertex_count(); source++) {
+        for (unsigned int destination = 0; destination < graph.get_vertex_count(); destination++) {
+            ASSERT_EQ(loaded.get_distance(source, destination), table.get_distance(source, destination));
+            EXPECT_EQ(loaded.get_next_hop(source, destination), table.get_next_hop(source, destination));
+        }
+    }
+    ASSERT_TRUE(table.extract_path(5, 60, expected_path));
+    ASSERT_TRUE(loaded.extract_path(5, 60, path));
+    EXPECT_EQ(path, expected_path);
+
+    // Adding a single edge invalidates the saved table
+    auto changed_graph = build_test_ring(70, 9);
+    changed_graph.add_edge("V0", "V35", 1.0);
+    auto rejected = all_pairs_table<double>();
+    EXPECT_FALSE(table.matches(changed_graph));
+    EXPECT_EQ(rejected.load(table_file, changed_graph), -1);
+    EXPECT_EQ(rejected.get_vertex_count(), 0U);
+    std::remove(table_file.c_str());
+}
+
+
+// ==================================================== DISTANCE MATRIX TESTING ==================================================================
+
+// Test Suite test_DSTMTX: MANY-TO-MANY DISTANCE MATRIX Functions
+// Test distance_matrix
+
+// Test 1: Test distance_matrix rows against forward_search with one and several threads (including repeated and unreachable targets)
+// Test 2: Test distance_matrix CSV and binary export
+
+
+// Test that every cell matches a single-pair search regardless of the number of threads
+TEST(test_DSTMTX, test_distance_matrix_compute) {
+    auto graph = build_test_ring(60, 7);
+    graph.add_edge("Seattle", "Portland", 174);
+    graph.add_edge("Portland", "Seattle", 174);
+    std::vector<unsigned int> sources;
+    std::vector<unsigned int> targets;
+    for (unsigned int id = 0; id < 60; id += 3) {
+        sources.push_back(id);
+        targets.push_back(59 - id);
+    }
+    targets.push_back(targets.front());
+    targets.push_back(graph.get_vertex_id("Portland"));
+
+    auto single_thread = distance_matrix<double>();
+    auto multi_thread = distance_matrix<double>();
+    single_thread.compute(graph, sources, targets, 1);
+    multi_thread.compute(graph, sources, targets, 4);
+    ASSERT_EQ(multi_thread.get_row_count(), sources.size());
+    ASSERT_EQ(multi_thread.get_column_count(), targets.size());
+    EXPECT_EQ(multi_thread.get_settled_count(), single_thread.get_settled_count());
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    for (size_t row = 0; row < sources.size(); row++) {
+        for (size_t column = 0; column < targets.size(); column++) {
+            auto expected = forward_search(graph, sources[row], targets[column], distances, vertex_path);
+            EXPECT_DOUBLE_EQ(single_thread.get_distance(row, column), expected.distance);
+            EXPECT_DOUBLE_EQ(multi_thread.get_row(row)[column], expected.distance);
+        }
+    }
+    EXPECT_EQ(multi_thread.get_distance(0, targets.size() - 1), std::numeric_limits<double>::infinity());
+
+    // Searches end once all targets are settled, so nearby targets settle fewer verticies than the whole component
+    auto near_targets = distance_matrix<double>();
+    near_targets.compute(graph, {graph.get_vertex_id("V10")}, {graph.get_vertex_id("V11")});
+    EXPECT_LT(near_targets.get_settled_count(), 60UL);
+    EXPECT_THROW(near_targets.compute(graph, {0}, {graph.get_vertex_count()}), std::runtime_error);
+}
+
+
+// Test that both export formats reproduce the names and distances of the matrix
+TEST(test_DSTMTX, test_distance_matrix_export) {
+    auto graph = indexed_graph<double>(4);
+    graph.add_edge("Seattle", "Portland", 174);
+    graph.add_edge("Portland", "Seattle", 174);
+    graph.add_edge("Portland", "Boise, ID", 430.5);
+    graph.add_edge("Boise, ID", "Portland", 430.5);
+    graph.add_edge("Dallas", "Houston", 239);
+    std::vector<unsigned int> sources = {graph.get_vertex_id("Seattle"), graph.get_vertex_id("Boise, ID")};
+    std::vector<unsigned int> targets = {graph.get_vertex_id("Boise, ID"), graph.get_vertex_id("Seattle"), graph.get_vertex_id("Houston")};
+    auto matrix = distance_matrix<double>();
+    matrix.compute(graph, sources, targets);
+
+    const std::string csv_file = "test_distance_matrix.csv";
+    ASSERT_EQ(matrix.write_csv(csv_file, graph), 0);
+    std::ifstream read_csv(csv_file);
+    std::stringstream csv_contents;
+    csv_contents << read_csv.rdbuf();
+    EXPECT_EQ(csv_contents.str(), "source,\"Boise, ID\",Seattle,Houston\nSeattle,604.5,0,inf\n\"Boise, ID\",0,604.5,inf\n");
+    std::remove(csv_file.c_str());
+
+    const std::string binary_file = "test_distance_matrix.bin";
+    ASSERT_EQ(matrix.write_binary(binary_file), 0);
+    std::ifstream read_binary(binary_file, std::ios::binary);
+    char tag[8] = {};
+    std::uint32_t type_size = 0;
+    std::uint64_t row_count = 0;
+    std::uint64_t column_count = 0;
+    read_binary.read(tag, sizeof(tag));
+    read_binary.read(reinterpret_cast<char*>(&type_size), sizeof(type_size));
+    read_binary.read(reinterpret_cast<char*>(&row_count), sizeof(row_count));
+    read_binary.read(reinterpret_cast<char*>(&column_count), sizeof(column_count));
+    std::vector<unsigned int> ids(sources.size() + targets.size());
+    std::vector<double> cells(sources.size() * targets.size());
+    read_binary.read(reinterpret_cast<char*>(ids.data()), static_cast<std::streamsize>(ids.size() * sizeof(unsigned int)));
+    read_binary.read(reinterpret_cast<char*>(cells.data()), static_cast<std::streamsize>(cells.size() * sizeof(double)));
+    ASSERT_TRUE(read_binary.good());
+    EXPECT_EQ(std::memcmp(tag, distance_matrix<double>::file_tag, sizeof(tag)), 0);
+    EXPECT_EQ(type_size, sizeof(double));
+    EXPECT_EQ(row_count, 2U);
+    EXPECT_EQ(column_count, 3U);
+    EXPECT_EQ(ids[1], sources[1]);
+    EXPECT_EQ(ids[4], targets[2]);
+    EXPECT_EQ(std::memcmp(cells.data(), matrix.data(), cells.size() * sizeof(double)), 0);
+    EXPECT_EQ(read_binary.peek(), std::ifstream::traits_type::eof());
+    std::remove(binary_file.c_str());
+}
+
+
+// ==================================================== DYNAMIC MINIMUM SPANNING FOREST TESTING ==================================================================
+
+// Test Suite test_DYNMST: MINIMUM SPANNING FOREST MAINTAINED UNDER EDGE INSERTIONS Functions
+// Test dynamic_mst
+
+// Test 1: Test dynamic_mst::build against Kruskal's algorithm for a connected and a disconnected graph
+// Test 2: Test insert_edge/decrease_weight against the minimum spanning forest computed again after every update
+// Test 3: Test minimum_spanning_forest per component against Kruskal's algorithm for several thread counts
+
+
+/**
+ * Computes the total weight and edge count of the minimum spanning forest of the undirected edges in `edges` (keyed by their
+ * lower and higher vertex IDs) with Kruskal's algorithm over a plain union-find
+ */
+static std::pair<double, size_t> reference_forest(const std::map<std::pair<unsigned int, unsigned int>, double>& edges, unsigned int vertex_count) {
+    std::vector<std::tuple<double, unsigned int, unsigned int>> sorted;
+    for (const auto& [ends, weight] : edges) {
+        sorted.emplace_back(weight, ends.first, ends.second);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<unsigned int> parents(vertex_count);
+    for (unsigned int vertex = 0; vertex < vertex_count; vertex++) {
+        parents[vertex] = vertex;
+    }
+    auto find = [&](unsigned int vertex) {
+        while (parents[vertex] != vertex) {
+            vertex = parents[vertex] = parents[parents[vertex]];
+        }
+        return vertex;
+    };
+    double total = 0;
+    size_t count = 0;
+    for (const auto& [weight, first, second] : sorted) {
+        if (find(first) != find(second)) {
+            parents[find(first)] = find(second);
+            total += weight;
+            count++;
+        }
+    }
+    return {total, count};
+}
+
+
+// Test that the forest built from a graph spans every component with the least total weight
+TEST(test_DYNMST, test_dynamic_mst_build) {
+    auto graph = build_test_ring(60, 7);
+    // A separate triangle leaves the graph disconnected
+    graph.add_edge("A", "B", 2.0);
+    graph.add_edge("B", "A", 2.0);
+    graph.add_edge("B", "C", 1.0);
+    graph.add_edge("C", "B", 1.0);
+    graph.add_edge("A", "C", 4.0);
+    graph.add_edge("C", "A", 4.0);
+    std::map<std::pair<unsigned int, unsigned int>, double> edges;
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+            edges[{std::min(vertex, adjacent_edge.target), std::max(vertex, adjacent_edge.target)}] = adjacent_edge.weight;
+        }
+    }
+    auto forest = dynamic_mst<double>();
+    forest.build(graph);
+    auto expected = reference_forest(edges, graph.get_vertex_count());
+    EXPECT_DOUBLE_EQ(forest.get_total_weight(), expected.first);
+    EXPECT_EQ(forest.get_edge_count(), expected.second);
+    EXPECT_EQ(forest.get_edge_count(), static_cast<size_t>(graph.get_vertex_count() - 2));
+    unsigned int a = graph.get_vertex_id("A");
+    EXPECT_TRUE(forest.connected(a, graph.get_vertex_id("C")));
+    EXPECT_FALSE(forest.connected(a, 0));
+    auto heaviest = forest.get_path_maximum(a, graph.get_vertex_id("C"));
+    EXPECT_EQ(heaviest.weight, 2.0);
+    EXPECT_EQ(heaviest.first, a);
+    EXPECT_THROW(forest.get_path_maximum(a, 0), std::runtime_error);
+
+    double listed_total = 0;
+    auto listed = forest.get_edges();
+    for (const auto& tree_edge : listed) {
+        EXPECT_LT(tree_edge.first, tree_edge.second);
+        EXPECT_EQ(graph.get_edge_weight(tree_edge.first, tree_edge.second), tree_edge.weight);
+        listed_total += tree_edge.weight;
+    }
+    EXPECT_EQ(listed.size(), forest.get_edge_count());
+    EXPECT_DOUBLE_EQ(listed_total, forest.get_total_weight());
+}
+
+
+// Test that every insertion or weight decrease leaves exactly a minimum spanning forest of the updated graph
+TEST(test_DYNMST, test_dynamic_mst_updates) {
+    const unsigned int vertex_count = 70;
+    auto graph = build_test_ring(60, 7);
+    std::map<std::pair<unsigned int, unsigned int>, double> edges;
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+            edges[{std::min(vertex, adjacent_edge.target), std::max(vertex, adjacent_edge.target)}] = adjacent_edge.weight;
+        }
+    }
+    auto forest = dynamic_mst<double>();
+    forest.build(graph);
+    for (unsigned int step = 0; step < 400; step++) {
+        // Later steps reach ten verticies beyond the ring, which join the forest once an edge reaches them
+        unsigned int first = (step * 31) % (step < 200 ? 60 : vertex_count);
+        unsigned int second = (first + 1 + (step * 17) % 23) % (step < 200 ? 60 : vertex_count);
+        if (first == second) {
+            continue;
+        }
+        auto key = std::make_pair(std::min(first, second), std::max(first, second));
+        auto existing = edges.find(key);
+        double weight = static_cast<double>((step * 13) % 29 + 1) / 2;
+        if (existing != edges.end()) {
+            weight = std::min(weight, existing->second);
+            forest.decrease_weight(first, second, weight);
+        } else {
+            forest.insert_edge(first, second, weight);
+        }
+        edges[key] = weight;
+        auto expected = reference_forest(edges, std::max(forest.get_vertex_count(), 60U));
+        ASSERT_DOUBLE_EQ(forest.get_total_weight(), expected.first) << "step " << step;
+        ASSERT_EQ(forest.get_edge_count(), expected.second) << "step " << step;
+    }
+    EXPECT_GT(forest.get_replacement_count(), 0UL);
+    EXPECT_EQ(forest.get_vertex_count(), vertex_count);
+    for (const auto& tree_edge : forest.get_edges()) {
+        EXPECT_EQ(edges.at({tree_edge.first, tree_edge.second}), tree_edge.weight);
+    }
+    // Raising the weight of a forest edge could require an edge that is no longer known
+    auto tree_edge = forest.get_edges().front();
+    EXPECT_THROW(forest.decrease_weight(tree_edge.first, tree_edge.second, tree_edge.weight + 1), std::runtime_error);
+    EXPECT_FALSE(forest.insert_edge(tree_edge.first, tree_edge.second, tree_edge.weight + 1));
+}
+
+
+// Test that the forest grown within each component matches Kruskal's algorithm and does not depend on the thread count
+TEST(test_DYNMST, test_minimum_spanning_forest) {
+    auto graph = build_test_ring(60, 7);
+    // Separate chains and an isolated vertex leave the graph with several components of different sizes
+    for (unsigned int i = 0; i < 12; i++) {
+        std::string first = "Chain " + std::to_string(i);
+        std::string second = "Chain " + std::to_string(i % 4 == 3 ? i - 3 : i + 1);
+        double weight = static_cast<double>((i * 7) % 5 + 1);
+        graph.add_edge(first, second, weight);
+        graph.add_edge(second, first, weight);
+    }
+    graph.add_vertex("Alone");
+    EXPECT_EQ(graph.get_component_count(), static_cast<unsigned int>(5));
+    std::map<std::pair<unsigned int, unsigned int>, double> edges;
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+            edges[{std::min(vertex, adjacent_edge.target), std::max(vertex, adjacent_edge.target)}] = adjacent_edge.weight;
+        }
+    }
+    auto expected = reference_forest(edges, graph.get_vertex_count());
+
+    std::vector<spanning_edge<double>> single_thread;
+    EXPECT_DOUBLE_EQ(minimum_spanning_forest(graph, single_thread, 1), expected.first);
+    EXPECT_EQ(single_thread.size(), expected.second);
+    EXPECT_EQ(single_thread.size(), static_cast<size_t>(graph.get_vertex_count() - graph.get_component_count()));
+    for (const auto& forest_edge : single_thread) {
+        EXPECT_LT(forest_edge.first, forest_edge.second);
+        EXPECT_EQ(graph.get_edge_weight(forest_edge.first, forest_edge.second), forest_edge.weight);
+    }
+    for (unsigned int thread_count : {2U, 3U, 8U}) {
+        std::vector<spanning_edge<double>> threaded;
+        EXPECT_EQ(minimum_spanning_forest(graph, threaded, thread_count), minimum_spanning_forest(graph, single_thread, 1));
+        ASSERT_EQ(threaded.size(), single_thread.size());
+        for (size_t i = 0; i < threaded.size(); i++) {
+            EXPECT_EQ(threaded[i].first, single_thread[i].first);
+            EXPECT_EQ(threaded[i].second, single_thread[i].second);
+        }
+    }
+}
+
+
+// ==================================================== VERTEX ORDER TESTING ==================================================================
+
+// Test Suite test_VRTXORD: CACHE-LOCALITY VERTEX RELABELLING Functions
+// Test compute_vertex_order/reorder_graph
+
+// Test 1: Test compute_vertex_order placing every vertex once and shortening the span of edges for both orderings
+// Test 2: Test reorder_graph carrying names, edges and shortest distances over to the new IDs
+
+
+/**
+ * Builds an undirected `side` x `side` grid whose verticies are named by their row and column but added in a scattered order,
+ * so that neighboring verticies receive distant IDs
+ */
+static indexed_graph<double> build_scattered_grid(unsigned int side) {
+    unsigned int vertex_count = side * side;
+    auto graph = indexed_graph<double>(vertex_count);
+    auto name = [side](unsigned int cell) { return "R" + std::to_string(cell / side) + " C" + std::to_string(cell % side); };
+    for (unsigned int i = 0; i < vertex_count; i++) {
+        graph.add_vertex(name((i * 7919U) % vertex_count));
+    }
+    for (unsigned int cell = 0; cell < vertex_count; cell++) {
+        double weight = static_cast<double>((cell * 7) % 5 + 1);
+        if (cell % side + 1 < side) {
+            graph.add_edge(name(cell), name(cell + 1), weight);
+            graph.add_edge(name(cell + 1), name(cell), weight);
+        }
+        if (cell + side < vertex_count) {
+            graph.add_edge(name(cell), name(cell + side), weight + 1);
+            graph.add_edge(name(cell + side), name(cell), weight + 1);
+        }
+    }
+    return graph;
+}
+
+
+// Test that both orderings are permutations covering every component and bring neighboring verticies closer together
+TEST(test_VRTXORD, test_compute_vertex_order) {
+    auto graph = build_scattered_grid(30);
+    // A separate edge and an isolated vertex are placed as components of their own
+    graph.add_edge("Fresno", "San Diego", 3);
+    graph.add_edge("San Diego", "Fresno", 3);
+    graph.add_vertex("Chicago");
+    double scattered_span = mean_edge_span(graph);
+    for (auto ordering : {vertex_ordering::breadth_first, vertex_ordering::reverse_cuthill_mckee}) {
+        std::pmr::vector<unsigned int> order;
+        compute_vertex_order(graph, ordering, order);
+        ASSERT_EQ(order.size(), static_cast<size_t>(graph.get_vertex_count()));
+        std::vector<bool> seen(graph.get_vertex_count(), false);
+        for (unsigned int vertex : order) {
+            ASSERT_LT(vertex, graph.get_vertex_count());
+            EXPECT_FALSE(seen[vertex]);
+            seen[vertex] = true;
+        }
+        std::pmr::vector<unsigned int> old_to_new;
+        auto reordered = reorder_graph(graph, order, old_to_new);
+        EXPECT_LT(mean_edge_span(reordered), scattered_span / 4);
+        // Verticies of the same component receive consecutive IDs
+        unsigned int fresno = reordered.get_vertex_id("Fresno");
+        unsigned int san_diego = reordered.get_vertex_id("San Diego");
+        EXPECT_EQ(std::max(fresno, san_diego) - std::min(fresno, san_diego), 1U);
+    }
+    // Breadth-first order starts from the lowest vertex ID, while reverse Cuthill-McKee order ends with a vertex of least degree
+    std::pmr::vector<unsigned int> order;
+    compute_vertex_order(graph, vertex_ordering::breadth_first, order);
+    EXPECT_EQ(order.front(), 0U);
+    compute_vertex_order(graph, vertex_ordering::reverse_cuthill_mckee, order);
+    EXPECT_EQ(order.back(), graph.get_vertex_id("Chicago"));
+}
+
+
+// Test that the relabelled graph holds the same named edges and shortest distances, and that invalid orders are rejected
+TEST(test_VRTXORD, test_reorder_graph) {
+    auto graph = build_scattered_grid(20);
+    std::pmr::vector<unsigned int> order;
+    std::pmr::vector<unsigned int> old_to_new;
+    compute_vertex_order(graph, vertex_ordering::reverse_cuthill_mckee, order);
+    std::pmr::monotonic_buffer_resource arena;
+    auto reordered = reorder_graph(graph, order, old_to_new, &arena);
+    EXPECT_EQ(reordered.get_memory_resource(), &arena);
+    EXPECT_EQ(reordered.get_vertex_count(), graph.get_vertex_count());
+    EXPECT_EQ(reordered.get_edge_count(), graph.get_edge_count());
+    EXPECT_TRUE(reordered.is_symmetric());
+    EXPECT_EQ(reordered.get_component_count(), graph.get_component_count());
+    for (unsigned int vertex = 0; vertex < graph.get_vertex_count(); vertex++) {
+        EXPECT_EQ(order[old_to_new[vertex]], vertex);
+        EXPECT_EQ(reordered.get_vertex_name(old_to_new[vertex]), graph.get_vertex_name(vertex));
+        for (const auto& adjacent_edge : graph.get_adjacent(vertex)) {
+            EXPECT_EQ(reordered.get_edge_weight(old_to_new[vertex], old_to_new[adjacent_edge.target]), adjacent_edge.weight);
+        }
+        auto adjacent = reordered.get_adjacent(old_to_new[vertex]);
+        EXPECT_TRUE(std::is_sorted(adjacent.begin(), adjacent.end(), [](const auto& a, const auto& b) { return a.target < b.target; }));
+    }
+    std::pmr::vector<double> distances;
+    std::pmr::vector<unsigned int> vertex_path;
+    for (unsigned int q = 0; q < 20; q++) {
+        unsigned int source = (q * 37) % graph.get_vertex_count();
+        unsigned int destination = (q * 101 + 7) % graph.get_vertex_count();
+        double expected = forward_search(graph, source, destination, distances, vertex_path).distance;
+        EXPECT_EQ(forward_search(reordered, old_to_new[source], old_to_new[destination], distances, vertex_path).distance, expected);
+    }
+
+    order.pop_back();
+    EXPECT_THROW(reorder_graph(graph, order, old_to_new), std::runtime_error);
+    order.push_back(order.front());
+    EXPECT_THROW(reorder_graph(graph, order, old_to_new), std::runtime_error);
+}